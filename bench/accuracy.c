@@ -0,0 +1,394 @@
+// Exhaustive accuracy harness: runs every float bit pattern (or every step-th one)
+// through each fmath function and compares against the double-precision libm result,
+// reporting max/mean ULP and max absolute error per input domain, plus mismatches on
+// special results (NaN/inf expected or produced). Inputs go through the array API in
+// blocks, so the SIMD kernel set in effect is what gets measured; --scalar measures the
+// scalar entry points instead. --precision sets the array tier; the scalar API runs at
+// the FMATH_PRECISION it was built with (-DFMATH_PRECISION=2 for the accurate tier).
+// atan2(y, x) walks x the same way with a hashed y per x (all signs and exponents), then
+// adds the signed zero/+-1/+-FLT_MAX/inf/NaN grid; its rows also print the worst y.
+//
+//   gcc -O3 -ffast-math -march=native -funroll-loops -pthread -Iinclude src/*.c bench/accuracy.c -o fmath_accuracy -lm
+//   ./fmath_accuracy [--step N] [--threads N] [--scalar] [--precision fast|balanced|accurate] [fn ...]
+//
+// Built with -ffast-math the process runs with FTZ/DAZ set, so the subnormal domains show
+// what such builds get (subnormal inputs read as zero).
+
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "fmath.h"
+
+enum {
+	MAX_DOMAINS = 4,
+	BLOCK = 1 << 16 /* bit patterns per work item */
+};
+
+typedef struct fn_spec {
+	const char *name;
+	void (*array)(float *dst, const float *src, size_t count);
+	float (*scalar)(float x);
+	double (*reference)(double x);
+	int (*domain)(float x); /* index into domains, from the finite input x */
+	const char *domains[MAX_DOMAINS];
+	/* two-argument functions f(y, x) instead: x runs over the bit patterns, y is sampled */
+	void (*array2)(float *dst, const float *y, const float *x, size_t count);
+	float (*scalar2)(float y, float x);
+	double (*reference2)(double y, double x);
+	int (*domain2)(float y, float x); /* from finite y and x */
+} fn_spec;
+
+static double ref_rsqrt(double x) {
+	return 1.0 / sqrt(x);
+}
+
+static double ref_rcp(double x) {
+	return 1.0 / x;
+}
+
+static uint32_t float_to_bits(float x) {
+	uint32_t u;
+	memcpy(&u, &x, sizeof u);
+	return u;
+}
+
+// Exact widening that also holds under DAZ, which reads subnormal floats as zero
+static double float_to_double(float x) {
+	uint32_t u = float_to_bits(x);
+	if (u & 0x7f800000u) return (double)x;
+	double m = ldexp((double)(u & 0x7fffffu), -149);
+	return (u >> 31) ? -m : m;
+}
+
+// Domains follow the kernels' own case splits. Subnormal tests go by bits, since with
+// DAZ set a subnormal compares equal to zero.
+static int domain_trig(float x) {
+	float a = fabsf(x);
+	return a <= 3.14159265f ? 0 : a <= 65536.0f ? 1 : 2;
+}
+
+// Below 2^-125 the input or the result may be subnormal
+static int domain_tan(float x) {
+	uint32_t a = float_to_bits(x) & 0x7fffffffu;
+	float ax = fabsf(x);
+	return a < 0x01000000u ? 0 : ax <= 0.785398163f ? 1 : ax <= 16384.0f ? 2 : 3;
+}
+
+static int domain_atan(float x) {
+	uint32_t a = float_to_bits(x) & 0x7fffffffu;
+	return a < 0x01000000u ? 0 : fabsf(x) <= 1.0f ? 1 : 2;
+}
+
+static int domain_asin(float x) {
+	uint32_t a = float_to_bits(x) & 0x7fffffffu;
+	return a < 0x01000000u ? 0 : fabsf(x) <= 0.5f ? 1 : 2;
+}
+
+static int domain_acos(float x) {
+	return x < -0.5f ? 0 : x <= 0.5f ? 1 : 2;
+}
+
+static int domain_sinh(float x) {
+	uint32_t a = float_to_bits(x) & 0x7fffffffu;
+	return a < 0x01000000u ? 0 : fabsf(x) < 0.5f ? 1 : 2;
+}
+
+static int domain_cosh(float x) {
+	return fabsf(x) < 0.5f ? 0 : fabsf(x) < 9.0f ? 1 : 2;
+}
+
+static int domain_exp(float x) {
+	return x < -87.3365479f ? 0 : x <= 88.7228394f ? 1 : 2;
+}
+
+static int domain_positive(float x) {
+	uint32_t u = float_to_bits(x);
+	return (u >> 31) || u == 0 ? 0 : u < 0x00800000u ? 1 : 2;
+}
+
+// By the octant reduction: t = |y| / |x| directly, t = |x| / |y| reflected about pi/4,
+// and the reflection about pi/2 for x < 0 (sign bit, so -0 counts)
+// plus subnormal inputs and ratios t below 2^-125 (as for atan), which FTZ/DAZ builds
+// read or write as zero
+static int domain_atan2(float y, float x) {
+	uint32_t ay = float_to_bits(y) & 0x7fffffffu, ax = float_to_bits(x) & 0x7fffffffu;
+	if ((ay && ay < 0x00800000u) || (ax && ax < 0x00800000u)) return 3;
+	if (ay > ax) return 1;
+	if (float_to_bits(x) >> 31) return 2;
+	return ay && float_to_double(y) / float_to_double(x) < 0x1p-125 ? 3 : 0;
+}
+
+static int domain_rcp(float x) {
+	uint32_t a = float_to_bits(x) & 0x7fffffffu;
+	return a < 0x00800000u ? 0 : a <= 0x7e800000u ? 1 : 2;
+}
+
+#define UNARY(fn, ref, dom) .name = #fn, .array = fmath_##fn##f_array, .scalar = fmath_##fn##f, .reference = ref, .domain = dom
+
+static const fn_spec fns[] = {
+	{UNARY(sin, sin, domain_trig), .domains = {"|x|<=pi", "|x|<=2^16", "|x|>2^16"}},
+	{UNARY(cos, cos, domain_trig), .domains = {"|x|<=pi", "|x|<=2^16", "|x|>2^16"}},
+	{UNARY(tan, tan, domain_tan), .domains = {"|x|<2^-125", "|x|<=pi/4", "|x|<=2^14", "|x|>2^14"}},
+	{UNARY(atan, atan, domain_atan), .domains = {"|x|<2^-125", "|x|<=1", "|x|>1"}},
+	{.name = "atan2", .array2 = fmath_atan2f_array, .scalar2 = fmath_atan2f, .reference2 = atan2, .domain2 = domain_atan2,
+	 .domains = {"|y|<=|x|, x>=+0", "|y|>|x|", "|y|<=|x|, x<=-0", "t<2^-125 or subn."}},
+	{UNARY(asin, asin, domain_asin), .domains = {"|x|<2^-125", "|x|<=1/2", "|x|>1/2"}},
+	{UNARY(acos, acos, domain_acos), .domains = {"x<-1/2", "|x|<=1/2", "x>1/2"}},
+	{UNARY(sinh, sinh, domain_sinh), .domains = {"|x|<2^-125", "|x|<1/2", "|x|>=1/2"}},
+	{UNARY(cosh, cosh, domain_cosh), .domains = {"|x|<1/2", "1/2<=|x|<9", "|x|>=9"}},
+	{UNARY(tanh, tanh, domain_sinh), .domains = {"|x|<2^-125", "|x|<1/2", "|x|>=1/2"}},
+	{UNARY(exp, exp, domain_exp), .domains = {"subnormal result", "normal result", "overflow"}},
+	{UNARY(log, log, domain_positive), .domains = {"x<=0", "subnormal x", "normal x"}},
+	{UNARY(sqrt, sqrt, domain_positive), .domains = {"x<=0", "subnormal x", "normal x"}},
+	{UNARY(rsqrt, ref_rsqrt, domain_positive), .domains = {"x<=0", "subnormal x", "normal x"}},
+	{UNARY(rcp, ref_rcp, domain_rcp), .domains = {"zero/subnormal x", "normal x", "subnormal result"}},
+};
+
+#undef UNARY
+
+enum { NUM_FNS = sizeof fns / sizeof fns[0] };
+
+// Per domain; the extra slot collects non-finite inputs
+typedef struct err_stats {
+	uint64_t count;     /* finite comparisons */
+	uint64_t special;   /* non-finite expected or produced */
+	uint64_t mismatch;  /* ... of which fmath disagreed (NaN vs inf vs finite, sign of inf) */
+	double max_ulp;
+	double sum_ulp;
+	double max_abs;
+	float worst_x;      /* input of max_ulp */
+	float worst_y;      /* ... and its y, for two-argument functions */
+} err_stats;
+
+typedef struct run_state {
+	const fn_spec *fn;
+	uint64_t step;
+	uint64_t items; /* BLOCK-sized work items */
+	uint64_t next;  /* next unclaimed item (atomic) */
+	int scalar;
+	pthread_mutex_t lock;
+	err_stats stats[MAX_DOMAINS + 1];
+} run_state;
+
+static float bits_to_float(uint32_t u) {
+	float x;
+	memcpy(&x, &u, sizeof x);
+	return x;
+}
+
+// -ffast-math builds assume there are no NaNs or infinities, so isnan/isfinite may fold
+// to constants; classify by bits instead
+static bool is_special(float x) {
+	return (float_to_bits(x) & 0x7f800000u) == 0x7f800000u;
+}
+
+static bool is_nan(float x) {
+	return (float_to_bits(x) & 0x7fffffffu) > 0x7f800000u;
+}
+
+// Float ulp at the magnitude of r (r finite, representable range), 2^-149 at the bottom
+static double float_ulp(double r) {
+	int e;
+	frexp(r, &e);
+	return ldexp(1.0, (e < -125 ? -125 : e) - 24);
+}
+
+static void record(err_stats *s, float y, float x, float got, double ref) {
+	float ref_f = (float)ref;
+	if (is_special(ref_f) || is_special(got)) {
+		++s->special;
+		bool same = (is_nan(ref_f) && is_nan(got)) || float_to_bits(ref_f) == float_to_bits(got);
+		if (!same) ++s->mismatch;
+		return;
+	}
+	double abs_err = fabs(float_to_double(got) - ref);
+	double ulp = abs_err / float_ulp(ref);
+	++s->count;
+	s->sum_ulp += ulp;
+	if (abs_err > s->max_abs) s->max_abs = abs_err;
+	if (ulp > s->max_ulp || s->count == 1) {
+		s->max_ulp = ulp;
+		s->worst_x = x;
+		s->worst_y = y;
+	}
+}
+
+static void merge(err_stats *into, const err_stats *from) {
+	if (from->count && (from->max_ulp > into->max_ulp || !into->count)) {
+		into->max_ulp = from->max_ulp;
+		into->worst_x = from->worst_x;
+		into->worst_y = from->worst_y;
+	}
+	into->count += from->count;
+	into->special += from->special;
+	into->mismatch += from->mismatch;
+	into->sum_ulp += from->sum_ulp;
+	if (from->max_abs > into->max_abs) into->max_abs = from->max_abs;
+}
+
+// y paired with the x of bit pattern p by a multiplicative hash: every exponent and sign
+// is sampled, including zeros, subnormals, infinities and NaNs
+static float sample_y(uint32_t p) {
+	uint32_t h = p * 0x9e3779b1u;
+	return bits_to_float(h ^ (h >> 15));
+}
+
+// Evaluates one block and records it by domain (non-finite inputs in the extra slot)
+static void check_block(const fn_spec *fn, int scalar, err_stats *stats, const float *ys, const float *xs,
+                        float *dst, size_t n) {
+	if (fn->array2) {
+		if (scalar) {
+			for (size_t i = 0; i < n; ++i) dst[i] = fn->scalar2(ys[i], xs[i]);
+		} else {
+			fn->array2(dst, ys, xs, n);
+		}
+		for (size_t i = 0; i < n; ++i) {
+			float y = ys[i], x = xs[i];
+			int d = is_special(x) || is_special(y) ? MAX_DOMAINS : fn->domain2(y, x);
+			record(&stats[d], y, x, dst[i], fn->reference2(float_to_double(y), float_to_double(x)));
+		}
+		return;
+	}
+	if (scalar) {
+		for (size_t i = 0; i < n; ++i) dst[i] = fn->scalar(xs[i]);
+	} else {
+		fn->array(dst, xs, n);
+	}
+	for (size_t i = 0; i < n; ++i) {
+		float x = xs[i];
+		int d = is_special(x) ? MAX_DOMAINS : fn->domain(x);
+		record(&stats[d], 0.0f, x, dst[i], fn->reference(float_to_double(x)));
+	}
+}
+
+static void *worker(void *arg) {
+	run_state *st = (run_state *)arg;
+	const fn_spec *fn = st->fn;
+	err_stats local[MAX_DOMAINS + 1];
+	memset(local, 0, sizeof local);
+	float *src = (float *)malloc(BLOCK * sizeof(float));
+	float *ys = (float *)malloc(BLOCK * sizeof(float));
+	float *dst = (float *)malloc(BLOCK * sizeof(float));
+	if (!src || !ys || !dst) {
+		fprintf(stderr, "allocation failed\n");
+		exit(1);
+	}
+	for (;;) {
+		uint64_t item = __atomic_fetch_add(&st->next, 1, __ATOMIC_RELAXED);
+		if (item >= st->items) break;
+		uint64_t first = item * BLOCK;
+		size_t n = 0;
+		for (uint64_t k = first; k < first + BLOCK; ++k) {
+			uint64_t pattern = k * st->step;
+			if (pattern > UINT32_MAX) break;
+			ys[n] = sample_y((uint32_t)pattern);
+			src[n++] = bits_to_float((uint32_t)pattern);
+		}
+		check_block(fn, st->scalar, local, ys, src, dst, n);
+	}
+	pthread_mutex_lock(&st->lock);
+	for (int d = 0; d <= MAX_DOMAINS; ++d) merge(&st->stats[d], &local[d]);
+	pthread_mutex_unlock(&st->lock);
+	free(src);
+	free(ys);
+	free(dst);
+	return NULL;
+}
+
+static void run(const fn_spec *fn, uint64_t step, int threads, int scalar) {
+	run_state st;
+	memset(&st, 0, sizeof st);
+	st.fn = fn;
+	st.step = step;
+	uint64_t patterns = ((uint64_t)UINT32_MAX) / step + 1;
+	st.items = (patterns + BLOCK - 1) / BLOCK;
+	st.scalar = scalar;
+	pthread_mutex_init(&st.lock, NULL);
+
+	pthread_t tids[256];
+	int started = 0;
+	for (int i = 1; i < threads && i < 256; ++i) {
+		if (pthread_create(&tids[started], NULL, worker, &st) == 0) ++started;
+	}
+	worker(&st);
+	for (int i = 0; i < started; ++i) pthread_join(tids[i], NULL);
+	pthread_mutex_destroy(&st.lock);
+
+	// Two-argument functions also get every pair of signed zeros, +-1, +-FLT_MAX,
+	// infinities and NaNs, the cases IEEE atan2 spells out
+	if (fn->array2) {
+		static const float edges[] = {0.0f, -0.0f, 1.0f, -1.0f, FLT_MAX, -FLT_MAX, INFINITY, -INFINITY, NAN, -NAN};
+		enum { E = sizeof edges / sizeof edges[0] };
+		float gy[E * E], gx[E * E], gd[E * E];
+		for (int i = 0; i < E * E; ++i) {
+			gy[i] = edges[i / E];
+			gx[i] = edges[i % E];
+		}
+		check_block(fn, scalar, st.stats, gy, gx, gd, E * E);
+	}
+
+	for (int d = 0; d <= MAX_DOMAINS; ++d) {
+		const err_stats *s = &st.stats[d];
+		const char *name = d == MAX_DOMAINS ? (fn->array2 ? "inf/nan y or x" : "inf/nan x") : fn->domains[d];
+		if (!name || (!s->count && !s->special)) continue;
+		printf("%-6s %-17s %12llu %12.1f %10.3f %11.3e %15.8g %10llu %10llu", fn->name, name,
+		       (unsigned long long)s->count, s->max_ulp, s->count ? s->sum_ulp / (double)s->count : 0.0, s->max_abs,
+		       float_to_double(s->worst_x), (unsigned long long)s->special, (unsigned long long)s->mismatch);
+		if (fn->array2 && s->count) printf("  (y %.8g)", float_to_double(s->worst_y));
+		printf("\n");
+	}
+	fflush(stdout);
+}
+
+int main(int argc, char **argv) {
+	uint64_t step = 1;
+	int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	int scalar = 0;
+	int selected[NUM_FNS] = {0};
+	int any_selected = 0;
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--step") == 0 && i + 1 < argc) {
+			step = strtoull(argv[++i], NULL, 10);
+		} else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+			threads = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--scalar") == 0) {
+			scalar = 1;
+		} else if (strcmp(argv[i], "--precision") == 0 && i + 1 < argc) {
+			const char *p = argv[++i];
+			fmath_precision tier = strcmp(p, "accurate") == 0   ? FMATH_PRECISION_ACCURATE
+			                       : strcmp(p, "balanced") == 0 ? FMATH_PRECISION_BALANCED
+			                                                    : FMATH_PRECISION_FAST;
+			for (int f = FMATH_FN_EXP; f <= FMATH_FN_TANH; ++f) fmath_set_precision((fmath_fn)f, tier);
+		} else {
+			int found = 0;
+			for (int f = 0; f < NUM_FNS; ++f) {
+				if (strcmp(argv[i], fns[f].name) == 0) selected[f] = found = any_selected = 1;
+			}
+			if (!found) {
+				fprintf(stderr,
+				        "usage: %s [--step N] [--threads N] [--scalar] [--precision fast|balanced|accurate] [fn ...]\n",
+				        argv[0]);
+				return 1;
+			}
+		}
+	}
+	if (step < 1) step = 1;
+	if (threads < 1) threads = 1;
+
+	static const char *const isa_names[] = {"scalar", "sse4.1", "avx2", "avx512"};
+	printf("fmath accuracy: %s, step %llu, %d threads, ISA %s\n", scalar ? "scalar API" : "array API",
+	       (unsigned long long)step, threads, isa_names[fmath_get_isa()]);
+	printf("%-6s %-17s %12s %12s %10s %11s %15s %10s %10s\n", "fn", "domain", "count", "max_ulp", "mean_ulp", "max_abs",
+	       "worst_x", "special", "mismatch");
+	for (int f = 0; f < NUM_FNS; ++f) {
+		if (!any_selected || selected[f]) run(&fns[f], step, threads, scalar);
+	}
+	return 0;
+}
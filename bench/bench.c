@@ -1,15 +1,222 @@
+#define _GNU_SOURCE /* sched_setaffinity */
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <string.h>
 #include <math.h>
 #include <time.h>
 
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sched.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
 #include "fmath.h"
 
-static double now_time(void) {
+// Every case runs each of its variants (fmath, libm, ...) `warmup` times untimed, then
+// `reps` timed rounds with the variant order rotated per round, so no variant always
+// runs first on cold caches or second on warm ones. Reported: median, p10 and p90 of
+// wall time, ns/element and TSC cycles/element (reference cycles at the nominal clock,
+// not core cycles), on a thread pinned to one CPU. With --counters, hardware counters are
+// read around each timed run too and reported per element at their median.
+
+typedef struct bench_opts {
+	size_t n;
+	int reps;
+	int warmup;
+	int cpu;          /* CPU to pin to, -1 to leave affinity alone */
+	const char *json; /* JSON output path, "-" for stdout, NULL for none */
+	int counters;     /* collect hardware counters */
+	int sweep;        /* working-set sweep up to n instead of the cases at n */
+	int scaling;      /* thread scaling up to n instead of the cases at n */
+	int latency;      /* dependent scalar call chains instead of the cases */
+} bench_opts;
+
+// Buffers shared by all cases; out and out2 are faulted in once up front
+typedef struct bench_data {
+	float *in;
+	float *out;
+	float *out2; /* 2 * n floats */
+	float *scratch;
+	size_t n;
+	size_t scratch_n;
+} bench_data;
+
+typedef void (*bench_run)(const bench_data *d);
+
+typedef struct bench_variant {
+	const char *impl;
+	bench_run run;          /* one timed execution ... */
+	float (*scalar)(float); /* ... or, when run is NULL, a scalar loop calling this */
+} bench_variant;
+
+enum { BENCH_MAX_VARIANTS = 7 };
+
+typedef struct bench_case {
+	const char *name;
+	void (*fill)(float *arr, size_t n, float a, float b);
+	float lo, hi;
+	bench_variant variants[BENCH_MAX_VARIANTS]; /* up to the first with impl == NULL */
+	int baseline; /* variant whose median is subtracted from the others before ratios, or -1 */
+	int sweep_bytes; /* memory traffic per element of the first variant in --sweep, 0 to leave out */
+} bench_case;
+
+enum {
+	CTR_INSTRUCTIONS,
+	CTR_CYCLES, /* core cycles, unlike the TSC */
+	CTR_L1D_MISSES,
+	CTR_L2_MISSES,
+	CTR_BRANCH_MISSES,
+	BENCH_COUNTERS
+};
+
+static const char *const counter_names[BENCH_COUNTERS] = {"instructions", "core_cycles", "l1d_misses",
+                                                          "l2_misses", "branch_misses"};
+
+typedef struct bench_stats {
+	double median_ns;
+	double p10_ns;
+	double p90_ns;
+	double median_cycles;
+	double counters[BENCH_COUNTERS]; /* medians; < 0 when not collected */
+} bench_stats;
+
+static double now_ns(void) {
 	struct timespec ts;
 	clock_gettime(CLOCK_MONOTONIC, &ts);
-	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+	return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+// Serialized TSC read; 0 where there is no TSC
+static uint64_t read_tsc(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	_mm_lfence();
+	uint64_t t = __rdtsc();
+	_mm_lfence();
+	return t;
+#else
+	return 0;
+#endif
+}
+
+// Hardware counters through perf_event_open: one group on the calling thread, user mode
+// only, reset and enabled around each timed run. Events the CPU or kernel does not offer
+// (VMs without a virtual PMU, perf_event_paranoid > 2) are left out; pool workers of a
+// FMATH_ENABLE_THREADS build are not counted.
+typedef struct bench_counters {
+	int fd[BENCH_COUNTERS]; /* -1 when not open */
+	int leader;             /* first open fd, or -1 when none is */
+	int nr;                 /* open events, in enum order within the group read */
+} bench_counters;
+
+#if defined(__linux__)
+// L2 has no generic perf event; L2 demand misses use the raw event of the running CPU
+// family (Intel 0x3f24 L2_RQSTS.MISS, AMD 0x0864 L2 cache misses from L1 demand misses)
+// and fall back to last-level-cache misses elsewhere.
+static uint64_t l2_miss_raw_event(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	unsigned int eax, ebx, ecx, edx;
+	__asm__("cpuid" : "=a"(eax), "=b"(ebx), "=c"(ecx), "=d"(edx) : "a"(0));
+	if (ebx == 0x756e6547u) return 0x3f24; /* "GenuineIntel" */
+	if (ebx == 0x68747541u) return 0x0864; /* "AuthenticAMD" */
+#endif
+	return 0;
+}
+
+static int open_counter(int i, int group) {
+	struct perf_event_attr a;
+	memset(&a, 0, sizeof a);
+	a.size = sizeof a;
+	a.type = PERF_TYPE_HARDWARE;
+	a.disabled = group < 0;
+	a.exclude_kernel = 1;
+	a.exclude_hv = 1;
+	a.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+	switch (i) {
+	case CTR_INSTRUCTIONS: a.config = PERF_COUNT_HW_INSTRUCTIONS; break;
+	case CTR_CYCLES: a.config = PERF_COUNT_HW_CPU_CYCLES; break;
+	case CTR_L1D_MISSES:
+		a.type = PERF_TYPE_HW_CACHE;
+		a.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+		           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		break;
+	case CTR_L2_MISSES:
+		a.config = l2_miss_raw_event();
+		if (a.config) {
+			a.type = PERF_TYPE_RAW;
+		} else {
+			a.type = PERF_TYPE_HW_CACHE;
+			a.config = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+			           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+		}
+		break;
+	default: a.config = PERF_COUNT_HW_BRANCH_MISSES; break;
+	}
+	return (int)syscall(SYS_perf_event_open, &a, 0, -1, group, 0);
+}
+#endif
+
+// Returns the number of events opened
+static int counters_open(bench_counters *k) {
+	k->leader = -1;
+	k->nr = 0;
+	for (int i = 0; i < BENCH_COUNTERS; ++i) {
+		k->fd[i] = -1;
+#if defined(__linux__)
+		k->fd[i] = open_counter(i, k->leader);
+		if (k->fd[i] < 0) continue;
+		if (k->leader < 0) k->leader = k->fd[i];
+		++k->nr;
+#endif
+	}
+	return k->nr;
+}
+
+static void counters_close(bench_counters *k) {
+#if defined(__linux__)
+	for (int i = BENCH_COUNTERS - 1; i >= 0; --i) {
+		if (k->fd[i] >= 0) close(k->fd[i]);
+	}
+#endif
+	k->leader = -1;
+	k->nr = 0;
+}
+
+static void counters_start(const bench_counters *k) {
+#if defined(__linux__)
+	if (k->leader < 0) return;
+	ioctl(k->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(k->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#else
+	(void)k;
+#endif
+}
+
+// Stops the group and stores each event's count (scaled up if the kernel multiplexed
+// it), or -1 for events not open
+static void counters_stop(const bench_counters *k, double *values) {
+	for (int i = 0; i < BENCH_COUNTERS; ++i) values[i] = -1.0;
+#if defined(__linux__)
+	if (k->leader < 0) return;
+	ioctl(k->leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+	uint64_t buf[3 + BENCH_COUNTERS]; /* nr, time enabled, time running, values */
+	ssize_t got = read(k->leader, buf, sizeof buf);
+	if (got < (ssize_t)(sizeof(uint64_t) * 3) || buf[0] != (uint64_t)k->nr || buf[2] == 0) return;
+	double scale = (double)buf[1] / (double)buf[2];
+	for (int i = 0, slot = 0; i < BENCH_COUNTERS; ++i) {
+		if (k->fd[i] >= 0) values[i] = (double)buf[3 + slot++] * scale;
+	}
+#endif
 }
 
 static uint32_t rng_state = 0x12345678u;
@@ -39,6 +246,7 @@ static void fill_positive(float *arr, size_t n, float minv, float maxv) {
 	}
 }
 
+// Magnitudes in [min_abs, max_abs], either sign
 static void fill_nonzero(float *arr, size_t n, float min_abs, float max_abs) {
 	for (size_t i = 0; i < n; ++i) {
 		float v = randf_range(-max_abs, max_abs);
@@ -48,12 +256,6 @@ static void fill_nonzero(float *arr, size_t n, float min_abs, float max_abs) {
 	}
 }
 
-static double time_loop(float *dst, const float *src, size_t n, float (*fn)(float)) {
-	double t0 = now_time();
-	for (size_t i = 0; i < n; ++i) dst[i] = fn(src[i]);
-	return now_time() - t0;
-}
-
 static float rsqrt_libm(float x) {
 	if (x <= 0.0f) return NAN;
 	return 1.0f / sqrtf(x);
@@ -64,76 +266,921 @@ static float rcp_libm(float x) {
 	return 1.0f / x;
 }
 
+#define BENCH_ARRAY(name, array_fn) \
+	static void name(const bench_data *d) { \
+		array_fn(d->out, d->in, d->n); \
+	}
+
+BENCH_ARRAY(run_sin, fmath_sinf_array)
+BENCH_ARRAY(run_cos, fmath_cosf_array)
+BENCH_ARRAY(run_tan, fmath_tanf_array)
+BENCH_ARRAY(run_atan, fmath_atanf_array)
+BENCH_ARRAY(run_asin, fmath_asinf_array)
+BENCH_ARRAY(run_acos, fmath_acosf_array)
+BENCH_ARRAY(run_sinh, fmath_sinhf_array)
+BENCH_ARRAY(run_cosh, fmath_coshf_array)
+BENCH_ARRAY(run_tanh, fmath_tanhf_array)
+BENCH_ARRAY(run_exp, fmath_expf_array)
+BENCH_ARRAY(run_log, fmath_logf_array)
+BENCH_ARRAY(run_sqrt, fmath_sqrtf_array)
+BENCH_ARRAY(run_rsqrt, fmath_rsqrtf_array)
+BENCH_ARRAY(run_rcp, fmath_rcpf_array)
+
+#undef BENCH_ARRAY
+
+// The scalar API called in a loop: vectorized through the _ZGV* variants in an
+// out-of-line build, inlined with FMATH_INLINE_SCALAR
+#define BENCH_SCALAR(name, fn) \
+	static void name(const bench_data *d) { \
+		for (size_t i = 0; i < d->n; ++i) d->out[i] = fn(d->in[i]); \
+	}
+
+BENCH_SCALAR(run_sin_scalar, fmath_sinf)
+BENCH_SCALAR(run_cos_scalar, fmath_cosf)
+BENCH_SCALAR(run_tan_scalar, fmath_tanf)
+BENCH_SCALAR(run_atan_scalar, fmath_atanf)
+BENCH_SCALAR(run_asin_scalar, fmath_asinf)
+BENCH_SCALAR(run_acos_scalar, fmath_acosf)
+BENCH_SCALAR(run_sinh_scalar, fmath_sinhf)
+BENCH_SCALAR(run_cosh_scalar, fmath_coshf)
+BENCH_SCALAR(run_tanh_scalar, fmath_tanhf)
+BENCH_SCALAR(run_exp_scalar, fmath_expf)
+BENCH_SCALAR(run_log_scalar, fmath_logf)
+BENCH_SCALAR(run_sqrt_scalar, fmath_sqrtf)
+BENCH_SCALAR(run_rsqrt_scalar, fmath_rsqrtf)
+BENCH_SCALAR(run_rcp_scalar, fmath_rcpf)
+
+#undef BENCH_SCALAR
+
+// One precision tier, then back to the build default so the plain variants are unaffected
+#define BENCH_TIER(name, array_fn, fn, tier) \
+	static void name(const bench_data *d) { \
+		fmath_set_precision(fn, tier); \
+		array_fn(d->out, d->in, d->n); \
+		fmath_set_precision(fn, (fmath_precision)FMATH_PRECISION); \
+	}
+
+BENCH_TIER(run_tan_fast, fmath_tanf_array, FMATH_FN_TAN, FMATH_PRECISION_FAST)
+BENCH_TIER(run_tan_balanced, fmath_tanf_array, FMATH_FN_TAN, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_tan_accurate, fmath_tanf_array, FMATH_FN_TAN, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_atan_fast, fmath_atanf_array, FMATH_FN_ATAN, FMATH_PRECISION_FAST)
+BENCH_TIER(run_atan_balanced, fmath_atanf_array, FMATH_FN_ATAN, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_atan_accurate, fmath_atanf_array, FMATH_FN_ATAN, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_asin_fast, fmath_asinf_array, FMATH_FN_ASIN, FMATH_PRECISION_FAST)
+BENCH_TIER(run_asin_balanced, fmath_asinf_array, FMATH_FN_ASIN, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_asin_accurate, fmath_asinf_array, FMATH_FN_ASIN, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_tanh_fast, fmath_tanhf_array, FMATH_FN_TANH, FMATH_PRECISION_FAST)
+BENCH_TIER(run_tanh_balanced, fmath_tanhf_array, FMATH_FN_TANH, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_tanh_accurate, fmath_tanhf_array, FMATH_FN_TANH, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_exp_fast, fmath_expf_array, FMATH_FN_EXP, FMATH_PRECISION_FAST)
+BENCH_TIER(run_exp_balanced, fmath_expf_array, FMATH_FN_EXP, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_exp_accurate, fmath_expf_array, FMATH_FN_EXP, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_log_fast, fmath_logf_array, FMATH_FN_LOG, FMATH_PRECISION_FAST)
+BENCH_TIER(run_log_balanced, fmath_logf_array, FMATH_FN_LOG, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_log_accurate, fmath_logf_array, FMATH_FN_LOG, FMATH_PRECISION_ACCURATE)
+BENCH_TIER(run_sqrt_fast, fmath_sqrtf_array, FMATH_FN_SQRT, FMATH_PRECISION_FAST)
+BENCH_TIER(run_sqrt_balanced, fmath_sqrtf_array, FMATH_FN_SQRT, FMATH_PRECISION_BALANCED)
+BENCH_TIER(run_sqrt_accurate, fmath_sqrtf_array, FMATH_FN_SQRT, FMATH_PRECISION_ACCURATE)
+
+#undef BENCH_TIER
+
+static void run_sincos(const bench_data *d) {
+	fmath_sincosf_array(d->out, d->out2, d->in, d->n);
+}
+
+static void run_cis(const bench_data *d) {
+	fmath_cisf_array(d->out2, d->in, d->n);
+}
+
+static void run_sin_and_cos(const bench_data *d) {
+	fmath_sinf_array(d->out, d->in, d->n);
+	fmath_cosf_array(d->out2, d->in, d->n);
+}
+
+// atan2 of neighbouring inputs: y = in[i], x = in[i + 1]
+static void run_atan2(const bench_data *d) {
+	fmath_atan2f_array(d->out, d->in, d->in + 1, d->n - 1);
+}
+
+static void run_atan2_tier(const bench_data *d, fmath_precision tier) {
+	fmath_set_precision(FMATH_FN_ATAN, tier);
+	run_atan2(d);
+	fmath_set_precision(FMATH_FN_ATAN, (fmath_precision)FMATH_PRECISION);
+}
+
+static void run_atan2_fast(const bench_data *d) {
+	run_atan2_tier(d, FMATH_PRECISION_FAST);
+}
+
+static void run_atan2_balanced(const bench_data *d) {
+	run_atan2_tier(d, FMATH_PRECISION_BALANCED);
+}
+
+static void run_atan2_accurate(const bench_data *d) {
+	run_atan2_tier(d, FMATH_PRECISION_ACCURATE);
+}
+
+static void run_atan2_scalar(const bench_data *d) {
+	for (size_t i = 0; i + 1 < d->n; ++i) d->out[i] = fmath_atan2f(d->in[i], d->in[i + 1]);
+}
+
+static float (*volatile libm_atan2f)(float, float) = atan2f;
+
+static void run_atan2_libm(const bench_data *d) {
+	float (*f)(float, float) = libm_atan2f;
+	for (size_t i = 0; i + 1 < d->n; ++i) d->out[i] = f(d->in[i], d->in[i + 1]);
+}
+
+// tan the way it is done without fmath_tanf: fused sin/cos, then a division
+static void run_tan_sincos(const bench_data *d) {
+	fmath_sincosf_array(d->out, d->out2, d->in, d->n);
+	for (size_t i = 0; i < d->n; ++i) d->out[i] /= d->out2[i];
+}
+
+// tanh the way it is done without fmath_tanhf: e^2x from the exp kernel, then a division
+static void run_tanh_exp(const bench_data *d) {
+	for (size_t i = 0; i < d->n; ++i) d->out2[i] = 2.0f * d->in[i];
+	fmath_expf_array(d->out, d->out2, d->n);
+	for (size_t i = 0; i < d->n; ++i) d->out[i] = (d->out[i] - 1.0f) / (d->out[i] + 1.0f);
+}
+
+// libm through pointers the compiler cannot see through, so it neither vectorizes the
+// loops into libmvec calls nor fuses sinf + cosf into sincosf: plain scalar libm
+static float (*volatile libm_sinf)(float) = sinf;
+static float (*volatile libm_cosf)(float) = cosf;
+
+static void run_sincos_libm(const bench_data *d) {
+	float (*s)(float) = libm_sinf, (*c)(float) = libm_cosf;
+	for (size_t i = 0; i < d->n; ++i) {
+		d->out[i] = s(d->in[i]);
+		d->out2[i] = c(d->in[i]);
+	}
+}
+
+// Short batches interleaved with a sweep over an L1D-sized buffer, so the sin LUT is
+// evicted and re-fetched every batch; the sweep-only variant is the baseline.
+enum { L1_BATCH = 256 };
+
+static void l1_sweep(const bench_data *d) {
+	for (size_t k = 0; k < d->scratch_n; k += 16) d->scratch[k] += 1.0f;
+}
+
+static void run_l1_sweep(const bench_data *d) {
+	for (size_t i = 0; i < d->n; i += L1_BATCH) l1_sweep(d);
+}
+
+static void run_l1_sin(const bench_data *d) {
+	for (size_t i = 0; i < d->n; i += L1_BATCH) {
+		fmath_sinf_array(d->out + i, d->in + i, d->n - i < L1_BATCH ? d->n - i : L1_BATCH);
+		l1_sweep(d);
+	}
+}
+
+static void run_l1_sin_libm(const bench_data *d) {
+	float (*s)(float) = libm_sinf;
+	for (size_t i = 0; i < d->n; i += L1_BATCH) {
+		size_t end = d->n - i < L1_BATCH ? d->n : i + L1_BATCH;
+		for (size_t k = i; k < end; ++k) d->out[k] = s(d->in[k]);
+		l1_sweep(d);
+	}
+}
+
+// Compare the L1 case across builds with/without FMATH_SIN_LUT_QUARTER or FMATH_SIN_HERMITE
+#if FMATH_SIN_HERMITE
+#define BENCH_L1_NAME "sin (L1 pressure, cubic Hermite)"
+#elif FMATH_SIN_LUT_QUARTER
+#define BENCH_L1_NAME "sin (L1 pressure, quarter-wave)"
+#else
+#define BENCH_L1_NAME "sin (L1 pressure)"
+#endif
+
+static const bench_case bench_cases[] = {
+	{"sin", fill_range, -1000.0f, 1000.0f,
+	 {{"fmath", run_sin, NULL}, {"scalar loop", run_sin_scalar, NULL}, {"libm", NULL, sinf}}, -1, 8},
+	{"cos", fill_range, -1000.0f, 1000.0f,
+	 {{"fmath", run_cos, NULL}, {"scalar loop", run_cos_scalar, NULL}, {"libm", NULL, cosf}}, -1, 8},
+	{"sin (|x| <= 1e10)", fill_range, -1e10f, 1e10f, {{"fmath", run_sin, NULL}, {"libm", NULL, sinf}}, -1, 0},
+	{"tan", fill_range, -1000.0f, 1000.0f,
+	 {{"fmath", run_tan, NULL}, {"fast", run_tan_fast, NULL}, {"balanced", run_tan_balanced, NULL},
+	  {"accurate", run_tan_accurate, NULL}, {"sin/cos", run_tan_sincos, NULL}, {"scalar loop", run_tan_scalar, NULL},
+	  {"libm", NULL, tanf}},
+	 -1, 8},
+	{"atan", fill_range, -100.0f, 100.0f,
+	 {{"fmath", run_atan, NULL}, {"fast", run_atan_fast, NULL}, {"balanced", run_atan_balanced, NULL},
+	  {"accurate", run_atan_accurate, NULL}, {"scalar loop", run_atan_scalar, NULL}, {"libm", NULL, atanf}},
+	 -1, 8},
+	{"atan2", fill_range, -100.0f, 100.0f,
+	 {{"fmath", run_atan2, NULL}, {"fast", run_atan2_fast, NULL}, {"balanced", run_atan2_balanced, NULL},
+	  {"accurate", run_atan2_accurate, NULL}, {"scalar loop", run_atan2_scalar, NULL},
+	  {"libm", run_atan2_libm, NULL}},
+	 -1, 8},
+	{"asin", fill_range, -1.0f, 1.0f,
+	 {{"fmath", run_asin, NULL}, {"fast", run_asin_fast, NULL}, {"balanced", run_asin_balanced, NULL},
+	  {"accurate", run_asin_accurate, NULL}, {"scalar loop", run_asin_scalar, NULL}, {"libm", NULL, asinf}},
+	 -1, 8},
+	{"acos", fill_range, -1.0f, 1.0f,
+	 {{"fmath", run_acos, NULL}, {"scalar loop", run_acos_scalar, NULL}, {"libm", NULL, acosf}}, -1, 8},
+	{"exp", fill_range, -10.0f, 10.0f,
+	 {{"fmath", run_exp, NULL}, {"fast", run_exp_fast, NULL}, {"balanced", run_exp_balanced, NULL},
+	  {"accurate", run_exp_accurate, NULL}, {"scalar loop", run_exp_scalar, NULL}, {"libm", NULL, expf}},
+	 -1, 8},
+	{"tanh", fill_range, -10.0f, 10.0f,
+	 {{"fmath", run_tanh, NULL}, {"fast", run_tanh_fast, NULL}, {"balanced", run_tanh_balanced, NULL},
+	  {"accurate", run_tanh_accurate, NULL}, {"exp formula", run_tanh_exp, NULL}, {"scalar loop", run_tanh_scalar, NULL},
+	  {"libm", NULL, tanhf}},
+	 -1, 8},
+	{"sinh", fill_range, -10.0f, 10.0f,
+	 {{"fmath", run_sinh, NULL}, {"scalar loop", run_sinh_scalar, NULL}, {"libm", NULL, sinhf}}, -1, 8},
+	{"cosh", fill_range, -10.0f, 10.0f,
+	 {{"fmath", run_cosh, NULL}, {"scalar loop", run_cosh_scalar, NULL}, {"libm", NULL, coshf}}, -1, 8},
+	{"log", fill_positive, 1e-6f, 1e6f,
+	 {{"fmath", run_log, NULL}, {"fast", run_log_fast, NULL}, {"balanced", run_log_balanced, NULL},
+	  {"accurate", run_log_accurate, NULL}, {"scalar loop", run_log_scalar, NULL}, {"libm", NULL, logf}},
+	 -1, 8},
+	{"sqrt", fill_positive, 1e-6f, 1e6f,
+	 {{"fmath", run_sqrt, NULL}, {"fast", run_sqrt_fast, NULL}, {"balanced", run_sqrt_balanced, NULL},
+	  {"accurate", run_sqrt_accurate, NULL}, {"scalar loop", run_sqrt_scalar, NULL}, {"libm", NULL, sqrtf}},
+	 -1, 8},
+	{"rsqrt", fill_positive, 1e-6f, 1e6f,
+	 {{"fmath", run_rsqrt, NULL}, {"scalar loop", run_rsqrt_scalar, NULL}, {"libm", NULL, rsqrt_libm}}, -1, 8},
+	{"rcp", fill_nonzero, 1e-3f, 1e6f,
+	 {{"fmath", run_rcp, NULL}, {"scalar loop", run_rcp_scalar, NULL}, {"libm", NULL, rcp_libm}}, -1, 8},
+	{"sincos", fill_range, -1000.0f, 1000.0f,
+	 {{"fmath", run_sincos, NULL}, {"interleaved", run_cis, NULL}, {"sin+cos", run_sin_and_cos, NULL},
+	  {"libm", run_sincos_libm, NULL}},
+	 -1, 12},
+	{BENCH_L1_NAME, fill_range, -1000.0f, 1000.0f,
+	 {{"fmath", run_l1_sin, NULL}, {"libm", run_l1_sin_libm, NULL}, {"sweep only", run_l1_sweep, NULL}}, 2, 0},
+};
+
+static void run_variant(const bench_variant *v, const bench_data *d) {
+	if (v->run) {
+		v->run(d);
+		return;
+	}
+	float (*fn)(float) = v->scalar; /* through the pointer: plain scalar libm calls, as above */
+	for (size_t i = 0; i < d->n; ++i) d->out[i] = fn(d->in[i]);
+}
+
+static int cmp_double(const void *a, const void *b) {
+	double x = *(const double *)a, y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+// Nearest-rank percentile of sorted[0..count)
+static double percentile(const double *sorted, int count, double p) {
+	int k = (int)(p * (double)(count - 1) + 0.5);
+	return sorted[k];
+}
+
+static int variant_count(const bench_case *c) {
+	int nv = 0;
+	while (nv < BENCH_MAX_VARIANTS && c->variants[nv].impl) ++nv;
+	return nv;
+}
+
+// Warmup, then reps rounds in rotating variant order
+static void measure_case(const bench_case *c, const bench_data *d, const bench_opts *o, const bench_counters *k,
+                         bench_stats *stats) {
+	int nv = variant_count(c);
+	double *ns = (double *)malloc(sizeof(double) * (size_t)(nv * o->reps));
+	double *cyc = (double *)malloc(sizeof(double) * (size_t)(nv * o->reps));
+	double *ctr = (double *)malloc(sizeof(double) * (size_t)(nv * o->reps * BENCH_COUNTERS));
+	if (!ns || !cyc || !ctr) {
+		fprintf(stderr, "allocation failed\n");
+		exit(1);
+	}
+	c->fill(d->in, d->n, c->lo, c->hi);
+	for (int w = 0; w < o->warmup; ++w) {
+		for (int v = 0; v < nv; ++v) run_variant(&c->variants[v], d);
+	}
+	for (int r = 0; r < o->reps; ++r) {
+		for (int j = 0; j < nv; ++j) {
+			int v = (r + j) % nv;
+			counters_start(k);
+			double t0 = now_ns();
+			uint64_t c0 = read_tsc();
+			run_variant(&c->variants[v], d);
+			uint64_t c1 = read_tsc();
+			double t1 = now_ns();
+			double values[BENCH_COUNTERS];
+			counters_stop(k, values);
+			ns[v * o->reps + r] = t1 - t0;
+			cyc[v * o->reps + r] = (double)(c1 - c0);
+			for (int i = 0; i < BENCH_COUNTERS; ++i) ctr[(i * nv + v) * o->reps + r] = values[i];
+		}
+	}
+	for (int v = 0; v < nv; ++v) {
+		double *s = ns + v * o->reps, *cs = cyc + v * o->reps;
+		qsort(s, (size_t)o->reps, sizeof(double), cmp_double);
+		qsort(cs, (size_t)o->reps, sizeof(double), cmp_double);
+		stats[v].median_ns = percentile(s, o->reps, 0.5);
+		stats[v].p10_ns = percentile(s, o->reps, 0.1);
+		stats[v].p90_ns = percentile(s, o->reps, 0.9);
+		stats[v].median_cycles = percentile(cs, o->reps, 0.5);
+		for (int i = 0; i < BENCH_COUNTERS; ++i) {
+			double *e = ctr + (i * nv + v) * o->reps;
+			qsort(e, (size_t)o->reps, sizeof(double), cmp_double);
+			stats[v].counters[i] = percentile(e, o->reps, 0.5);
+		}
+	}
+	free(ns);
+	free(cyc);
+	free(ctr);
+}
+
+// libm median over this variant's, both less the baseline if the case has one; 0 without libm
+static double speedup(const bench_case *c, const bench_stats *stats, int v) {
+	int nv = variant_count(c), libm = -1;
+	for (int k = 0; k < nv; ++k) {
+		if (strcmp(c->variants[k].impl, "libm") == 0) libm = k;
+	}
+	if (libm < 0 || v == c->baseline) return 0.0;
+	double base = c->baseline >= 0 ? stats[c->baseline].median_ns : 0.0;
+	double t = stats[v].median_ns - base;
+	return t > 0.0 ? (stats[libm].median_ns - base) / t : 0.0;
+}
+
+// Pins the calling thread to `cpu`, or to the first CPU it may run on when cpu is -2;
+// returns the CPU or -1
+static int pin_thread(int cpu) {
+#if defined(__linux__)
+	cpu_set_t set;
+	if (cpu == -2) {
+		if (sched_getaffinity(0, sizeof set, &set) != 0) return -1;
+		for (cpu = 0; cpu < CPU_SETSIZE && !CPU_ISSET((size_t)cpu, &set); ++cpu) {
+		}
+		if (cpu == CPU_SETSIZE) return -1;
+	}
+	if (cpu < 0) return -1;
+	CPU_ZERO(&set);
+	CPU_SET((size_t)cpu, &set);
+	return sched_setaffinity(0, sizeof set, &set) == 0 ? cpu : -1;
+#else
+	(void)cpu;
+	return -1;
+#endif
+}
+
+static const char *isa_name(fmath_isa isa) {
+	static const char *const names[] = {"scalar", "sse4.1", "avx2", "avx512"};
+	return names[isa];
+}
+
+// Instructions and IPC per element, misses per 1000 elements; "-" for events not collected
+static void print_counters(FILE *f, const bench_stats *s, double per) {
+	const double *k = s->counters;
+	char col[BENCH_COUNTERS][16];
+	for (int i = 0; i < BENCH_COUNTERS; ++i) snprintf(col[i], sizeof col[i], "-");
+	if (k[CTR_INSTRUCTIONS] >= 0.0) snprintf(col[0], sizeof col[0], "%.2f", k[CTR_INSTRUCTIONS] * per);
+	if (k[CTR_INSTRUCTIONS] >= 0.0 && k[CTR_CYCLES] > 0.0) {
+		snprintf(col[1], sizeof col[1], "%.2f", k[CTR_INSTRUCTIONS] / k[CTR_CYCLES]);
+	}
+	for (int i = CTR_L1D_MISSES; i < BENCH_COUNTERS; ++i) {
+		if (k[i] >= 0.0) snprintf(col[i], sizeof col[i], "%.2f", k[i] * per * 1000.0);
+	}
+	fprintf(f, " %9s %6s %9s %9s %9s", col[0], col[1], col[2], col[3], col[4]);
+}
+
+static void json_counters(FILE *f, const bench_stats *s, double per) {
+	for (int i = 0; i < BENCH_COUNTERS; ++i) {
+		if (s->counters[i] >= 0.0) {
+			fprintf(f, ", \"%s_per_elem\": %.5f", counter_names[i], s->counters[i] * per);
+		} else {
+			fprintf(f, ", \"%s_per_elem\": null", counter_names[i]);
+		}
+	}
+}
+
+// --sweep: the first variant of every case with sweep_bytes, at power-of-two sizes from
+// SWEEP_MIN elements up to the largest, so each kernel is seen from L1-resident to
+// DRAM-bound. Small sizes repeat the call on the same buffer until a sample covers
+// SWEEP_SAMPLE elements.
+enum { SWEEP_MIN = 256, SWEEP_SAMPLE = 1 << 22 };
+
+#define SWEEP_DEFAULT_MAX ((size_t)256 * 1024 * 1024)
+
+typedef struct cache_sizes {
+	size_t l1, l2, l3;
+} cache_sizes;
+
+static size_t cache_size(int name, size_t fallback) {
+	long v = name >= 0 ? sysconf(name) : -1;
+	return v > 0 ? (size_t)v : fallback;
+}
+
+static cache_sizes detect_caches(void) {
+	cache_sizes c = {(size_t)32 << 10, (size_t)1 << 20, (size_t)32 << 20};
+#if defined(_SC_LEVEL1_DCACHE_SIZE) && defined(_SC_LEVEL2_CACHE_SIZE) && defined(_SC_LEVEL3_CACHE_SIZE)
+	c.l1 = cache_size(_SC_LEVEL1_DCACHE_SIZE, c.l1);
+	c.l2 = cache_size(_SC_LEVEL2_CACHE_SIZE, c.l2);
+	c.l3 = cache_size(_SC_LEVEL3_CACHE_SIZE, c.l3);
+#else
+	(void)cache_size;
+#endif
+	return c;
+}
+
+static const char *const regime_names[] = {"L1", "L2", "L3", "DRAM"};
+
+// Smallest cache level holding the working set (the LUTs come on top of it)
+static int regime(const cache_sizes *c, size_t bytes) {
+	return bytes <= c->l1 ? 0 : bytes <= c->l2 ? 1 : bytes <= c->l3 ? 2 : 3;
+}
+
+static void measure_sweep(bench_run run, const bench_data *d, const bench_opts *o, bench_stats *stats) {
+	size_t calls = d->n >= SWEEP_SAMPLE ? 1 : SWEEP_SAMPLE / d->n;
+	double *ns = (double *)malloc(sizeof(double) * (size_t)o->reps);
+	if (!ns) {
+		fprintf(stderr, "allocation failed\n");
+		exit(1);
+	}
+	for (int w = 0; w < o->warmup; ++w) run(d);
+	for (int r = 0; r < o->reps; ++r) {
+		double t0 = now_ns();
+		for (size_t k = 0; k < calls; ++k) run(d);
+		ns[r] = (now_ns() - t0) / (double)calls;
+	}
+	qsort(ns, (size_t)o->reps, sizeof(double), cmp_double);
+	memset(stats, 0, sizeof *stats);
+	stats->median_ns = percentile(ns, o->reps, 0.5);
+	stats->p10_ns = percentile(ns, o->reps, 0.1);
+	stats->p90_ns = percentile(ns, o->reps, 0.9);
+	free(ns);
+}
+
+static void run_sweep(const bench_opts *o, const bench_data *d, FILE *text, FILE *json) {
+	cache_sizes caches = detect_caches();
+	fprintf(text, "caches: L1D %zu KiB, L2 %zu KiB, L3 %zu KiB\n", caches.l1 >> 10, caches.l2 >> 10, caches.l3 >> 10);
+	fprintf(text, "%-8s %11s %12s %-6s %9s %9s %9s %9s\n", "fn", "n", "bytes", "regime", "ns/elem", "p10", "p90",
+	        "GB/s");
+	if (json) {
+		fprintf(json, "  \"caches\": {\"l1d\": %zu, \"l2\": %zu, \"l3\": %zu},\n  \"results\": [", caches.l1,
+		        caches.l2, caches.l3);
+	}
+
+	int first = 1;
+	size_t ncases = sizeof bench_cases / sizeof bench_cases[0];
+	for (size_t ci = 0; ci < ncases; ++ci) {
+		const bench_case *c = &bench_cases[ci];
+		if (!c->sweep_bytes) continue;
+		c->fill(d->in, d->n, c->lo, c->hi);
+		double sum[4] = {0}, best_gbs[4] = {0};
+		int points[4] = {0};
+		for (size_t n = SWEEP_MIN; n <= d->n; n *= 2) {
+			bench_data view = *d;
+			view.n = n;
+			bench_stats s;
+			measure_sweep(c->variants[0].run, &view, o, &s);
+			size_t bytes = n * (size_t)c->sweep_bytes;
+			int g = regime(&caches, bytes);
+			double per = s.median_ns / (double)n, gbs = (double)bytes / s.median_ns;
+			sum[g] += per;
+			++points[g];
+			if (gbs > best_gbs[g]) best_gbs[g] = gbs;
+			fprintf(text, "%-8s %11zu %12zu %-6s %9.3f %9.3f %9.3f %9.2f\n", c->name, n, bytes, regime_names[g], per,
+			        s.p10_ns / (double)n, s.p90_ns / (double)n, gbs);
+			if (json) {
+				fprintf(json,
+				        "%s\n    {\"case\": \"%s\", \"n\": %zu, \"bytes\": %zu, \"regime\": \"%s\", \"median_ns\": %.0f, "
+				        "\"p10_ns\": %.0f, \"p90_ns\": %.0f, \"ns_per_elem\": %.4f, \"gb_per_s\": %.3f}",
+				        first ? "" : ",", c->name, n, bytes, regime_names[g], s.median_ns, s.p10_ns, s.p90_ns, per, gbs);
+				first = 0;
+			}
+		}
+		fprintf(text, "%-8s per regime:", c->name);
+		for (int g = 0; g < 4; ++g) {
+			if (points[g]) {
+				fprintf(text, "  %s %.3f ns/elem, %.2f GB/s", regime_names[g], sum[g] / points[g], best_gbs[g]);
+			}
+		}
+		fprintf(text, " (mean ns/elem, best GB/s)\n\n");
+		fflush(text);
+	}
+	if (json) fprintf(json, "\n  ]\n}\n");
+}
+
+// --scaling: the same array functions on 1..N pool threads (powers of two and N) at
+// sizes from SCALING_MIN (two pool blocks) up to n, with the parallel threshold at 0 so
+// every size goes through the pool. A size pays off for a function when the best
+// multi-threaded run is at least SCALING_GAIN times faster than one thread there and at
+// every larger size; the suggested threshold is the largest such break-even over all
+// functions, so none gets slower by going parallel.
+enum { SCALING_MIN = 8192, SCALING_MAX_COUNTS = 16, SCALING_MAX_SIZES = 24 };
+
+#define SCALING_GAIN 1.1
+
+static int run_scaling(const bench_opts *o, const bench_data *d, FILE *text, FILE *json) {
+	int max_threads = fmath_set_threads(0);
+	if (max_threads < 2) {
+		fprintf(stderr, "--scaling: one thread available; build with -pthread -DFMATH_ENABLE_THREADS=1 and run "
+		                "on more than one CPU\n");
+		return 1;
+	}
+	int counts[SCALING_MAX_COUNTS], nt = 0;
+	for (int t = 1; t < max_threads && nt < SCALING_MAX_COUNTS - 1; t *= 2) counts[nt++] = t;
+	counts[nt++] = max_threads;
+	size_t sizes[SCALING_MAX_SIZES];
+	int ns = 0;
+	for (size_t n = SCALING_MIN; n <= d->n && ns < SCALING_MAX_SIZES; n *= 4) sizes[ns++] = n;
+	if (ns == 0) {
+		fprintf(stderr, "--scaling: n must be at least %d\n", SCALING_MIN);
+		return 1;
+	}
+
+	size_t ncases = sizeof bench_cases / sizeof bench_cases[0];
+	double *ns_elem = (double *)calloc(ncases * (size_t)(nt * ns), sizeof(double)); /* [case][count][size] */
+	if (!ns_elem) {
+		fprintf(stderr, "allocation failed\n");
+		exit(1);
+	}
+	size_t threshold = fmath_get_parallel_threshold();
+	fmath_set_parallel_threshold(0);
+	// Thread count outermost: changing it restarts the pool
+	for (int ti = 0; ti < nt; ++ti) {
+		fmath_set_threads(counts[ti]);
+		for (size_t ci = 0; ci < ncases; ++ci) {
+			const bench_case *c = &bench_cases[ci];
+			if (!c->sweep_bytes) continue;
+			c->fill(d->in, d->n, c->lo, c->hi);
+			for (int si = 0; si < ns; ++si) {
+				bench_data view = *d;
+				view.n = sizes[si];
+				bench_stats st;
+				measure_sweep(c->variants[0].run, &view, o, &st);
+				ns_elem[(ci * (size_t)nt + (size_t)ti) * (size_t)ns + (size_t)si] = st.median_ns / (double)sizes[si];
+			}
+		}
+	}
+	fmath_set_threads(max_threads);
+	fmath_set_parallel_threshold(threshold);
+
+	if (json) fprintf(json, "  \"threads_tested\": %d,\n  \"results\": [", max_threads);
+	int first = 1;
+	size_t suggested = 0;
+	for (size_t ci = 0; ci < ncases; ++ci) {
+		const bench_case *c = &bench_cases[ci];
+		if (!c->sweep_bytes) continue;
+		const double *t_ci = ns_elem + ci * (size_t)nt * (size_t)ns;
+		fprintf(text, "%-8s %10s %10s", c->name, "n", "1T ns/el");
+		for (int ti = 1; ti < nt; ++ti) fprintf(text, "   %3dT x/eff", counts[ti]);
+		fprintf(text, "\n");
+		size_t break_even = 0; /* 0: no size pays off */
+		for (int si = 0; si < ns; ++si) {
+			double single = t_ci[si], best = 0.0;
+			fprintf(text, "%-8s %10zu %10.3f", "", sizes[si], single);
+			for (int ti = 0; ti < nt; ++ti) {
+				double sp = single / t_ci[ti * ns + si], eff = sp / counts[ti];
+				if (sp > best) best = sp;
+				if (ti) fprintf(text, "  %5.2fx %3.0f%%", sp, eff * 100.0);
+				if (json) {
+					fprintf(json,
+					        "%s\n    {\"case\": \"%s\", \"n\": %zu, \"threads\": %d, \"ns_per_elem\": %.4f, "
+					        "\"speedup\": %.3f, \"efficiency\": %.3f}",
+					        first ? "" : ",", c->name, sizes[si], counts[ti], t_ci[ti * ns + si], sp, eff);
+					first = 0;
+				}
+			}
+			fprintf(text, "\n");
+			if (best < SCALING_GAIN) {
+				break_even = 0;
+			} else if (!break_even) {
+				break_even = sizes[si];
+			}
+		}
+		if (break_even) {
+			fprintf(text, "%-8s pays off from n = %zu\n\n", c->name, break_even);
+			if (break_even > suggested) suggested = break_even;
+		} else {
+			fprintf(text, "%-8s no size up to %zu pays off\n\n", c->name, sizes[ns - 1]);
+			suggested = (size_t)-1;
+		}
+		fflush(text);
+	}
+	if (suggested == (size_t)-1) {
+		fprintf(text, "suggested parallel threshold: above %zu (some function never pays off)\n", sizes[ns - 1]);
+	} else {
+		fprintf(text, "suggested parallel threshold: %zu (current %zu; -DFMATH_PARALLEL_THRESHOLD or "
+		              "fmath_set_parallel_threshold)\n",
+		        suggested, threshold);
+	}
+	if (json) {
+		fprintf(json, "\n  ],\n  \"suggested_threshold\": ");
+		if (suggested == (size_t)-1) {
+			fprintf(json, "null\n}\n");
+		} else {
+			fprintf(json, "%zu\n}\n", suggested);
+		}
+	}
+	free(ns_elem);
+	return 0;
+}
+
+// --latency: each scalar function in a dependent chain x = f(x) + c, so every call waits
+// for the previous result, as in iterative solvers. Calls are real calls (fmath's into the
+// library, libm's through the PLT); each step also pays one dependent add. c keeps x in a
+// fixed range. n is the chain length. Where |f'| >= 1 (tan, asin, acos, sinh) no c has a
+// stable fixed point, so those chains use x = f(x) * m + c, one FMA under -march with FMA.
+
+#define BENCH_CHAIN(name, fn, c) \
+	static float name(float x, size_t n) { \
+		for (size_t i = 0; i < n; ++i) x = fn(x) + (c); \
+		return x; \
+	}
+
+#define BENCH_CHAIN_SCALED(name, fn, m, c) \
+	static float name(float x, size_t n) { \
+		for (size_t i = 0; i < n; ++i) x = fn(x) * (m) + (c); \
+		return x; \
+	}
+
+// atan2 chains run in y with x fixed at 1/2, so |y| > |x| takes the reflected octant
+static float atan2_half(float y) {
+	return fmath_atan2f(y, 0.5f);
+}
+
+static float atan2_half_libm(float y) {
+	return atan2f(y, 0.5f);
+}
+
+BENCH_CHAIN(chain_sin, fmath_sinf, 1.0f)
+BENCH_CHAIN(chain_sin_libm, sinf, 1.0f)
+BENCH_CHAIN(chain_cos, fmath_cosf, 1.0f)
+BENCH_CHAIN(chain_cos_libm, cosf, 1.0f)
+BENCH_CHAIN(chain_exp, fmath_expf, -1.5f) /* x in [-1.5, -0.5] */
+BENCH_CHAIN(chain_exp_libm, expf, -1.5f)
+BENCH_CHAIN(chain_log, fmath_logf, 2.0f) /* x in [2, 3.1] */
+BENCH_CHAIN(chain_log_libm, logf, 2.0f)
+BENCH_CHAIN(chain_sqrt, fmath_sqrtf, 1.0f)
+BENCH_CHAIN(chain_sqrt_libm, sqrtf, 1.0f)
+BENCH_CHAIN(chain_rsqrt, fmath_rsqrtf, 1.0f)
+BENCH_CHAIN(chain_rsqrt_libm, rsqrt_libm, 1.0f)
+BENCH_CHAIN(chain_rcp, fmath_rcpf, 1.0f)
+BENCH_CHAIN(chain_rcp_libm, rcp_libm, 1.0f)
+BENCH_CHAIN_SCALED(chain_tan, fmath_tanf, -0.5f, 0.5f) /* x in [0.22, 0.39] */
+BENCH_CHAIN_SCALED(chain_tan_libm, tanf, -0.5f, 0.5f)
+BENCH_CHAIN(chain_atan, fmath_atanf, 1.0f) /* x in [1.4, 2.2] */
+BENCH_CHAIN(chain_atan_libm, atanf, 1.0f)
+BENCH_CHAIN(chain_atan2, atan2_half, 1.0f) /* y in [1.7, 2.4] */
+BENCH_CHAIN(chain_atan2_libm, atan2_half_libm, 1.0f)
+BENCH_CHAIN_SCALED(chain_asin, fmath_asinf, -0.5f, 0.2f) /* x in [-0.07, 0.24] */
+BENCH_CHAIN_SCALED(chain_asin_libm, asinf, -0.5f, 0.2f)
+BENCH_CHAIN_SCALED(chain_acos, fmath_acosf, 0.5f, -0.6f) /* x in [-0.08, 0.23] */
+BENCH_CHAIN_SCALED(chain_acos_libm, acosf, 0.5f, -0.6f)
+BENCH_CHAIN_SCALED(chain_sinh, fmath_sinhf, -0.5f, 0.5f) /* x in [0.23, 0.39] */
+BENCH_CHAIN_SCALED(chain_sinh_libm, sinhf, -0.5f, 0.5f)
+BENCH_CHAIN(chain_cosh, fmath_coshf, -1.5f) /* x in [-0.44, -0.37] */
+BENCH_CHAIN(chain_cosh_libm, coshf, -1.5f)
+BENCH_CHAIN(chain_tanh, fmath_tanhf, 0.5f) /* x in [0.96, 1.39] */
+BENCH_CHAIN(chain_tanh_libm, tanhf, 0.5f)
+
+#undef BENCH_CHAIN
+#undef BENCH_CHAIN_SCALED
+
+typedef struct bench_chain {
+	const char *name;
+	float (*fmath)(float x, size_t n);
+	float (*libm)(float x, size_t n);
+	float x0;
+} bench_chain;
+
+static const bench_chain bench_chains[] = {
+	{"sin", chain_sin, chain_sin_libm, 0.5f},     {"cos", chain_cos, chain_cos_libm, 0.5f},
+	{"exp", chain_exp, chain_exp_libm, -1.0f},    {"log", chain_log, chain_log_libm, 2.5f},
+	{"sqrt", chain_sqrt, chain_sqrt_libm, 2.0f},  {"rsqrt", chain_rsqrt, chain_rsqrt_libm, 2.0f},
+	{"rcp", chain_rcp, chain_rcp_libm, 2.0f},     {"tan", chain_tan, chain_tan_libm, 0.5f},
+	{"atan", chain_atan, chain_atan_libm, 0.5f},  {"atan2", chain_atan2, chain_atan2_libm, 0.5f},
+	{"asin", chain_asin, chain_asin_libm, 0.5f},  {"acos", chain_acos, chain_acos_libm, 0.5f},
+	{"sinh", chain_sinh, chain_sinh_libm, 0.5f},  {"cosh", chain_cosh, chain_cosh_libm, 0.5f},
+	{"tanh", chain_tanh, chain_tanh_libm, 0.5f},
+};
+
+static volatile float chain_sink;
+
+static void measure_chain(float (*chain)(float x, size_t n), float x0, const bench_opts *o, bench_stats *stats) {
+	double calls = (double)o->n;
+	double *ns = (double *)malloc(sizeof(double) * (size_t)o->reps);
+	double *cyc = (double *)malloc(sizeof(double) * (size_t)o->reps);
+	if (!ns || !cyc) {
+		fprintf(stderr, "allocation failed\n");
+		exit(1);
+	}
+	for (int w = 0; w < o->warmup; ++w) chain_sink = chain(x0, o->n);
+	for (int r = 0; r < o->reps; ++r) {
+		double t0 = now_ns();
+		uint64_t c0 = read_tsc();
+		chain_sink = chain(x0, o->n);
+		uint64_t c1 = read_tsc();
+		ns[r] = (now_ns() - t0) / calls;
+		cyc[r] = (double)(c1 - c0) / calls;
+	}
+	qsort(ns, (size_t)o->reps, sizeof(double), cmp_double);
+	qsort(cyc, (size_t)o->reps, sizeof(double), cmp_double);
+	memset(stats, 0, sizeof *stats);
+	stats->median_ns = percentile(ns, o->reps, 0.5);
+	stats->p10_ns = percentile(ns, o->reps, 0.1);
+	stats->p90_ns = percentile(ns, o->reps, 0.9);
+	stats->median_cycles = percentile(cyc, o->reps, 0.5);
+	free(ns);
+	free(cyc);
+}
+
+static void run_latency(const bench_opts *o, FILE *text, FILE *json) {
+	fprintf(text, "%-8s %-6s %9s %9s %9s %9s %8s\n", "fn", "impl", "ns/call", "p10", "p90", "cyc/call", "vs libm");
+	if (json) fprintf(json, "  \"results\": [");
+	int first = 1;
+	for (size_t i = 0; i < sizeof bench_chains / sizeof bench_chains[0]; ++i) {
+		const bench_chain *c = &bench_chains[i];
+		bench_stats stats[2];
+		measure_chain(c->fmath, c->x0, o, &stats[0]);
+		measure_chain(c->libm, c->x0, o, &stats[1]);
+		for (int v = 0; v < 2; ++v) {
+			const bench_stats *s = &stats[v];
+			double sp = stats[1].median_ns / s->median_ns;
+			fprintf(text, "%-8s %-6s %9.3f %9.3f %9.3f %9.2f %7.2fx\n", c->name, v ? "libm" : "fmath", s->median_ns,
+			        s->p10_ns, s->p90_ns, s->median_cycles, sp);
+			if (json) {
+				fprintf(json,
+				        "%s\n    {\"case\": \"%s\", \"impl\": \"%s\", \"ns_per_call\": %.4f, \"p10_ns\": %.4f, "
+				        "\"p90_ns\": %.4f, \"cycles_per_call\": %.3f, \"speedup_vs_libm\": %.3f}",
+				        first ? "" : ",", c->name, v ? "libm" : "fmath", s->median_ns, s->p10_ns, s->p90_ns,
+				        s->median_cycles, sp);
+				first = 0;
+			}
+		}
+		fflush(text);
+	}
+	if (json) fprintf(json, "\n  ]\n}\n");
+}
+
+static void run_cases(const bench_opts *o, const bench_data *d, const bench_counters *counters, FILE *text,
+                      FILE *json) {
+	fprintf(text, "%-34s %-12s %10s %10s %10s %9s %9s %8s", "case", "impl", "median ms", "p10 ms", "p90 ms", "ns/elem",
+	        "cyc/elem", "vs libm");
+	if (counters->nr) {
+		fprintf(text, " %9s %6s %9s %9s %9s", "ins/elem", "IPC", "L1D/kel", "L2/kel", "brmis/kel");
+	}
+	fprintf(text, "\n");
+	if (json) {
+		fprintf(json, "  \"counters\": [");
+		for (int i = 0, listed = 0; i < BENCH_COUNTERS; ++i) {
+			if (counters->fd[i] >= 0) fprintf(json, "%s\"%s\"", listed++ ? ", " : "", counter_names[i]);
+		}
+		fprintf(json, "],\n  \"results\": [");
+	}
+
+	int first = 1;
+	size_t ncases = sizeof bench_cases / sizeof bench_cases[0];
+	for (size_t ci = 0; ci < ncases; ++ci) {
+		const bench_case *c = &bench_cases[ci];
+		bench_stats stats[BENCH_MAX_VARIANTS];
+		measure_case(c, d, o, counters, stats);
+		int nv = variant_count(c);
+		for (int v = 0; v < nv; ++v) {
+			const bench_stats *s = &stats[v];
+			double per = 1.0 / (double)d->n, sp = speedup(c, stats, v);
+			fprintf(text, "%-34s %-12s %10.3f %10.3f %10.3f %9.3f %9.3f", c->name, c->variants[v].impl,
+			        s->median_ns * 1e-6, s->p10_ns * 1e-6, s->p90_ns * 1e-6, s->median_ns * per,
+			        s->median_cycles * per);
+			if (sp > 0.0) {
+				fprintf(text, " %7.2fx", sp);
+			} else if (counters->nr) {
+				fprintf(text, " %8s", "");
+			}
+			if (counters->nr) print_counters(text, s, per);
+			fprintf(text, "\n");
+			if (json) {
+				fprintf(json,
+				        "%s\n    {\"case\": \"%s\", \"impl\": \"%s\", \"median_ns\": %.0f, \"p10_ns\": %.0f, "
+				        "\"p90_ns\": %.0f, \"ns_per_elem\": %.4f, \"cycles_per_elem\": %.4f, \"speedup_vs_libm\": %.3f",
+				        first ? "" : ",", c->name, c->variants[v].impl, s->median_ns, s->p10_ns, s->p90_ns,
+				        s->median_ns * per, s->median_cycles * per, sp);
+				if (counters->nr) json_counters(json, s, per);
+				fprintf(json, "}");
+				first = 0;
+			}
+		}
+		fflush(text);
+	}
+	if (json) fprintf(json, "\n  ]\n}\n");
+}
+
+// out2 holds 2 * n floats for the interleaved sincos variant, which --sweep does not run
+static int bench_alloc(bench_data *d, size_t n, size_t out2_n) {
+	memset(d, 0, sizeof *d);
+	d->n = n;
+	d->scratch_n = (48 * 1024) / sizeof(float);
+	d->in = (float *)malloc(n * sizeof(float));
+	d->out = (float *)malloc(n * sizeof(float));
+	d->out2 = (float *)malloc(out2_n * sizeof(float));
+	d->scratch = (float *)calloc(d->scratch_n, sizeof(float));
+	if (!d->in || !d->out || !d->out2 || !d->scratch) return -1;
+	fill_range(d->out, n, 0.0f, 1.0f); /* fault the pages in before timing */
+	fill_range(d->out2, out2_n, 0.0f, 1.0f);
+	return 0;
+}
+
+static void bench_free(bench_data *d) {
+	free(d->in);
+	free(d->out);
+	free(d->out2);
+	free(d->scratch);
+}
+
+static void usage(const char *argv0) {
+	fprintf(stderr, "usage: %s [n] [--reps R] [--warmup W] [--cpu C|none] [--json FILE|-] [--counters] [--sweep] "
+	                "[--scaling] [--latency]\n",
+	        argv0);
+	exit(1);
+}
+
 int main(int argc, char **argv) {
-	size_t n = (argc > 1) ? (size_t)atoll(argv[1]) : (size_t)8 * 1000 * 1000; // default 8M
-	printf("fmath bench n=%zu\n", n);
+	bench_opts o = {0, 11, 2, -2, NULL, 0, 0, 0, 0};
+	for (int i = 1; i < argc; ++i) {
+		if (strcmp(argv[i], "--reps") == 0 && i + 1 < argc) {
+			o.reps = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--warmup") == 0 && i + 1 < argc) {
+			o.warmup = atoi(argv[++i]);
+		} else if (strcmp(argv[i], "--cpu") == 0 && i + 1 < argc) {
+			++i;
+			o.cpu = strcmp(argv[i], "none") == 0 ? -1 : atoi(argv[i]);
+		} else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+			o.json = argv[++i];
+		} else if (strcmp(argv[i], "--counters") == 0) {
+			o.counters = 1;
+		} else if (strcmp(argv[i], "--sweep") == 0) {
+			o.sweep = 1;
+		} else if (strcmp(argv[i], "--scaling") == 0) {
+			o.scaling = 1;
+		} else if (strcmp(argv[i], "--latency") == 0) {
+			o.latency = 1;
+		} else if (argv[i][0] >= '0' && argv[i][0] <= '9') {
+			o.n = (size_t)atoll(argv[i]);
+		} else {
+			usage(argv[0]);
+		}
+	}
+	if (o.reps < 1) o.reps = 1;
+	if (o.warmup < 0) o.warmup = 0;
+	if (o.n < 1) {
+		o.n = o.sweep     ? SWEEP_DEFAULT_MAX
+		      : o.scaling ? (size_t)8 << 20
+		      : o.latency ? (size_t)1 << 20 /* calls per chain */
+		                  : (size_t)8 * 1000 * 1000; // default 8M elements
+	}
+	if (o.sweep && o.n < SWEEP_MIN) o.n = SWEEP_MIN;
 
-	float *in = (float*)malloc(n * sizeof(float));
-	float *out = (float*)malloc(n * sizeof(float));
-	if (!in || !out) {
+	bench_data d;
+	size_t buf_n = o.latency ? 1 : o.n; /* chains need no buffers */
+	if (bench_alloc(&d, buf_n, o.sweep || o.scaling ? buf_n : 2 * buf_n) != 0) {
 		fprintf(stderr, "allocation failed\n");
 		return 1;
 	}
 
 	fmath_init();
+	// Pool workers are pinned across the CPUs the first parallel caller may run on, so a
+	// threaded build leaves the bench thread unpinned unless --cpu asks for it
+	if (o.cpu == -2 && fmath_get_threads() > 1) o.cpu = -1;
+	int cpu = pin_thread(o.cpu);
+	FILE *json = NULL;
+	if (o.json) {
+		json = strcmp(o.json, "-") == 0 ? stdout : fopen(o.json, "w");
+		if (!json) {
+			perror(o.json);
+			return 1;
+		}
+	}
+	FILE *text = json == stdout ? stderr : stdout;
+	bench_counters counters = {{-1, -1, -1, -1, -1}, -1, 0};
+	if (o.counters && counters_open(&counters) == 0) {
+		fprintf(stderr, "--counters: perf_event_open offers no hardware events here (no PMU, or "
+		                "/proc/sys/kernel/perf_event_paranoid too high); timing only\n");
+	}
 
-	// sin
-	fill_range(in, n, -1000.0f, 1000.0f);
-	double t_fmath = now_time();
-	fmath_sinf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	double t_libm = time_loop(out, in, n, sinf);
-	printf("sin: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// cos
-	fill_range(in, n, -1000.0f, 1000.0f);
-	t_fmath = now_time();
-	fmath_cosf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, cosf);
-	printf("cos: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// exp
-	fill_range(in, n, -10.0f, 10.0f);
-	t_fmath = now_time();
-	fmath_expf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, expf);
-	printf("exp: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// log
-	fill_positive(in, n, 1e-6f, 1e6f);
-	t_fmath = now_time();
-	fmath_logf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, logf);
-	printf("log: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// sqrt
-	fill_positive(in, n, 1e-6f, 1e6f);
-	t_fmath = now_time();
-	fmath_sqrtf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, sqrtf);
-	printf("sqrt: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// rsqrt
-	fill_positive(in, n, 1e-6f, 1e6f);
-	t_fmath = now_time();
-	fmath_rsqrtf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, rsqrt_libm);
-	printf("rsqrt: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	// rcp
-	fill_nonzero(in, n, 1e-3f, 1e6f);
-	t_fmath = now_time();
-	fmath_rcpf_array(out, in, n);
-	t_fmath = now_time() - t_fmath;
-	t_libm = time_loop(out, in, n, rcp_libm);
-	printf("rcp: fmath=%.3f s, libm=%.3f s, speedup=%.2fx\n", t_fmath, t_libm, t_libm / t_fmath);
-
-	free(in);
-	free(out);
-	return 0;
-}
\ No newline at end of file
+	const char *mode = o.sweep ? "sweep" : o.scaling ? "scaling" : o.latency ? "latency" : "cases";
+	fprintf(text, "fmath bench %s n=%zu reps=%d warmup=%d isa=%s threads=%d cpu=%d\n", mode, o.n, o.reps, o.warmup, isa_name(fmath_get_isa()), fmath_get_threads(), cpu);
+	if (json) {
+		fprintf(json,
+		        "{\n  \"mode\": \"%s\", \"n\": %zu, \"reps\": %d, \"warmup\": %d, \"isa\": \"%s\", \"threads\": %d, "
+		        "\"cpu\": %d,\n",
+		        mode, o.n, o.reps, o.warmup, isa_name(fmath_get_isa()), fmath_get_threads(), cpu);
+		fprintf(json, "  \"table_bits\": %d, \"sin_hermite\": %d, \"sin_lut_quarter\": %d, \"precision\": %d,\n",
+		        FMATH_TABLE_BITS, FMATH_SIN_HERMITE, FMATH_SIN_LUT_QUARTER, FMATH_PRECISION);
+	}
+
+	int rc = 0;
+	if (o.sweep) {
+		run_sweep(&o, &d, text, json);
+	} else if (o.scaling) {
+		rc = run_scaling(&o, &d, text, json);
+	} else if (o.latency) {
+		run_latency(&o, text, json);
+	} else {
+		run_cases(&o, &d, &counters, text, json);
+	}
+
+	if (json && json != stdout) fclose(json);
+	counters_close(&counters);
+	bench_free(&d);
+	return rc;
+}
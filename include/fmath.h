@@ -9,20 +9,83 @@ extern "C" {
 #endif
 
 // Configuration
+#ifndef FMATH_SIN_HERMITE
+#define FMATH_SIN_HERMITE 0 /* cubic Hermite over {sin, slope} pairs instead of linear interpolation */
+#endif
+
 #ifndef FMATH_TABLE_BITS
-#define FMATH_TABLE_BITS 12 /* 4096-entry LUT by default */
+#if FMATH_SIN_HERMITE
+#define FMATH_TABLE_BITS 8 /* 256 pairs (2 KiB) already reach float rounding; 4..10 pre-generated */
+#else
+#define FMATH_TABLE_BITS 12 /* 4096-entry LUT by default; 4..12 pre-generated */
+#endif
+#endif
+
+#ifndef FMATH_SIN_LUT_QUARTER
+#define FMATH_SIN_LUT_QUARTER 0 /* store only [0, pi/2]: 4x smaller table, 4..14 pre-generated */
+#endif
+
+#ifndef FMATH_PRECISION
+#define FMATH_PRECISION 0 /* scalar tier and initial array tier: 0 fast, 1 balanced, 2 accurate */
+#endif
+
+// sin table layout tag (l, q or h for linear, quarter-wave or Hermite, then the table
+// bits), pasted into the names of the symbols that depend on it: a build with another
+// layout than the library can neither pick up nor interpose a table of the wrong shape.
+// FMATH_TABLE_BITS must therefore be a plain integer literal.
+#if FMATH_SIN_HERMITE
+#define FMATH_LUT_KIND h
+#elif FMATH_SIN_LUT_QUARTER
+#define FMATH_LUT_KIND q
+#else
+#define FMATH_LUT_KIND l
 #endif
+#define FMATH_CAT3_(a, b, c) a##b##c
+#define FMATH_CAT3(a, b, c) FMATH_CAT3_(a, b, c)
+#define FMATH_LAYOUT_NAME(name) FMATH_CAT3(name##_, FMATH_LUT_KIND, FMATH_TABLE_BITS)
 
-#ifndef FMATH_LUT_INIT_WITH_LIBM
-#define FMATH_LUT_INIT_WITH_LIBM 1 /* use sinf/cosf from libm at init */
+// Scalar functions as static inline definitions (fmath_inline.h) instead of calls into
+// the library, header-only: the library is needed for the array API alone
+#ifndef FMATH_INLINE_SCALAR
+#define FMATH_INLINE_SCALAR 0
 #endif
 
 #ifndef FMATH_ENABLE_OMP
-#define FMATH_ENABLE_OMP 0
+#define FMATH_ENABLE_OMP 0 /* deprecated alias for FMATH_ENABLE_THREADS */
 #endif
 
-#if FMATH_ENABLE_OMP
-#include <omp.h>
+// Persistent worker pool for the array APIs (pthreads; link with -pthread)
+#ifndef FMATH_ENABLE_THREADS
+#define FMATH_ENABLE_THREADS FMATH_ENABLE_OMP
+#endif
+
+#ifndef FMATH_PARALLEL_THRESHOLD
+#define FMATH_PARALLEL_THRESHOLD 65536 /* elements; smaller array calls stay on the caller thread */
+#endif
+
+#ifndef FMATH_THREAD_PIN
+#define FMATH_THREAD_PIN 1 /* pin pool workers to CPUs of the process affinity mask (Linux) */
+#endif
+
+#ifndef FMATH_THREAD_SPIN
+#define FMATH_THREAD_SPIN 4096 /* pause iterations an idle worker spins before parking */
+#endif
+
+// x86 array kernel sets (GCC/Clang); each is compiled in and used when cpuid reports support
+#ifndef FMATH_ENABLE_SSE41
+#define FMATH_ENABLE_SSE41 1 /* 4-wide SSE4.1 */
+#endif
+
+#ifndef FMATH_ENABLE_AVX2
+#define FMATH_ENABLE_AVX2 1 /* 8-wide AVX2+FMA */
+#endif
+
+#ifndef FMATH_ENABLE_AVX512
+#define FMATH_ENABLE_AVX512 1 /* 16-wide AVX-512F */
+#endif
+
+#ifndef FMATH_ENABLE_VECTOR_ABI
+#define FMATH_ENABLE_VECTOR_ABI 1 /* export _ZGV* x86 vector-function-ABI variants */
 #endif
 
 #ifndef FMATH_ALWAYS_INLINE
@@ -37,29 +100,137 @@ extern "C" {
 #define FMATH_INLINE static inline FMATH_ALWAYS_INLINE
 #endif
 
+// Scalar functions carry GCC's simd attribute so loops calling them vectorize into the
+// library's _ZGV{b,c,d,e}N{4,8,8,16}v_fmath_* kernels (x86-64 vector function ABI).
+#if FMATH_ENABLE_VECTOR_ABI && !defined(FMATH_BUILDING_LIBRARY) && defined(__GNUC__) && \
+    !defined(__clang__) && __GNUC__ >= 6 && defined(__x86_64__) && defined(__ELF__)
+#define FMATH_VECTOR_DECL __attribute__((simd("notinbranch"), const))
+#else
+#define FMATH_VECTOR_DECL
+#endif
+
 // Public API
 
-// Initializes lookup tables (called lazily by first use). Safe to call multiple times.
+// No-op: lookup tables are generated at build time and there is no lazy state, so every
+// function may be called from any thread without it. Safe to call multiple times.
 void fmath_init(void);
 
-// Scalar fast approximations (single-precision)
-float fmath_sinf(float x);
-float fmath_cosf(float x);
-float fmath_expf(float x);
-float fmath_logf(float x);
-float fmath_sqrtf(float x);
-float fmath_rsqrtf(float x);
-float fmath_rcpf(float x);
+// Link-time layout check: the library defines fmath_layout_<tag> for its own layout only,
+// so code calling into a library built with another one fails to link instead of
+// assuming a table it does not have. FMATH_INLINE_SCALAR code carries its own table.
+#if !FMATH_INLINE_SCALAR && !defined(FMATH_BUILDING_LIBRARY) && (defined(__GNUC__) || defined(__clang__))
+extern const char FMATH_LAYOUT_NAME(fmath_layout);
+static const char *const fmath_layout_check __attribute__((used)) = &FMATH_LAYOUT_NAME(fmath_layout);
+#endif
+
+// Scalar fast approximations (single-precision); defined inline at the end of this
+// header instead with FMATH_INLINE_SCALAR
+#if !FMATH_INLINE_SCALAR || defined(FMATH_BUILDING_LIBRARY)
+FMATH_VECTOR_DECL float fmath_sinf(float x);
+FMATH_VECTOR_DECL float fmath_cosf(float x);
+FMATH_VECTOR_DECL float fmath_tanf(float x);
+FMATH_VECTOR_DECL float fmath_atanf(float x);
+FMATH_VECTOR_DECL float fmath_atan2f(float y, float x);
+FMATH_VECTOR_DECL float fmath_asinf(float x);
+FMATH_VECTOR_DECL float fmath_acosf(float x);
+FMATH_VECTOR_DECL float fmath_sinhf(float x);
+FMATH_VECTOR_DECL float fmath_coshf(float x);
+FMATH_VECTOR_DECL float fmath_tanhf(float x);
+FMATH_VECTOR_DECL float fmath_expf(float x);
+FMATH_VECTOR_DECL float fmath_logf(float x);
+FMATH_VECTOR_DECL float fmath_sqrtf(float x);
+FMATH_VECTOR_DECL float fmath_rsqrtf(float x);
+FMATH_VECTOR_DECL float fmath_rcpf(float x);
+
+// sin and cos of the same angle from one range reduction (same results as the two calls)
+void fmath_sincosf(float x, float *s, float *c);
+#endif
 
 // Array APIs (in-place allowed if dst == src)
 void fmath_sinf_array(float *dst, const float *src, size_t count);
 void fmath_cosf_array(float *dst, const float *src, size_t count);
+void fmath_tanf_array(float *dst, const float *src, size_t count);
+void fmath_atanf_array(float *dst, const float *src, size_t count);
+void fmath_asinf_array(float *dst, const float *src, size_t count);
+void fmath_acosf_array(float *dst, const float *src, size_t count);
+void fmath_sinhf_array(float *dst, const float *src, size_t count);
+void fmath_coshf_array(float *dst, const float *src, size_t count);
+void fmath_tanhf_array(float *dst, const float *src, size_t count);
 void fmath_expf_array(float *dst, const float *src, size_t count);
 void fmath_logf_array(float *dst, const float *src, size_t count);
 void fmath_sqrtf_array(float *dst, const float *src, size_t count);
 void fmath_rsqrtf_array(float *dst, const float *src, size_t count);
 void fmath_rcpf_array(float *dst, const float *src, size_t count);
 
+// Fused sin/cos arrays: SoA into two outputs, or interleaved as complex e^(i*x), i.e.
+// dst[2*k] = cos(src[k]), dst[2*k + 1] = sin(src[k]) with dst holding 2*count floats.
+// Outputs must not overlap src.
+void fmath_sincosf_array(float *dst_sin, float *dst_cos, const float *src, size_t count);
+void fmath_cisf_array(float *dst, const float *src, size_t count);
+
+// dst[k] = atan2(y[k], x[k]); dst may be y or x
+void fmath_atan2f_array(float *dst, const float *y, const float *x, size_t count);
+
+// Kernel sets for the array APIs, ordered from narrowest to widest
+typedef enum fmath_isa {
+	FMATH_ISA_SCALAR = 0,
+	FMATH_ISA_SSE41,
+	FMATH_ISA_AVX2,
+	FMATH_ISA_AVX512
+} fmath_isa;
+
+// The widest set supported by the CPU is selected at load time (cap it with the
+// FMATH_ISA environment variable: scalar, sse4.1, avx2, avx512).
+// fmath_set_isa falls back to the widest available set not above `isa` (e.g. to avoid
+// AVX-512 frequency drops) and returns the set actually selected. It may be called from
+// any thread; array calls already running finish on the previous set.
+fmath_isa fmath_set_isa(fmath_isa isa);
+fmath_isa fmath_get_isa(void);
+
+// Accuracy tiers (max relative error) for the polynomial and Newton-Raphson functions.
+// sin and cos accuracy is fixed by the LUT options above; rcp is always a division.
+typedef enum fmath_precision {
+	FMATH_PRECISION_FAST = 0, /* exp 7.5e-5, log 5e-5, tan 4.4e-5, atan 3e-5, asin/acos 7.5e-5,
+	                             tanh/sinh/cosh 9.2e-5, sqrt/rsqrt 1.8e-3 (one Newton step) */
+	FMATH_PRECISION_BALANCED, /* exp 2.7e-6, log 1.1e-6, tan 3.4e-6, atan 7e-7, asin/acos 3.3e-6,
+	                             tanh/sinh/cosh 3.5e-6, sqrt/rsqrt 4.7e-6 (two Newton steps) */
+	FMATH_PRECISION_ACCURATE  /* exp, log, atan within 3 ulp, asin/acos and tanh/sinh/cosh 4 ulp,
+	                             tan 6 ulp; sqrt/rsqrt via hardware sqrt */
+} fmath_precision;
+
+typedef enum fmath_fn {
+	FMATH_FN_EXP = 0,
+	FMATH_FN_LOG,
+	FMATH_FN_SQRT,
+	FMATH_FN_RSQRT,
+	FMATH_FN_TAN,
+	FMATH_FN_ATAN, /* atan and atan2 */
+	FMATH_FN_ASIN, /* asin and acos */
+	FMATH_FN_TANH  /* tanh, sinh and cosh */
+} fmath_fn;
+
+// Selects the tier of one function for the array API and returns the tier in effect.
+// Every function starts at FMATH_PRECISION. Safe from any thread; array calls already
+// running finish on the previous tier. The scalar functions and their vector-ABI variants
+// always run at the library's FMATH_PRECISION: they are declared const for
+// vectorization, so the compiler may reuse their results across a tier change.
+fmath_precision fmath_set_precision(fmath_fn fn, fmath_precision precision);
+fmath_precision fmath_get_precision(fmath_fn fn);
+
+// Threading (FMATH_ENABLE_THREADS): array calls of at least the parallel threshold are
+// split into blocks shared by the calling thread and a persistent pool of workers that
+// spin briefly, then park, between calls. The pool starts on first use; calls made while
+// another thread is using it run on the caller thread. Without FMATH_ENABLE_THREADS
+// these are no-ops and everything runs on the caller thread.
+//
+// fmath_set_threads sets the total thread count including the caller (<= 0: one per CPU
+// in the affinity mask, or the FMATH_THREADS environment variable) and returns the count
+// in effect; 1 disables the pool.
+int fmath_set_threads(int count);
+int fmath_get_threads(void);
+void fmath_set_parallel_threshold(size_t count);
+size_t fmath_get_parallel_threshold(void);
+
 // Easy API helpers
 #ifndef FMATH_COUNT_OF
 #define FMATH_COUNT_OF(arr) (sizeof(arr) / sizeof((arr)[0]))
@@ -69,20 +240,47 @@ void fmath_rcpf_array(float *dst, const float *src, size_t count);
 #define fm_init            fmath_init
 #define fm_sin             fmath_sinf
 #define fm_cos             fmath_cosf
+#define fm_tan             fmath_tanf
+#define fm_atan            fmath_atanf
+#define fm_atan2           fmath_atan2f
+#define fm_asin            fmath_asinf
+#define fm_acos            fmath_acosf
+#define fm_sinh            fmath_sinhf
+#define fm_cosh            fmath_coshf
+#define fm_tanh            fmath_tanhf
 #define fm_exp             fmath_expf
 #define fm_log             fmath_logf
 #define fm_sqrt            fmath_sqrtf
 #define fm_rsqrt           fmath_rsqrtf
 #define fm_rcp             fmath_rcpf
+#define fm_sincos          fmath_sincosf
 #define fm_sin_arr(dst, src, n)   fmath_sinf_array((dst), (src), (n))
 #define fm_cos_arr(dst, src, n)   fmath_cosf_array((dst), (src), (n))
+#define fm_tan_arr(dst, src, n)   fmath_tanf_array((dst), (src), (n))
+#define fm_atan_arr(dst, src, n)  fmath_atanf_array((dst), (src), (n))
+#define fm_atan2_arr(dst, y, x, n) fmath_atan2f_array((dst), (y), (x), (n))
+#define fm_asin_arr(dst, src, n)  fmath_asinf_array((dst), (src), (n))
+#define fm_acos_arr(dst, src, n)  fmath_acosf_array((dst), (src), (n))
+#define fm_sinh_arr(dst, src, n)  fmath_sinhf_array((dst), (src), (n))
+#define fm_cosh_arr(dst, src, n)  fmath_coshf_array((dst), (src), (n))
+#define fm_tanh_arr(dst, src, n)  fmath_tanhf_array((dst), (src), (n))
 #define fm_exp_arr(dst, src, n)   fmath_expf_array((dst), (src), (n))
 #define fm_log_arr(dst, src, n)   fmath_logf_array((dst), (src), (n))
 #define fm_sqrt_arr(dst, src, n)  fmath_sqrtf_array((dst), (src), (n))
 #define fm_rsqrt_arr(dst, src, n) fmath_rsqrtf_array((dst), (src), (n))
 #define fm_rcp_arr(dst, src, n)   fmath_rcpf_array((dst), (src), (n))
+#define fm_sincos_arr(s, c, src, n) fmath_sincosf_array((s), (c), (src), (n))
+#define fm_cis_arr(dst, src, n)   fmath_cisf_array((dst), (src), (n))
 #define fm_sin_aa(dst, src)       fmath_sinf_array((dst), (src), FMATH_COUNT_OF(src))
 #define fm_cos_aa(dst, src)       fmath_cosf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_tan_aa(dst, src)       fmath_tanf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_atan_aa(dst, src)      fmath_atanf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_atan2_aa(dst, y, x)    fmath_atan2f_array((dst), (y), (x), FMATH_COUNT_OF(y))
+#define fm_asin_aa(dst, src)      fmath_asinf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_acos_aa(dst, src)      fmath_acosf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_sinh_aa(dst, src)      fmath_sinhf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_cosh_aa(dst, src)      fmath_coshf_array((dst), (src), FMATH_COUNT_OF(src))
+#define fm_tanh_aa(dst, src)      fmath_tanhf_array((dst), (src), FMATH_COUNT_OF(src))
 #define fm_exp_aa(dst, src)       fmath_expf_array((dst), (src), FMATH_COUNT_OF(src))
 #define fm_log_aa(dst, src)       fmath_logf_array((dst), (src), FMATH_COUNT_OF(src))
 #define fm_sqrt_aa(dst, src)      fmath_sqrtf_array((dst), (src), FMATH_COUNT_OF(src))
@@ -90,6 +288,15 @@ void fmath_rcpf_array(float *dst, const float *src, size_t count);
 #define fm_rcp_aa(dst, src)       fmath_rcpf_array((dst), (src), FMATH_COUNT_OF(src))
 #endif
 
+#ifdef __cplusplus
+}
+#endif
+
+// Before the libm overrides below: the kernels call the real sqrtf
+#if FMATH_INLINE_SCALAR && !defined(FMATH_BUILDING_LIBRARY)
+#include "fmath_inline.h"
+#endif
+
 #ifdef FMATH_OVERRIDE_LIBM
 // Override common libm float entry points with fmath versions
 // Toggle by defining FMATH_OVERRIDE_LIBM before including this header
@@ -99,6 +306,22 @@ void fmath_rcpf_array(float *dst, const float *src, size_t count);
 #ifndef FMATH_NO_OVERRIDE_COS
 #define cosf fmath_cosf
 #endif
+#ifndef FMATH_NO_OVERRIDE_TAN
+#define tanf fmath_tanf
+#endif
+#ifndef FMATH_NO_OVERRIDE_ATAN
+#define atanf fmath_atanf
+#define atan2f fmath_atan2f
+#endif
+#ifndef FMATH_NO_OVERRIDE_ASIN
+#define asinf fmath_asinf
+#define acosf fmath_acosf
+#endif
+#ifndef FMATH_NO_OVERRIDE_TANH
+#define sinhf fmath_sinhf
+#define coshf fmath_coshf
+#define tanhf fmath_tanhf
+#endif
 #ifndef FMATH_NO_OVERRIDE_EXP
 #define expf fmath_expf
 #endif
@@ -110,8 +333,4 @@ void fmath_rcpf_array(float *dst, const float *src, size_t count);
 #endif
 #endif
 
-#ifdef __cplusplus
-}
-#endif
-
 #endif /* FMATH_H */
\ No newline at end of file
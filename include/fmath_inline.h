@@ -0,0 +1,674 @@
+#ifndef FMATH_INLINE_H
+#define FMATH_INLINE_H
+
+// Scalar kernels shared by the library (src/fmath.c) and, with FMATH_INLINE_SCALAR, by
+// user code: fmath_sinf, fmath_expf, ... then become static inline functions that the
+// compiler can inline, constant-propagate and vectorize across translation units without
+// LTO. The LUT and the large-argument trig reduction are defined here as well (weak, so
+// the program keeps one copy), which makes the scalar API header-only: link the library
+// only for the array API. Include fmath.h, not this file.
+
+#include "fmath.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef FMATH_PI
+#define FMATH_PI 3.14159265358979323846f
+#endif
+#ifndef FMATH_TWO_PI
+#define FMATH_TWO_PI 6.28318530717958647692f
+#endif
+#ifndef FMATH_INV_TWO_PI
+#define FMATH_INV_TWO_PI 0.15915494309189533577f /* 1/(2*pi) */
+#endif
+#ifndef FMATH_HALF_PI
+#define FMATH_HALF_PI 1.57079632679489661923f
+#endif
+#ifndef FMATH_TWO_OVER_PI
+#define FMATH_TWO_OVER_PI 0.63661977236758134308f /* 2/pi */
+#endif
+#ifndef FMATH_LN2
+#define FMATH_LN2 0.69314718055994530942f
+#endif
+#ifndef FMATH_INV_LN2
+#define FMATH_INV_LN2 1.4426950408889634074f /* 1/ln(2) */
+#endif
+
+// ln(2) split for Cody-Waite: n * FMATH_LN2_HI is exact for |n| < 2^9
+#define FMATH_LN2_HI 0.693145751953125f
+#define FMATH_LN2_LO 1.42860676533018704e-06f
+#define FMATH_EXP_MAX 88.7228394f /* ln(FLT_MAX) */
+#define FMATH_SINH_MAX 89.4159927f /* first float above ln(2 * FLT_MAX): sinh and cosh overflow */
+#define FMATH_TANH_SAT 10.0f       /* tanh rounds to 1 from 9.0109 on */
+
+// Trig range reduction: Cody-Waite x - n*2*pi with 2*pi split into 10-bit, 10-bit and
+// float parts (n*HI and n*MID stay exact for n < 2^14, residual ~2e-14), valid up to
+// FMATH_TRIG_CW_LIMIT; larger (and non-finite) arguments take Payne-Hanek.
+#define FMATH_TWO_PI_HI 6.28125f
+#define FMATH_TWO_PI_MID 0.0019359588623046875f
+#define FMATH_TWO_PI_LO -6.5168274e-07f
+#define FMATH_TRIG_CW_LIMIT 65536.0f
+
+// tan reduces modulo pi/2 and needs x - n*pi/2 to relative accuracy even next to a pole,
+// where it is tiny: four parts, the first three of 10 bits so every n * part is exact
+// for n < 2^14 and each difference that comes out small is exact too (~2 ulp of r,
+// without FMA). Beyond FMATH_TAN_CW_LIMIT, Payne-Hanek.
+#define FMATH_PI_2_HI 1.5703125f
+#define FMATH_PI_2_MID 4.83989715576171875e-04f
+#define FMATH_PI_2_LO -1.62981450557708740e-07f
+#define FMATH_PI_2_TAIL 6.07710063e-11f
+#define FMATH_TAN_CW_LIMIT 16384.0f
+
+// Hides a value from the optimizer so -ffast-math cannot reassociate compensated
+// arithmetic across it (e.g. fold the Cody-Waite steps back into x - n * 2*pi).
+// Works on scalar floats and SSE/AVX/AVX-512 vectors.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define FMATH_OPAQUE(v) __asm__("" : "+x"(v))
+#elif (defined(__GNUC__) || defined(__clang__)) && defined(__aarch64__)
+#define FMATH_OPAQUE(v) __asm__("" : "+w"(v))
+#else
+#define FMATH_OPAQUE(v) ((void)0)
+#endif
+
+// Internal LUT for sin; cos derived via phase shift
+enum {
+	FMATH_TABLE_SIZE = 1 << FMATH_TABLE_BITS,
+	FMATH_TABLE_MASK = FMATH_TABLE_SIZE - 1,
+	FMATH_QUARTER_SIZE = FMATH_TABLE_SIZE / 4
+};
+
+#define FMATH_INDEX_SCALE ((float)FMATH_TABLE_SIZE * (1.0f / FMATH_TWO_PI))
+
+// Full period plus one guard entry (== entry 0) so i0 + 1 never needs wrapping, or in
+// quarter-wave mode sin over [0, pi/2] inclusive, folded by quadrant at lookup time.
+// Hermite mode interleaves {sin(2*pi*i/N), (2*pi/N) * cos(2*pi*i/N)} pairs, i = 0..N:
+// value and derivative with respect to the table index.
+#if FMATH_SIN_HERMITE
+#if FMATH_SIN_LUT_QUARTER
+#error "FMATH_SIN_LUT_QUARTER applies to the linear-interpolation table only"
+#endif
+#define FMATH_LUT_ENTRIES (2 * (FMATH_TABLE_SIZE + 1))
+#elif FMATH_SIN_LUT_QUARTER
+#define FMATH_LUT_ENTRIES (FMATH_QUARTER_SIZE + 1)
+#else
+#define FMATH_LUT_ENTRIES (FMATH_TABLE_SIZE + 1)
+#endif
+
+// Layout-dependent symbols under layout-tagged names, e.g. fmath_sin_lut_l12 and
+// fmath_trig_reduce_large_l12 (see FMATH_LAYOUT_NAME)
+#define fmath_sin_lut FMATH_LAYOUT_NAME(fmath_sin_lut)
+#define fmath_trig_reduce_large FMATH_LAYOUT_NAME(fmath_trig_reduce_large)
+
+#include "fmath_poly.h"
+
+// Helpers for bit-casting without aliasing UB
+FMATH_INLINE uint32_t fmath_bitcast_f32_to_u32(float x) {
+	uint32_t u;
+	memcpy(&u, &x, sizeof u);
+	return u;
+}
+
+FMATH_INLINE float fmath_bitcast_u32_to_f32(uint32_t u) {
+	float x;
+	memcpy(&x, &u, sizeof x);
+	return x;
+}
+
+// Shared data and out-of-line helpers, defined where FMATH_SHARED is: in src/fmath.c
+// (FMATH_DEFINE_SHARED) and in client code built with FMATH_INLINE_SCALAR, as weak
+// symbols that the linker folds into one copy (the library's, when it is linked too).
+#if FMATH_INLINE_SCALAR && !defined(FMATH_BUILDING_LIBRARY)
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__ELF__) || defined(__APPLE__))
+#define FMATH_SHARED __attribute__((weak))
+#else
+#define FMATH_SHARED static /* one copy per translation unit */
+#define FMATH_SHARED_STATIC 1
+#endif
+#elif defined(FMATH_DEFINE_SHARED)
+#define FMATH_SHARED
+#endif
+#if defined(__cplusplus) && !defined(FMATH_SHARED_STATIC)
+#define FMATH_SHARED_DATA extern FMATH_SHARED /* C++ const objects default to internal linkage */
+#else
+#define FMATH_SHARED_DATA FMATH_SHARED
+#endif
+
+#ifndef FMATH_SHARED_STATIC
+// sin LUT, generated offline by tools/gen_sin_lut.c into fmath_sin_lut.h: lives in
+// .rodata, so there is no startup cost, no init check on the hot path, and forked
+// workers share the pages.
+extern const float fmath_sin_lut[FMATH_LUT_ENTRIES];
+
+// Payne-Hanek for |x| > FMATH_TRIG_CW_LIMIT: returns the table index j in [0, N) and
+// the fraction t in [0, 1) of x * N / (2*pi) mod N, exact to ~2^-64 of a period; NaN t
+// for inf/NaN. Out of line: the SIMD kernels call it for the affected lanes only.
+int fmath_trig_reduce_large(float x, float *t);
+
+// The same for tan: returns the quadrant n (mod 4) and stores r = x - n*pi/2 in
+// [-pi/4, pi/4], accurate to the last bit however close x lies to a pole; NaN r for
+// inf/NaN.
+int fmath_tan_reduce_large(float x, float *r);
+#endif
+
+#ifdef FMATH_SHARED
+FMATH_SHARED_DATA const float fmath_sin_lut[FMATH_LUT_ENTRIES] = {
+#include "fmath_sin_lut.h"
+};
+
+// Bits of 1/(2*pi) after the binary point, 32 per word, behind one zero word: the
+// window below starts at bit e + 1 with e >= -9 for |x| >= 2^14, enough for every float
+static const uint32_t fmath_inv_two_pi_bits[] = {
+	0x00000000, 0x28be60db, 0x9391054a, 0x7f09d5f4, 0x7d4d3770, 0x36d8a566, 0x4f10e410, 0x7f9458ea, 0xf7aef158,
+};
+
+// frac(x / (2*pi)) mod 1 as a 64-bit fixed-point fraction, for finite |x| >= 2^14
+static inline uint64_t fmath_two_pi_frac(uint32_t xi) {
+	// |x| = m * 2^e; frac(x / (2*pi)) needs the bits of 1/(2*pi) from 2^-(e+1) on, the
+	// ones above only contribute integers. Take a 96-bit window W of them: then
+	// frac = m * W * 2^-96 mod 1, of which the top 64 bits are kept.
+	int biased = (int)((xi >> 23) & 255);
+	uint64_t m = (xi & 0x7fffffU) | 0x800000U;
+	int pos = biased - 150 + 32;
+	const uint32_t *w = fmath_inv_two_pi_bits + (pos >> 5);
+	int sh = 32 - (pos & 31);
+	uint64_t w2 = (uint32_t)((((uint64_t)w[0] << 32) | w[1]) >> sh);
+	uint64_t w1 = (uint32_t)((((uint64_t)w[1] << 32) | w[2]) >> sh);
+	uint64_t w0 = (uint32_t)((((uint64_t)w[2] << 32) | w[3]) >> sh);
+	uint64_t frac = ((m * w2) << 32) + m * w1 + ((m * w0) >> 32);
+	return (xi >> 31) ? 0 - frac : frac;
+}
+
+FMATH_SHARED int fmath_trig_reduce_large(float x, float *t) {
+	uint32_t xi = fmath_bitcast_f32_to_u32(x);
+	if (((xi >> 23) & 255) == 255) {
+		*t = NAN; /* inf and NaN */
+		return 0;
+	}
+	uint64_t frac = fmath_two_pi_frac(xi);
+	*t = (float)((frac << FMATH_TABLE_BITS) >> 40) * (1.0f / 16777216.0f);
+	return (int)(frac >> (64 - FMATH_TABLE_BITS));
+}
+
+FMATH_SHARED int fmath_tan_reduce_large(float x, float *r) {
+	uint32_t xi = fmath_bitcast_f32_to_u32(x);
+	if (((xi >> 23) & 255) == 255) {
+		*r = NAN;
+		return 0;
+	}
+	// In quarter periods: n = round(4 * frac), and the rest, within half a quarter
+	// period, as a signed fraction with 62 bits behind the point. Next to a pole its
+	// leading bits cancel, and the ~40 left still give r to the last bit.
+	uint64_t frac = fmath_two_pi_frac(xi);
+	uint64_t n = (frac + (1ULL << 61)) >> 62;
+	int64_t d = (int64_t)(frac - (n << 62));
+	*r = (float)((double)d * 3.4061215800865545e-19); /* pi/2 * 2^-62 */
+	return (int)(n & 3);
+}
+#endif
+
+// Interpolates sin at table position j + t (t in [0, 1)); j wraps via mask, so any
+// integer works and cos is the same lookup at j + N/4.
+FMATH_INLINE float fmath_lut_at(int j, float t) {
+	j &= FMATH_TABLE_MASK;
+#if FMATH_SIN_HERMITE
+	// Cubic Hermite between pairs j and j + 1: error ~ (2*pi/N)^4 / 384, below float
+	// rounding from N = 256 on, so the whole table fits in 2 KiB.
+	const float *e = fmath_sin_lut + 2 * j;
+	float p0 = e[0], m0 = e[1], p1 = e[2], m1 = e[3];
+	float dp = p1 - p0;
+	float c2 = 3.0f * dp - 2.0f * m0 - m1;
+	float c3 = m0 + m1 - 2.0f * dp;
+	return p0 + t * (m0 + t * (c2 + t * c3));
+#elif FMATH_SIN_LUT_QUARTER
+	// Branchless quadrant folding: odd quadrants read the quarter table backwards
+	// (i0 = Q - k, step -1), the second half-period flips the sign bit.
+	int q = j >> (FMATH_TABLE_BITS - 2);
+	int odd = -(q & 1);
+	int i0 = ((j & (FMATH_QUARTER_SIZE - 1)) ^ odd) + (odd & (FMATH_QUARTER_SIZE + 1));
+	float s0 = fmath_sin_lut[i0];
+	float s1 = fmath_sin_lut[i0 + (1 | odd)];
+	float r = s0 + t * (s1 - s0);
+	return fmath_bitcast_u32_to_f32(fmath_bitcast_f32_to_u32(r) ^ ((uint32_t)(q >> 1) << 31));
+#else
+	float s0 = fmath_sin_lut[j];
+	float s1 = fmath_sin_lut[j + 1];
+	return s0 + t * (s1 - s0);
+#endif
+}
+
+// Table position of x: returns j (wrapped by fmath_lut_at) and the fraction t. Cody-Waite
+// first, so the phase survives for large |x| instead of vanishing in x * N / (2*pi).
+FMATH_INLINE int fmath_trig_reduce(float x, float *t) {
+	if (!(fabsf(x) <= FMATH_TRIG_CW_LIMIT)) return fmath_trig_reduce_large(x, t);
+	int n = (int)(x * FMATH_INV_TWO_PI + 12582912.0f) - 12582912; /* round to nearest */
+	float nf = (float)n;
+	float r = x - nf * FMATH_TWO_PI_HI;
+	FMATH_OPAQUE(r);
+	r -= nf * FMATH_TWO_PI_MID;
+	FMATH_OPAQUE(r);
+	r -= nf * FMATH_TWO_PI_LO;
+	float index_f = r * FMATH_INDEX_SCALE;
+	float idx_floor = floorf(index_f);
+	*t = index_f - idx_floor;
+	return (int)idx_floor;
+}
+
+// Fast sinf/cosf using LUT + linear (or cubic Hermite) interpolation, with power-of-two table size.
+FMATH_INLINE float fmath_sinf_impl(float x) {
+	float t;
+	int j = fmath_trig_reduce(x, &t);
+	return fmath_lut_at(j, t);
+}
+
+FMATH_INLINE float fmath_cosf_impl(float x) {
+	// cos(x) = sin(x + pi/2) -> phase shift by a quarter table, exact in index space
+	float t;
+	int j = fmath_trig_reduce(x, &t);
+	return fmath_lut_at((j & FMATH_TABLE_MASK) + FMATH_QUARTER_SIZE, t);
+}
+
+// One range reduction for both; results are bit-identical to fmath_sinf/fmath_cosf
+FMATH_INLINE void fmath_sincosf_impl(float x, float *s, float *c) {
+	float t;
+	int j = fmath_trig_reduce(x, &t) & FMATH_TABLE_MASK;
+	*s = fmath_lut_at(j, t);
+	*c = fmath_lut_at(j + FMATH_QUARTER_SIZE, t);
+}
+
+// Quadrant n of x and r = x - n*pi/2 (|r| <= pi/4), as fmath_trig_reduce
+FMATH_INLINE int fmath_tan_reduce(float x, float *r) {
+	if (!(fabsf(x) <= FMATH_TAN_CW_LIMIT)) return fmath_tan_reduce_large(x, r);
+	int n = (int)(x * FMATH_TWO_OVER_PI + 12582912.0f) - 12582912; /* round to nearest */
+	float nf = (float)n;
+	float y = x - nf * FMATH_PI_2_HI;
+	FMATH_OPAQUE(y);
+	y -= nf * FMATH_PI_2_MID;
+	FMATH_OPAQUE(y);
+	y -= nf * FMATH_PI_2_LO;
+	FMATH_OPAQUE(y);
+	*r = y - nf * FMATH_PI_2_TAIL;
+	return n;
+}
+
+// Horner evaluation of c[0] + c[1] * x + ... + c[n - 1] * x^(n - 1)
+FMATH_INLINE float fmath_poly(float x, const float *c, int n) {
+	float p = c[n - 1];
+	for (int k = n - 2; k >= 0; --k) p = fmaf(p, x, c[k]);
+	return p;
+}
+
+#define FMATH_POLY(x, coeffs) fmath_poly((x), (coeffs), (int)FMATH_COUNT_OF(coeffs))
+
+// tan(x) = r * q(r^2) in even quadrants and -1 / (r * q(r^2)) in odd ones, q the tier's
+// minimax polynomial in r^2: at most one division, and next to a pole the result keeps
+// the relative accuracy of r. A zero r in an odd quadrant would give +/-inf, but no
+// float is a nonzero multiple of pi/2.
+FMATH_INLINE float fmath_tanf_impl(float x, fmath_precision tier) {
+	float r;
+	int n = fmath_tan_reduce(x, &r);
+	float z = r * r;
+	float q = tier == FMATH_PRECISION_FAST       ? FMATH_POLY(z, fmath_tan_poly_fast)
+	          : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(z, fmath_tan_poly_balanced)
+	                                             : FMATH_POLY(z, fmath_tan_poly_accurate);
+	float p = r * q;
+	return (n & 1) ? -1.0f / p : p;
+}
+
+// atan(t) = t * q(t^2) for t in [0, 1], q the tier's minimax polynomial
+FMATH_INLINE float fmath_atan_kernel(float t, fmath_precision tier) {
+	float z = t * t;
+	float q = tier == FMATH_PRECISION_FAST       ? FMATH_POLY(z, fmath_atan_poly_fast)
+	          : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(z, fmath_atan_poly_balanced)
+	                                             : FMATH_POLY(z, fmath_atan_poly_accurate);
+	return t * q;
+}
+
+// r >= 0 (or NaN) with the sign bit of s
+FMATH_INLINE float fmath_with_sign_of(float r, float s) {
+	return fmath_bitcast_u32_to_f32(fmath_bitcast_f32_to_u32(r) | (fmath_bitcast_f32_to_u32(s) & 0x80000000u));
+}
+
+// atan(|x|) = pi/2 - atan(1/|x|) above 1, so the polynomial only sees [0, 1]. Infinity
+// divides as 2^64 (atan(2^64) rounds to pi/2): under -ffast-math GCC may vectorize the
+// division as a reciprocal estimate plus a Newton step, which gives NaN for an infinite
+// divisor. NaN is passed through on the bits: finite-math if-conversion of the selects
+// may otherwise route it to the infinity result.
+FMATH_INLINE float fmath_atanf_impl(float x, fmath_precision tier) {
+	uint32_t ai = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	int inv = a > 1.0f;
+	float d = fmath_bitcast_u32_to_f32(ai == 0x7f800000u ? 0x5f800000u : ai);
+	float r = fmath_atan_kernel(inv ? 1.0f / d : a, tier);
+	r = fmath_with_sign_of(inv ? FMATH_HALF_PI - r : r, x);
+	return ai > 0x7f800000u ? x : r;
+}
+
+// Octant reduction without branches on the data: t = min(|x|, |y|) / max(|x|, |y|) in
+// [0, 1], then atan(t) reflected about pi/4 when |y| > |x|, about pi/2 for negative x
+// (sign bit, so -0 counts), and signed as y. 0/0 and inf/inf are the cases t cannot
+// express: atan2(+-0, +-0) and atan2(+-inf, +-inf) come out as IEEE asks (0 or pi,
+// pi/4 or 3pi/4), and a NaN operand is returned. For the reciprocal-based division of
+// fmath_atanf_impl, a den above 2^64 scales both by 2^-64 (num <= den, so only
+// negligible t are lost), and a finite num over an infinite den is t = 0.
+FMATH_INLINE float fmath_atan2f_impl(float y, float x, fmath_precision tier) {
+	float ax = fabsf(x), ay = fabsf(y);
+	int swap = ay > ax;
+	float num = swap ? ax : ay, den = swap ? ay : ax;
+	float s = den > 0x1p64f ? 0x1p-64f : 1.0f;
+	float t = (num * s) / (den * s);
+	t = den == 0.0f ? num : t; /* both zero (num keeps a NaN y) */
+	t = num < INFINITY && den == INFINITY ? 0.0f : t;
+	t = num == INFINITY && den == INFINITY ? 1.0f : t;
+	float r = fmath_atan_kernel(t, tier);
+	r = swap ? FMATH_HALF_PI - r : r;
+	r = (fmath_bitcast_f32_to_u32(x) >> 31) ? FMATH_PI - r : r;
+	r = fmath_with_sign_of(r, y);
+	// NaN operands by bits: under -ffast-math the selects above may not keep them
+	uint32_t axb = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu, ayb = fmath_bitcast_f32_to_u32(y) & 0x7fffffffu;
+	return ayb > 0x7f800000u ? y : axb > 0x7f800000u ? x : r;
+}
+
+// x - n * c as one Cody-Waite step that -ffast-math must not merge with the next: a fused
+// multiply-add where FMA is native, which keeps inlined loops vectorizable, otherwise an
+// optimization barrier
+FMATH_INLINE float fmath_cw_step(float x, float n, float c) {
+#ifdef FP_FAST_FMAF
+	return fmaf(-n, c, x);
+#else
+	float r = x - n * c;
+	FMATH_OPAQUE(r);
+	return r;
+#endif
+}
+
+// e^x * 2^k: x = n * ln2 + g with g in [-ln2/2, ln2/2] (Cody-Waite, so g stays exact for
+// every finite result), e^g from the tier's minimax polynomial, then scale by 2^(n + k) via
+// bit trick. No range checks: -100 <= x and a finite result are up to the caller.
+FMATH_INLINE float fmath_exp_core(float x, int k, fmath_precision tier) {
+	// Round x / ln2 to nearest integer using magic-bias trick
+	float rb = x * FMATH_INV_LN2 + 12582912.0f; // 2^23 * 1.5, works for |x / ln2| < 2^22
+	int n = (int)rb - 12582912;
+	float nf = (float)n;
+	float g = fmath_cw_step(fmath_cw_step(x, nf, FMATH_LN2_HI), nf, FMATH_LN2_LO);
+
+	float p = tier == FMATH_PRECISION_FAST       ? FMATH_POLY(g, fmath_exp_poly_fast)
+	          : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(g, fmath_exp_poly_balanced)
+	                                             : FMATH_POLY(g, fmath_exp_poly_accurate);
+
+	// p * 2^m by adding m to the exponent bits of p, which lies in (1/2, 2) and below 1
+	// when m = 128; results below the normal range scale by 2^(m + 64) first, then round
+	// once in the multiply by 2^-64. No calls, so inlined loops still vectorize.
+	int m = n + k;
+	uint32_t pb = fmath_bitcast_f32_to_u32(p);
+	if (m >= -125) return fmath_bitcast_u32_to_f32(pb + ((uint32_t)m << 23));
+	return fmath_bitcast_u32_to_f32(pb + ((uint32_t)(m + 64) << 23)) * 0x1p-64f;
+}
+
+// Fast expf: fmath_exp_core within its range
+FMATH_INLINE float fmath_expf_impl(float x, fmath_precision tier) {
+	if (x >= FMATH_EXP_MAX) return INFINITY; // avoid overflow (the float above ln(FLT_MAX))
+	if (x < -100.0f) return 0.0f;            // underflow
+	return fmath_exp_core(x, 0, tier);
+}
+
+// sinh(x) / x and cosh(x) as the tier's minimax polynomials in z = x^2, for |x| < 1/2
+FMATH_INLINE float fmath_sinh_poly(float z, fmath_precision tier) {
+	return tier == FMATH_PRECISION_FAST       ? FMATH_POLY(z, fmath_sinh_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(z, fmath_sinh_poly_balanced)
+	                                          : FMATH_POLY(z, fmath_sinh_poly_accurate);
+}
+
+FMATH_INLINE float fmath_cosh_poly(float z, fmath_precision tier) {
+	return tier == FMATH_PRECISION_FAST       ? FMATH_POLY(z, fmath_cosh_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(z, fmath_cosh_poly_balanced)
+	                                          : FMATH_POLY(z, fmath_cosh_poly_accurate);
+}
+
+// Hyperbolic functions of a = |x| on the exp core: below 1/2 the polynomials above, where
+// e^a - e^-a would cancel; otherwise h = e^a / 2 (the exp reduction scaled by 2^-1, so h
+// stays finite up to the sinh/cosh overflow at FMATH_SINH_MAX) and h -+ 1/(4h). tanh is
+// x * S(z) / C(z) near zero, a rational function of the same polynomials, then
+// 1 - 2 / (e^2a + 1) with the argument clamped at FMATH_TANH_SAT, where it is 1. NaN
+// passes through on the bits: finite-math if-conversion of the selects may lose it.
+FMATH_INLINE float fmath_sinhf_impl(float x, fmath_precision tier) {
+	uint32_t ai = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	float r;
+	if (a < 0.5f) {
+		r = a * fmath_sinh_poly(a * a, tier);
+	} else {
+		float h = fmath_exp_core(a < FMATH_SINH_MAX ? a : 0.0f, -1, tier);
+		r = a < FMATH_SINH_MAX ? h - 0.25f / h : INFINITY;
+	}
+	r = fmath_with_sign_of(r, x);
+	return ai > 0x7f800000u ? x : r;
+}
+
+FMATH_INLINE float fmath_coshf_impl(float x, fmath_precision tier) {
+	uint32_t ai = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	float r;
+	if (a < 0.5f) {
+		r = fmath_cosh_poly(a * a, tier);
+	} else {
+		float h = fmath_exp_core(a < FMATH_SINH_MAX ? a : 0.0f, -1, tier);
+		r = a < FMATH_SINH_MAX ? h + 0.25f / h : INFINITY;
+	}
+	return ai > 0x7f800000u ? x : r;
+}
+
+FMATH_INLINE float fmath_tanhf_impl(float x, fmath_precision tier) {
+	uint32_t ai = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	float r;
+	if (a < 0.5f) {
+		float z = a * a;
+		r = a * fmath_sinh_poly(z, tier) / fmath_cosh_poly(z, tier);
+	} else {
+		float e = fmath_exp_core(2.0f * (a < FMATH_TANH_SAT ? a : FMATH_TANH_SAT), 0, tier);
+		r = 1.0f - 2.0f / (e + 1.0f);
+	}
+	r = fmath_with_sign_of(r, x);
+	return ai > 0x7f800000u ? x : r;
+}
+
+// Fast logf using bit tricks: x = m * 2^e with m in [sqrt(1/2), sqrt(2)), so f = m - 1 is
+// small on both sides of 1; log(x) = e * ln2 + f * q(f) with q the tier's minimax polynomial.
+FMATH_INLINE float fmath_logf_impl(float x, fmath_precision tier) {
+	uint32_t ix = fmath_bitcast_f32_to_u32(x);
+	if ((ix & 0x7fffffffu) >= 0x7f800000u && ix != 0xff800000u) return x; /* +inf and NaN, by bits */
+	if (x <= 0.0f) {
+		if (x == 0.0f) return -INFINITY;
+		return NAN;
+	}
+	uint32_t u = ix - 0x3f3504f3u; // bits of sqrt(1/2)
+	int e = (int)((int32_t)u >> 23);
+	float f = fmath_bitcast_u32_to_f32((u & 0x7fffffU) + 0x3f3504f3u) - 1.0f;
+	float q = tier == FMATH_PRECISION_FAST       ? FMATH_POLY(f, fmath_log_poly_fast)
+	          : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(f, fmath_log_poly_balanced)
+	                                             : FMATH_POLY(f, fmath_log_poly_accurate);
+	float ef = (float)e;
+	return ef * FMATH_LN2_HI + fmaf(f, q, ef * FMATH_LN2_LO);
+}
+
+// Newton step y * (1.5 - x/2 * y * y) for 1/sqrt(x), as y + y/2 * (1 - p * y) with
+// p = x * y near sqrt(x), so no intermediate leaves the normal range for any normal x:
+// x/2 flushes under FTZ for x below 2 * FLT_MIN, and y * y for x above ~1e38. p is pinned
+// (FMA, or opaque as in fmath_cw_step) so -ffast-math cannot reassociate x * y * y.
+// Ending in an add also keeps x * y in sqrt from turning into (x * 1.5) * y, which
+// overflows near FLT_MAX.
+FMATH_INLINE float fmath_rsqrt_step(float x, float y) {
+	float p = x * y;
+#ifdef FP_FAST_FMAF
+	return fmaf(0.5f * y, fmaf(-p, y, 1.0f), y);
+#else
+	FMATH_OPAQUE(p);
+	return y + 0.5f * y * (1.0f - p * y);
+#endif
+}
+
+// Quake III initial guess + one Newton-Raphson step (two when balanced), no special cases
+FMATH_INLINE float fmath_rsqrt_core(float x, fmath_precision tier) {
+	uint32_t i = fmath_bitcast_f32_to_u32(x);
+	i = 0x5f3759dfu - (i >> 1);
+	float y = fmath_bitcast_u32_to_f32(i);
+	y = fmath_rsqrt_step(x, y);
+	if (tier == FMATH_PRECISION_BALANCED) y = fmath_rsqrt_step(x, y);
+	return y;
+}
+
+// Fast inverse sqrt (Quake III) + one Newton-Raphson refinement, two when balanced
+FMATH_INLINE float fmath_rsqrtf_impl(float x, fmath_precision tier) {
+	if (x <= 0.0f) {
+		if (x == 0.0f) return INFINITY;
+		return NAN;
+	}
+	if (tier == FMATH_PRECISION_ACCURATE) return 1.0f / sqrtf(x);
+	return fmath_rsqrt_core(x, tier);
+}
+
+FMATH_INLINE float fmath_sqrtf_impl(float x, fmath_precision tier) {
+	if (tier == FMATH_PRECISION_ACCURATE) return sqrtf(x);
+	if (x <= 0.0f) {
+		if (x == 0.0f) return 0.0f;
+		return NAN;
+	}
+	return x * fmath_rsqrtf_impl(x, tier);
+}
+
+// asin(t) for the reduced argument of fmath_asinf_impl and fmath_acosf_impl: t = |x| up
+// to 1/2, else t = sqrt(z) with z = (1 - |x|) / 2, exact, in [0, 1/4]. That sqrt is
+// z * rsqrt(z) plus one Newton correction of the product, so the fast tier's single
+// rsqrt step still gives ~5e-6 and the balanced tier's two the last bit; hardware sqrt
+// when accurate. Either way t <= 1/2 and asin(t) = t * q(t^2).
+FMATH_INLINE float fmath_asin_reduced(float a, int big, fmath_precision tier) {
+	float z = big ? 0.5f - 0.5f * a : a * a;
+	float t = a;
+	if (big) {
+		if (tier == FMATH_PRECISION_ACCURATE) {
+			t = sqrtf(z);
+		} else {
+			float y = fmath_rsqrt_core(z, tier);
+			float s = z * y;
+			t = s + 0.5f * y * (z - s * s);
+		}
+	}
+	float q = tier == FMATH_PRECISION_FAST       ? FMATH_POLY(z, fmath_asin_poly_fast)
+	          : tier == FMATH_PRECISION_BALANCED ? FMATH_POLY(z, fmath_asin_poly_balanced)
+	                                             : FMATH_POLY(z, fmath_asin_poly_accurate);
+	return t * q;
+}
+
+// asin(|x|) = pi/2 - 2 asin(sqrt((1 - |x|) / 2)) above 1/2: one sqrt, no division. |x| > 1
+// gives NaN by the bits, like NaN x, so finite-math folding cannot drop the check.
+FMATH_INLINE float fmath_asinf_impl(float x, fmath_precision tier) {
+	uint32_t ai = fmath_bitcast_f32_to_u32(x) & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	int big = a > 0.5f;
+	float p = fmath_asin_reduced(a, big, tier);
+	float r = fmath_with_sign_of(big ? FMATH_HALF_PI - 2.0f * p : p, x);
+	return ai > 0x3f800000u ? (ai > 0x7f800000u ? x : NAN) : r;
+}
+
+// acos(x) = pi/2 - asin(x) up to |x| = 1/2; above, 2 asin(sqrt((1 - |x|) / 2)), taken from
+// pi for negative x. Small results near x = 1 keep their relative accuracy.
+FMATH_INLINE float fmath_acosf_impl(float x, fmath_precision tier) {
+	uint32_t xi = fmath_bitcast_f32_to_u32(x), ai = xi & 0x7fffffffu;
+	float a = fmath_bitcast_u32_to_f32(ai);
+	int big = a > 0.5f;
+	float p = fmath_asin_reduced(a, big, tier);
+	float r = !big ? FMATH_HALF_PI - fmath_with_sign_of(p, x) : (xi >> 31) ? FMATH_PI - 2.0f * p : 2.0f * p;
+	return ai > 0x3f800000u ? (ai > 0x7f800000u ? x : NAN) : r;
+}
+
+FMATH_INLINE float fmath_rcpf_impl(float x) {
+	if (x == 0.0f) {
+#if defined(__GNUC__) || defined(__clang__)
+		return copysignf(INFINITY, x);
+#else
+		return (x < 0.0f) ? -INFINITY : INFINITY;
+#endif
+	}
+	// Fallback to hardware division; can be replaced with NR refine if desired
+	return 1.0f / x;
+}
+
+// The public scalar API, inline (fmath.h leaves out the out-of-line declarations). Tiered
+// functions run at the build's FMATH_PRECISION, as the out-of-line ones do.
+#if FMATH_INLINE_SCALAR && !defined(FMATH_BUILDING_LIBRARY)
+FMATH_INLINE float fmath_sinf(float x) {
+	return fmath_sinf_impl(x);
+}
+
+FMATH_INLINE float fmath_cosf(float x) {
+	return fmath_cosf_impl(x);
+}
+
+FMATH_INLINE float fmath_tanf(float x) {
+	return fmath_tanf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_atanf(float x) {
+	return fmath_atanf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_atan2f(float y, float x) {
+	return fmath_atan2f_impl(y, x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_asinf(float x) {
+	return fmath_asinf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_acosf(float x) {
+	return fmath_acosf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_expf(float x) {
+	return fmath_expf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_sinhf(float x) {
+	return fmath_sinhf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_coshf(float x) {
+	return fmath_coshf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_tanhf(float x) {
+	return fmath_tanhf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_logf(float x) {
+	return fmath_logf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_sqrtf(float x) {
+	return fmath_sqrtf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_rsqrtf(float x) {
+	return fmath_rsqrtf_impl(x, (fmath_precision)FMATH_PRECISION);
+}
+
+FMATH_INLINE float fmath_rcpf(float x) {
+	return fmath_rcpf_impl(x);
+}
+
+FMATH_INLINE void fmath_sincosf(float x, float *s, float *c) {
+	fmath_sincosf_impl(x, s, c);
+}
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FMATH_INLINE_H */
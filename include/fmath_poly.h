@@ -0,0 +1,88 @@
+// Generated by tools/gen_poly.c -- do not edit.
+// Minimax polynomial coefficients for the precision tiers, lowest order first, with
+// the max relative error of each approximation after rounding the coefficients to float.
+// Included by fmath_inline.h and the SIMD kernel files; one array per tier and function.
+
+#ifndef FMATH_POLY_H
+#define FMATH_POLY_H
+
+// exp: e^g on [-ln2/2, ln2/2]
+static const float fmath_exp_poly_fast[] = { /* 7.5e-05 */
+	0.999928057f, 1.00016415f, 0.504963279f, 0.165668428f,
+};
+static const float fmath_exp_poly_balanced[] = { /* 2.6e-06 */
+	0.999999285f, 0.999963403f, 0.500043571f, 0.167909071f, 0.0414586067f,
+};
+static const float fmath_exp_poly_accurate[] = { /* 1.7e-08 */
+	1.0f, 1.0f, 0.499999911f, 0.166664198f, 0.0416682251f, 0.00837481581f, 0.00138368458f,
+};
+
+// log: log1p(f) / f on [sqrt(1/2) - 1, sqrt(2) - 1]
+static const float fmath_log_poly_fast[] = { /* 5.0e-05 */
+	0.999966204f, -0.499450654f, 0.336388856f, -0.270945996f, 0.176580548f,
+};
+static const float fmath_log_poly_balanced[] = { /* 1.1e-06 */
+	1.00000095f, -0.500011146f, 0.333145082f, -0.249097437f, 0.204963282f, -0.186678544f, 0.118961081f,
+};
+static const float fmath_log_poly_accurate[] = { /* 5.8e-08 */
+	1.0f, -0.499999881f, 0.333341867f, -0.250020742f, 0.199568331f, -0.165623933f, 0.149522662f,
+	-0.143668458f, 0.0872235969f,
+};
+
+// tan: tan(r) / r in z = r^2 on [0, (pi/4)^2]
+static const float fmath_tan_poly_fast[] = { /* 4.4e-05 */
+	0.999955833f, 0.335582882f, 0.115975872f, 0.0941305831f,
+};
+static const float fmath_tan_poly_balanced[] = { /* 3.2e-06 */
+	1.00000322f, 0.333079815f, 0.136517242f, 0.0403983742f, 0.0438206717f,
+};
+static const float fmath_tan_poly_accurate[] = { /* 3.5e-08 */
+	1.0f, 0.33333075f, 0.133398905f, 0.0533491299f, 0.0246008728f, 0.00289575569f, 0.00949828885f,
+};
+
+// atan: atan(t) / t in z = t^2 on [0, 1]
+static const float fmath_atan_poly_fast[] = { /* 3.0e-05 */
+	0.999970019f, -0.331700832f, 0.185215682f, -0.0919265822f, 0.0238634069f,
+};
+static const float fmath_atan_poly_balanced[] = { /* 6.6e-07 */
+	0.999999344f, -0.333265156f, 0.198814824f, -0.134871915f, 0.0838711932f, -0.0370130017f, 0.00786337722f,
+};
+static const float fmath_atan_poly_accurate[] = { /* 6.3e-08 */
+	1.0f, -0.333330721f, 0.199926198f, -0.142036438f, 0.106409341f, -0.0750429481f, 0.0426915213f,
+	-0.0160686299f, 0.00284988969f,
+};
+
+// asin: asin(t) / t in z = t^2 on [0, 1/4]
+static const float fmath_asin_poly_fast[] = { /* 3.1e-05 */
+	1.00003111f, 0.164538801f, 0.0959882289f,
+};
+static const float fmath_asin_poly_balanced[] = { /* 1.5e-06 */
+	0.99999851f, 0.166852191f, 0.0714840069f, 0.0650675744f,
+};
+static const float fmath_asin_poly_accurate[] = { /* 1.0e-08 */
+	1.0f, 0.166667908f, 0.0749443471f, 0.0455501862f, 0.0238581691f, 0.042635642f,
+};
+
+// sinh: sinh(x) / x in z = x^2 on [0, 1/4]
+static const float fmath_sinh_poly_fast[] = { /* 6.4e-05 */
+	0.999935687f, 0.168751583f,
+};
+static const float fmath_sinh_poly_balanced[] = { /* 1.2e-07 */
+	1.00000012f, 0.166659713f, 0.00840779301f,
+};
+static const float fmath_sinh_poly_accurate[] = { /* 1.4e-09 */
+	1.0f, 0.166666672f, 0.00833311863f, 0.000199791495f,
+};
+
+// cosh: cosh(x) in z = x^2 on [0, 1/4]
+static const float fmath_cosh_poly_fast[] = { /* 6.9e-07 */
+	1.0000006f, 0.499952108f, 0.0421850607f,
+};
+static const float fmath_cosh_poly_balanced[] = { /* 6.3e-09 */
+	1.0f, 0.500000119f, 0.0416647531f, 0.00140124559f,
+};
+static const float fmath_cosh_poly_accurate[] = { /* 1.1e-10 */
+	1.0f, 0.5f, 0.0416666716f, 0.00138885155f, 2.49733275e-05f,
+};
+
+#endif /* FMATH_POLY_H */
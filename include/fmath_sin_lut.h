@@ -0,0 +1,2625 @@
+// Generated by tools/gen_sin_lut.c -- do not edit.
+// sin(2*pi*i/N), N = 2^FMATH_TABLE_BITS: i = 0..N/4 in quarter-wave mode, else
+// i = 0..N (entry N closes the period); in Hermite mode {sin, (2*pi/N) * cos} pairs,
+// i = 0..N. Included inside the initializer of fmath_sin_lut in fmath_inline.h.
+
+#if FMATH_SIN_HERMITE
+#if FMATH_TABLE_BITS == 4
+	0.0f, 0.392699093f, 0.382683426f, 0.362806648f, 0.707106769f, 0.277680188f, 0.923879504f, 0.150279433f,
+	1.0f, 0.0f, 0.923879504f, -0.150279433f, 0.707106769f, -0.277680188f, 0.382683426f, -0.362806648f,
+	0.0f, -0.392699093f, -0.382683426f, -0.362806648f, -0.707106769f, -0.277680188f, -0.923879504f, -0.150279433f,
+	-1.0f, 0.0f, -0.923879504f, 0.150279433f, -0.707106769f, 0.277680188f, -0.382683426f, 0.362806648f,
+	0.0f, 0.392699093f,
+#elif FMATH_TABLE_BITS == 5
+	0.0f, 0.196349546f, 0.195090324f, 0.192576736f, 0.382683426f, 0.181403324f, 0.555570245f, 0.163258672f,
+	0.707106769f, 0.138840094f, 0.831469595f, 0.109085962f, 0.923879504f, 0.0751397163f, 0.980785251f, 0.0383058935f,
+	1.0f, 0.0f, 0.980785251f, -0.0383058935f, 0.923879504f, -0.0751397163f, 0.831469595f, -0.109085962f,
+	0.707106769f, -0.138840094f, 0.555570245f, -0.163258672f, 0.382683426f, -0.181403324f, 0.195090324f, -0.192576736f,
+	0.0f, -0.196349546f, -0.195090324f, -0.192576736f, -0.382683426f, -0.181403324f, -0.555570245f, -0.163258672f,
+	-0.707106769f, -0.138840094f, -0.831469595f, -0.109085962f, -0.923879504f, -0.0751397163f, -0.980785251f, -0.0383058935f,
+	-1.0f, 0.0f, -0.980785251f, 0.0383058935f, -0.923879504f, 0.0751397163f, -0.831469595f, 0.109085962f,
+	-0.707106769f, 0.138840094f, -0.555570245f, 0.163258672f, -0.382683426f, 0.181403324f, -0.195090324f, 0.192576736f,
+	0.0f, 0.196349546f,
+#elif FMATH_TABLE_BITS == 6
+	0.0f, 0.0981747732f, 0.0980171412f, 0.0977020338f, 0.195090324f, 0.0962883681f, 0.290284663f, 0.0939473957f,
+	0.382683426f, 0.090701662f, 0.471396744f, 0.0865824148f, 0.555570245f, 0.0816293359f, 0.634393275f, 0.0758901238f,
+	0.707106769f, 0.0694200471f, 0.773010433f, 0.0622814149f, 0.831469595f, 0.0545429811f, 0.881921291f, 0.0462792665f,
+	0.923879504f, 0.0375698581f, 0.956940353f, 0.028498631f, 0.980785251f, 0.0191529468f, 0.99518472f, 0.00962281041f,
+	1.0f, 0.0f, 0.99518472f, -0.00962281041f, 0.980785251f, -0.0191529468f, 0.956940353f, -0.028498631f,
+	0.923879504f, -0.0375698581f, 0.881921291f, -0.0462792665f, 0.831469595f, -0.0545429811f, 0.773010433f, -0.0622814149f,
+	0.707106769f, -0.0694200471f, 0.634393275f, -0.0758901238f, 0.555570245f, -0.0816293359f, 0.471396744f, -0.0865824148f,
+	0.382683426f, -0.090701662f, 0.290284663f, -0.0939473957f, 0.195090324f, -0.0962883681f, 0.0980171412f, -0.0977020338f,
+	0.0f, -0.0981747732f, -0.0980171412f, -0.0977020338f, -0.195090324f, -0.0962883681f, -0.290284663f, -0.0939473957f,
+	-0.382683426f, -0.090701662f, -0.471396744f, -0.0865824148f, -0.555570245f, -0.0816293359f, -0.634393275f, -0.0758901238f,
+	-0.707106769f, -0.0694200471f, -0.773010433f, -0.0622814149f, -0.831469595f, -0.0545429811f, -0.881921291f, -0.0462792665f,
+	-0.923879504f, -0.0375698581f, -0.956940353f, -0.028498631f, -0.980785251f, -0.0191529468f, -0.99518472f, -0.00962281041f,
+	-1.0f, 0.0f, -0.99518472f, 0.00962281041f, -0.980785251f, 0.0191529468f, -0.956940353f, 0.028498631f,
+	-0.923879504f, 0.0375698581f, -0.881921291f, 0.0462792665f, -0.831469595f, 0.0545429811f, -0.773010433f, 0.0622814149f,
+	-0.707106769f, 0.0694200471f, -0.634393275f, 0.0758901238f, -0.555570245f, 0.0816293359f, -0.471396744f, 0.0865824148f,
+	-0.382683426f, 0.090701662f, -0.290284663f, 0.0939473957f, -0.195090324f, 0.0962883681f, -0.0980171412f, 0.0977020338f,
+	0.0f, 0.0981747732f,
+#elif FMATH_TABLE_BITS == 7
+	0.0f, 0.0490873866f, 0.0490676761f, 0.0490282588f, 0.0980171412f, 0.0488510169f, 0.146730468f, 0.0485560894f,
+	0.195090324f, 0.0481441841f, 0.242980182f, 0.0476162992f, 0.290284663f, 0.0469736978f, 0.336889863f, 0.046217937f,
+	0.382683426f, 0.045350831f, 0.427555084f, 0.0443744697f, 0.471396744f, 0.0432912074f, 0.514102757f, 0.0421036556f,
+	0.555570245f, 0.0408146679f, 0.59569931f, 0.0394273587f, 0.634393275f, 0.0379450619f, 0.671558976f, 0.036371354f,
+	0.707106769f, 0.0347100236f, 0.740951121f, 0.0329650715f, 0.773010433f, 0.0311407074f, 0.803207517f, 0.0292413216f,
+	0.831469595f, 0.0272714905f, 0.857728601f, 0.0252359603f, 0.881921291f, 0.0231396332f, 0.903989315f, 0.020987561f,
+	0.923879504f, 0.0187849291f, 0.941544056f, 0.0165370423f, 0.956940353f, 0.0142493155f, 0.970031261f, 0.0119272619f,
+	0.980785251f, 0.00957647339f, 0.989176512f, 0.0072026155f, 0.99518472f, 0.0048114052f, 0.99879545f, 0.0024086039f,
+	1.0f, 0.0f, 0.99879545f, -0.0024086039f, 0.99518472f, -0.0048114052f, 0.989176512f, -0.0072026155f,
+	0.980785251f, -0.00957647339f, 0.970031261f, -0.0119272619f, 0.956940353f, -0.0142493155f, 0.941544056f, -0.0165370423f,
+	0.923879504f, -0.0187849291f, 0.903989315f, -0.020987561f, 0.881921291f, -0.0231396332f, 0.857728601f, -0.0252359603f,
+	0.831469595f, -0.0272714905f, 0.803207517f, -0.0292413216f, 0.773010433f, -0.0311407074f, 0.740951121f, -0.0329650715f,
+	0.707106769f, -0.0347100236f, 0.671558976f, -0.036371354f, 0.634393275f, -0.0379450619f, 0.59569931f, -0.0394273587f,
+	0.555570245f, -0.0408146679f, 0.514102757f, -0.0421036556f, 0.471396744f, -0.0432912074f, 0.427555084f, -0.0443744697f,
+	0.382683426f, -0.045350831f, 0.336889863f, -0.046217937f, 0.290284663f, -0.0469736978f, 0.242980182f, -0.0476162992f,
+	0.195090324f, -0.0481441841f, 0.146730468f, -0.0485560894f, 0.0980171412f, -0.0488510169f, 0.0490676761f, -0.0490282588f,
+	0.0f, -0.0490873866f, -0.0490676761f, -0.0490282588f, -0.0980171412f, -0.0488510169f, -0.146730468f, -0.0485560894f,
+	-0.195090324f, -0.0481441841f, -0.242980182f, -0.0476162992f, -0.290284663f, -0.0469736978f, -0.336889863f, -0.046217937f,
+	-0.382683426f, -0.045350831f, -0.427555084f, -0.0443744697f, -0.471396744f, -0.0432912074f, -0.514102757f, -0.0421036556f,
+	-0.555570245f, -0.0408146679f, -0.59569931f, -0.0394273587f, -0.634393275f, -0.0379450619f, -0.671558976f, -0.036371354f,
+	-0.707106769f, -0.0347100236f, -0.740951121f, -0.0329650715f, -0.773010433f, -0.0311407074f, -0.803207517f, -0.0292413216f,
+	-0.831469595f, -0.0272714905f, -0.857728601f, -0.0252359603f, -0.881921291f, -0.0231396332f, -0.903989315f, -0.020987561f,
+	-0.923879504f, -0.0187849291f, -0.941544056f, -0.0165370423f, -0.956940353f, -0.0142493155f, -0.970031261f, -0.0119272619f,
+	-0.980785251f, -0.00957647339f, -0.989176512f, -0.0072026155f, -0.99518472f, -0.0048114052f, -0.99879545f, -0.0024086039f,
+	-1.0f, 0.0f, -0.99879545f, 0.0024086039f, -0.99518472f, 0.0048114052f, -0.989176512f, 0.0072026155f,
+	-0.980785251f, 0.00957647339f, -0.970031261f, 0.0119272619f, -0.956940353f, 0.0142493155f, -0.941544056f, 0.0165370423f,
+	-0.923879504f, 0.0187849291f, -0.903989315f, 0.020987561f, -0.881921291f, 0.0231396332f, -0.857728601f, 0.0252359603f,
+	-0.831469595f, 0.0272714905f, -0.803207517f, 0.0292413216f, -0.773010433f, 0.0311407074f, -0.740951121f, 0.0329650715f,
+	-0.707106769f, 0.0347100236f, -0.671558976f, 0.036371354f, -0.634393275f, 0.0379450619f, -0.59569931f, 0.0394273587f,
+	-0.555570245f, 0.0408146679f, -0.514102757f, 0.0421036556f, -0.471396744f, 0.0432912074f, -0.427555084f, 0.0443744697f,
+	-0.382683426f, 0.045350831f, -0.336889863f, 0.046217937f, -0.290284663f, 0.0469736978f, -0.242980182f, 0.0476162992f,
+	-0.195090324f, 0.0481441841f, -0.146730468f, 0.0485560894f, -0.0980171412f, 0.0488510169f, -0.0490676761f, 0.0490282588f,
+	0.0f, 0.0490873866f,
+#elif FMATH_TABLE_BITS == 8
+	0.0f, 0.0245436933f, 0.024541229f, 0.0245363005f, 0.0490676761f, 0.0245141294f, 0.0735645667f, 0.0244771913f,
+	0.0980171412f, 0.0244255085f, 0.122410677f, 0.0243591126f, 0.146730468f, 0.0242780447f, 0.170961887f, 0.0241823513f,
+	0.195090324f, 0.024072092f, 0.219101235f, 0.0239473339f, 0.242980182f, 0.0238081496f, 0.266712755f, 0.023654623f,
+	0.290284663f, 0.0234868489f, 0.313681751f, 0.0233049281f, 0.336889863f, 0.0231089685f, 0.359895051f, 0.0228990894f,
+	0.382683426f, 0.0226754155f, 0.405241311f, 0.0224380828f, 0.427555084f, 0.0221872348f, 0.449611336f, 0.0219230223f,
+	0.471396744f, 0.0216456037f, 0.492898196f, 0.0213551484f, 0.514102757f, 0.0210518278f, 0.534997642f, 0.0207358263f,
+	0.555570245f, 0.020407334f, 0.575808167f, 0.02006655f, 0.59569931f, 0.0197136793f, 0.615231574f, 0.0193489324f,
+	0.634393275f, 0.018972531f, 0.653172851f, 0.0185847003f, 0.671558976f, 0.018185677f, 0.689540565f, 0.0177756976f,
+	0.707106769f, 0.0173550118f, 0.724247098f, 0.0169238709f, 0.740951121f, 0.0164825357f, 0.757208824f, 0.0160312727f,
+	0.773010433f, 0.0155703537f, 0.78834641f, 0.0151000554f, 0.803207517f, 0.0146206608f, 0.817584813f, 0.0141324596f,
+	0.831469595f, 0.0136357453f, 0.84485358f, 0.0131308176f, 0.857728601f, 0.0126179801f, 0.870086968f, 0.0120975422f,
+	0.881921291f, 0.0115698166f, 0.893224299f, 0.011035122f, 0.903989315f, 0.0104937805f, 0.914209783f, 0.00994611811f,
+	0.923879504f, 0.00939246453f, 0.932992816f, 0.00883315317f, 0.941544056f, 0.00826852117f, 0.949528158f, 0.00769890798f,
+	0.956940353f, 0.00712465774f, 0.963776052f, 0.00654611597f, 0.970031261f, 0.00596363097f, 0.975702107f, 0.0053775534f,
+	0.980785251f, 0.00478823669f, 0.985277653f, 0.00419603614f, 0.989176512f, 0.00360130775f, 0.992479563f, 0.00300441007f,
+	0.99518472f, 0.0024057026f, 0.997290432f, 0.001805546f, 0.99879545f, 0.00120430195f, 0.999698818f, 0.000602332351f,
+	1.0f, 0.0f, 0.999698818f, -0.000602332351f, 0.99879545f, -0.00120430195f, 0.997290432f, -0.001805546f,
+	0.99518472f, -0.0024057026f, 0.992479563f, -0.00300441007f, 0.989176512f, -0.00360130775f, 0.985277653f, -0.00419603614f,
+	0.980785251f, -0.00478823669f, 0.975702107f, -0.0053775534f, 0.970031261f, -0.00596363097f, 0.963776052f, -0.00654611597f,
+	0.956940353f, -0.00712465774f, 0.949528158f, -0.00769890798f, 0.941544056f, -0.00826852117f, 0.932992816f, -0.00883315317f,
+	0.923879504f, -0.00939246453f, 0.914209783f, -0.00994611811f, 0.903989315f, -0.0104937805f, 0.893224299f, -0.011035122f,
+	0.881921291f, -0.0115698166f, 0.870086968f, -0.0120975422f, 0.857728601f, -0.0126179801f, 0.84485358f, -0.0131308176f,
+	0.831469595f, -0.0136357453f, 0.817584813f, -0.0141324596f, 0.803207517f, -0.0146206608f, 0.78834641f, -0.0151000554f,
+	0.773010433f, -0.0155703537f, 0.757208824f, -0.0160312727f, 0.740951121f, -0.0164825357f, 0.724247098f, -0.0169238709f,
+	0.707106769f, -0.0173550118f, 0.689540565f, -0.0177756976f, 0.671558976f, -0.018185677f, 0.653172851f, -0.0185847003f,
+	0.634393275f, -0.018972531f, 0.615231574f, -0.0193489324f, 0.59569931f, -0.0197136793f, 0.575808167f, -0.02006655f,
+	0.555570245f, -0.020407334f, 0.534997642f, -0.0207358263f, 0.514102757f, -0.0210518278f, 0.492898196f, -0.0213551484f,
+	0.471396744f, -0.0216456037f, 0.449611336f, -0.0219230223f, 0.427555084f, -0.0221872348f, 0.405241311f, -0.0224380828f,
+	0.382683426f, -0.0226754155f, 0.359895051f, -0.0228990894f, 0.336889863f, -0.0231089685f, 0.313681751f, -0.0233049281f,
+	0.290284663f, -0.0234868489f, 0.266712755f, -0.023654623f, 0.242980182f, -0.0238081496f, 0.219101235f, -0.0239473339f,
+	0.195090324f, -0.024072092f, 0.170961887f, -0.0241823513f, 0.146730468f, -0.0242780447f, 0.122410677f, -0.0243591126f,
+	0.0980171412f, -0.0244255085f, 0.0735645667f, -0.0244771913f, 0.0490676761f, -0.0245141294f, 0.024541229f, -0.0245363005f,
+	0.0f, -0.0245436933f, -0.024541229f, -0.0245363005f, -0.0490676761f, -0.0245141294f, -0.0735645667f, -0.0244771913f,
+	-0.0980171412f, -0.0244255085f, -0.122410677f, -0.0243591126f, -0.146730468f, -0.0242780447f, -0.170961887f, -0.0241823513f,
+	-0.195090324f, -0.024072092f, -0.219101235f, -0.0239473339f, -0.242980182f, -0.0238081496f, -0.266712755f, -0.023654623f,
+	-0.290284663f, -0.0234868489f, -0.313681751f, -0.0233049281f, -0.336889863f, -0.0231089685f, -0.359895051f, -0.0228990894f,
+	-0.382683426f, -0.0226754155f, -0.405241311f, -0.0224380828f, -0.427555084f, -0.0221872348f, -0.449611336f, -0.0219230223f,
+	-0.471396744f, -0.0216456037f, -0.492898196f, -0.0213551484f, -0.514102757f, -0.0210518278f, -0.534997642f, -0.0207358263f,
+	-0.555570245f, -0.020407334f, -0.575808167f, -0.02006655f, -0.59569931f, -0.0197136793f, -0.615231574f, -0.0193489324f,
+	-0.634393275f, -0.018972531f, -0.653172851f, -0.0185847003f, -0.671558976f, -0.018185677f, -0.689540565f, -0.0177756976f,
+	-0.707106769f, -0.0173550118f, -0.724247098f, -0.0169238709f, -0.740951121f, -0.0164825357f, -0.757208824f, -0.0160312727f,
+	-0.773010433f, -0.0155703537f, -0.78834641f, -0.0151000554f, -0.803207517f, -0.0146206608f, -0.817584813f, -0.0141324596f,
+	-0.831469595f, -0.0136357453f, -0.84485358f, -0.0131308176f, -0.857728601f, -0.0126179801f, -0.870086968f, -0.0120975422f,
+	-0.881921291f, -0.0115698166f, -0.893224299f, -0.011035122f, -0.903989315f, -0.0104937805f, -0.914209783f, -0.00994611811f,
+	-0.923879504f, -0.00939246453f, -0.932992816f, -0.00883315317f, -0.941544056f, -0.00826852117f, -0.949528158f, -0.00769890798f,
+	-0.956940353f, -0.00712465774f, -0.963776052f, -0.00654611597f, -0.970031261f, -0.00596363097f, -0.975702107f, -0.0053775534f,
+	-0.980785251f, -0.00478823669f, -0.985277653f, -0.00419603614f, -0.989176512f, -0.00360130775f, -0.992479563f, -0.00300441007f,
+	-0.99518472f, -0.0024057026f, -0.997290432f, -0.001805546f, -0.99879545f, -0.00120430195f, -0.999698818f, -0.000602332351f,
+	-1.0f, 0.0f, -0.999698818f, 0.000602332351f, -0.99879545f, 0.00120430195f, -0.997290432f, 0.001805546f,
+	-0.99518472f, 0.0024057026f, -0.992479563f, 0.00300441007f, -0.989176512f, 0.00360130775f, -0.985277653f, 0.00419603614f,
+	-0.980785251f, 0.00478823669f, -0.975702107f, 0.0053775534f, -0.970031261f, 0.00596363097f, -0.963776052f, 0.00654611597f,
+	-0.956940353f, 0.00712465774f, -0.949528158f, 0.00769890798f, -0.941544056f, 0.00826852117f, -0.932992816f, 0.00883315317f,
+	-0.923879504f, 0.00939246453f, -0.914209783f, 0.00994611811f, -0.903989315f, 0.0104937805f, -0.893224299f, 0.011035122f,
+	-0.881921291f, 0.0115698166f, -0.870086968f, 0.0120975422f, -0.857728601f, 0.0126179801f, -0.84485358f, 0.0131308176f,
+	-0.831469595f, 0.0136357453f, -0.817584813f, 0.0141324596f, -0.803207517f, 0.0146206608f, -0.78834641f, 0.0151000554f,
+	-0.773010433f, 0.0155703537f, -0.757208824f, 0.0160312727f, -0.740951121f, 0.0164825357f, -0.724247098f, 0.0169238709f,
+	-0.707106769f, 0.0173550118f, -0.689540565f, 0.0177756976f, -0.671558976f, 0.018185677f, -0.653172851f, 0.0185847003f,
+	-0.634393275f, 0.018972531f, -0.615231574f, 0.0193489324f, -0.59569931f, 0.0197136793f, -0.575808167f, 0.02006655f,
+	-0.555570245f, 0.020407334f, -0.534997642f, 0.0207358263f, -0.514102757f, 0.0210518278f, -0.492898196f, 0.0213551484f,
+	-0.471396744f, 0.0216456037f, -0.449611336f, 0.0219230223f, -0.427555084f, 0.0221872348f, -0.405241311f, 0.0224380828f,
+	-0.382683426f, 0.0226754155f, -0.359895051f, 0.0228990894f, -0.336889863f, 0.0231089685f, -0.313681751f, 0.0233049281f,
+	-0.290284663f, 0.0234868489f, -0.266712755f, 0.023654623f, -0.242980182f, 0.0238081496f, -0.219101235f, 0.0239473339f,
+	-0.195090324f, 0.024072092f, -0.170961887f, 0.0241823513f, -0.146730468f, 0.0242780447f, -0.122410677f, 0.0243591126f,
+	-0.0980171412f, 0.0244255085f, -0.0735645667f, 0.0244771913f, -0.0490676761f, 0.0245141294f, -0.024541229f, 0.0245363005f,
+	0.0f, 0.0245436933f,
+#elif FMATH_TABLE_BITS == 9
+	0.0f, 0.0122718466f, 0.0122715384f, 0.0122709218f, 0.024541229f, 0.0122681502f, 0.0368072242f, 0.0122635309f,
+	0.0490676761f, 0.0122570647f, 0.061320737f, 0.0122487517f, 0.0735645667f, 0.0122385956f, 0.0857973099f, 0.0122265955f,
+	0.0980171412f, 0.0122127542f, 0.110222206f, 0.0121970735f, 0.122410677f, 0.0121795563f, 0.134580702f, 0.0121602053f,
+	0.146730468f, 0.0121390224f, 0.15885815f, 0.0121160112f, 0.170961887f, 0.0120911757f, 0.183039889f, 0.0120645193f,
+	0.195090324f, 0.012036046f, 0.207111374f, 0.0120057603f, 0.219101235f, 0.011973667f, 0.231058106f, 0.0119397696f,
+	0.242980182f, 0.0119040748f, 0.254865646f, 0.0118665863f, 0.266712755f, 0.0118273115f, 0.27851969f, 0.011786256f,
+	0.290284663f, 0.0117434245f, 0.302005947f, 0.0116988253f, 0.313681751f, 0.011652464f, 0.32531029f, 0.0116043482f,
+	0.336889863f, 0.0115544843f, 0.348418683f, 0.0115028806f, 0.359895051f, 0.0114495447f, 0.371317208f, 0.011394484f,
+	0.382683426f, 0.0113377078f, 0.393992037f, 0.0112792235f, 0.405241311f, 0.0112190414f, 0.416429549f, 0.0111571699f,
+	0.427555084f, 0.0110936174f, 0.438616246f, 0.011028395f, 0.449611336f, 0.0109615112f, 0.460538715f, 0.010892977f,
+	0.471396744f, 0.0108228019f, 0.482183784f, 0.0107509978f, 0.492898196f, 0.0106775742f, 0.50353837f, 0.0106025422f,
+	0.514102757f, 0.0105259139f, 0.524589658f, 0.0104477005f, 0.534997642f, 0.0103679132f, 0.545324981f, 0.0102865649f,
+	0.555570245f, 0.010203667f, 0.565731823f, 0.0101192333f, 0.575808167f, 0.010033275f, 0.585797846f, 0.00994580612f,
+	0.59569931f, 0.00985683966f, 0.605511069f, 0.00976638775f, 0.615231574f, 0.00967446622f, 0.624859512f, 0.00958108716f,
+	0.634393275f, 0.00948626548f, 0.643831551f, 0.00939001516f, 0.653172851f, 0.00929235015f, 0.662415802f, 0.0091932863f,
+	0.671558976f, 0.0090928385f, 0.680601001f, 0.00899102073f, 0.689540565f, 0.00888784882f, 0.698376238f, 0.00878333859f,
+	0.707106769f, 0.00867750589f, 0.715730846f, 0.00857036561f, 0.724247098f, 0.00846193545f, 0.732654274f, 0.00835223123f,
+	0.740951121f, 0.00824126787f, 0.749136388f, 0.00812906493f, 0.757208824f, 0.00801563635f, 0.765167236f, 0.00790100172f,
+	0.773010433f, 0.00778517686f, 0.780737221f, 0.00766817946f, 0.78834641f, 0.00755002769f, 0.795836926f, 0.0074307383f,
+	0.803207517f, 0.0073103304f, 0.81045717f, 0.00718882121f, 0.817584813f, 0.00706622982f, 0.824589312f, 0.00694257393f,
+	0.831469595f, 0.00681787264f, 0.838224709f, 0.00669214455f, 0.84485358f, 0.00656540878f, 0.851355195f, 0.00643768394f,
+	0.857728601f, 0.00630899007f, 0.863972843f, 0.00617934577f, 0.870086968f, 0.00604877109f, 0.876070082f, 0.0059172851f,
+	0.881921291f, 0.00578490831f, 0.887639642f, 0.00565166026f, 0.893224299f, 0.00551756099f, 0.898674488f, 0.00538263097f,
+	0.903989315f, 0.00524689024f, 0.909168005f, 0.00511035975f, 0.914209783f, 0.00497305905f, 0.919113874f, 0.00483500957f,
+	0.923879504f, 0.00469623227f, 0.928506076f, 0.00455674762f, 0.932992816f, 0.00441657659f, 0.937339008f, 0.00427574059f,
+	0.941544056f, 0.00413426058f, 0.945607305f, 0.00399215799f, 0.949528158f, 0.00384945399f, 0.953306019f, 0.00370617048f,
+	0.956940353f, 0.00356232887f, 0.960430503f, 0.00341795082f, 0.963776052f, 0.00327305798f, 0.966976464f, 0.00312767224f,
+	0.970031261f, 0.00298181549f, 0.972939968f, 0.0028355096f, 0.975702107f, 0.0026887767f, 0.97831738f, 0.00254163891f,
+	0.980785251f, 0.00239411835f, 0.983105481f, 0.00224623736f, 0.985277653f, 0.00209801807f, 0.987301409f, 0.00194948271f,
+	0.989176512f, 0.00180065387f, 0.990902662f, 0.00165155379f, 0.992479563f, 0.00150220504f, 0.993906975f, 0.00135262997f,
+	0.99518472f, 0.0012028513f, 0.996312618f, 0.00105289149f, 0.997290432f, 0.000902772998f, 0.998118103f, 0.000752518652f,
+	0.99879545f, 0.000602150976f, 0.999322355f, 0.000451692584f, 0.999698818f, 0.000301166176f, 0.999924719f, 0.000150594438f,
+	1.0f, 0.0f, 0.999924719f, -0.000150594438f, 0.999698818f, -0.000301166176f, 0.999322355f, -0.000451692584f,
+	0.99879545f, -0.000602150976f, 0.998118103f, -0.000752518652f, 0.997290432f, -0.000902772998f, 0.996312618f, -0.00105289149f,
+	0.99518472f, -0.0012028513f, 0.993906975f, -0.00135262997f, 0.992479563f, -0.00150220504f, 0.990902662f, -0.00165155379f,
+	0.989176512f, -0.00180065387f, 0.987301409f, -0.00194948271f, 0.985277653f, -0.00209801807f, 0.983105481f, -0.00224623736f,
+	0.980785251f, -0.00239411835f, 0.97831738f, -0.00254163891f, 0.975702107f, -0.0026887767f, 0.972939968f, -0.0028355096f,
+	0.970031261f, -0.00298181549f, 0.966976464f, -0.00312767224f, 0.963776052f, -0.00327305798f, 0.960430503f, -0.00341795082f,
+	0.956940353f, -0.00356232887f, 0.953306019f, -0.00370617048f, 0.949528158f, -0.00384945399f, 0.945607305f, -0.00399215799f,
+	0.941544056f, -0.00413426058f, 0.937339008f, -0.00427574059f, 0.932992816f, -0.00441657659f, 0.928506076f, -0.00455674762f,
+	0.923879504f, -0.00469623227f, 0.919113874f, -0.00483500957f, 0.914209783f, -0.00497305905f, 0.909168005f, -0.00511035975f,
+	0.903989315f, -0.00524689024f, 0.898674488f, -0.00538263097f, 0.893224299f, -0.00551756099f, 0.887639642f, -0.00565166026f,
+	0.881921291f, -0.00578490831f, 0.876070082f, -0.0059172851f, 0.870086968f, -0.00604877109f, 0.863972843f, -0.00617934577f,
+	0.857728601f, -0.00630899007f, 0.851355195f, -0.00643768394f, 0.84485358f, -0.00656540878f, 0.838224709f, -0.00669214455f,
+	0.831469595f, -0.00681787264f, 0.824589312f, -0.00694257393f, 0.817584813f, -0.00706622982f, 0.81045717f, -0.00718882121f,
+	0.803207517f, -0.0073103304f, 0.795836926f, -0.0074307383f, 0.78834641f, -0.00755002769f, 0.780737221f, -0.00766817946f,
+	0.773010433f, -0.00778517686f, 0.765167236f, -0.00790100172f, 0.757208824f, -0.00801563635f, 0.749136388f, -0.00812906493f,
+	0.740951121f, -0.00824126787f, 0.732654274f, -0.00835223123f, 0.724247098f, -0.00846193545f, 0.715730846f, -0.00857036561f,
+	0.707106769f, -0.00867750589f, 0.698376238f, -0.00878333859f, 0.689540565f, -0.00888784882f, 0.680601001f, -0.00899102073f,
+	0.671558976f, -0.0090928385f, 0.662415802f, -0.0091932863f, 0.653172851f, -0.00929235015f, 0.643831551f, -0.00939001516f,
+	0.634393275f, -0.00948626548f, 0.624859512f, -0.00958108716f, 0.615231574f, -0.00967446622f, 0.605511069f, -0.00976638775f,
+	0.59569931f, -0.00985683966f, 0.585797846f, -0.00994580612f, 0.575808167f, -0.010033275f, 0.565731823f, -0.0101192333f,
+	0.555570245f, -0.010203667f, 0.545324981f, -0.0102865649f, 0.534997642f, -0.0103679132f, 0.524589658f, -0.0104477005f,
+	0.514102757f, -0.0105259139f, 0.50353837f, -0.0106025422f, 0.492898196f, -0.0106775742f, 0.482183784f, -0.0107509978f,
+	0.471396744f, -0.0108228019f, 0.460538715f, -0.010892977f, 0.449611336f, -0.0109615112f, 0.438616246f, -0.011028395f,
+	0.427555084f, -0.0110936174f, 0.416429549f, -0.0111571699f, 0.405241311f, -0.0112190414f, 0.393992037f, -0.0112792235f,
+	0.382683426f, -0.0113377078f, 0.371317208f, -0.011394484f, 0.359895051f, -0.0114495447f, 0.348418683f, -0.0115028806f,
+	0.336889863f, -0.0115544843f, 0.32531029f, -0.0116043482f, 0.313681751f, -0.011652464f, 0.302005947f, -0.0116988253f,
+	0.290284663f, -0.0117434245f, 0.27851969f, -0.011786256f, 0.266712755f, -0.0118273115f, 0.254865646f, -0.0118665863f,
+	0.242980182f, -0.0119040748f, 0.231058106f, -0.0119397696f, 0.219101235f, -0.011973667f, 0.207111374f, -0.0120057603f,
+	0.195090324f, -0.012036046f, 0.183039889f, -0.0120645193f, 0.170961887f, -0.0120911757f, 0.15885815f, -0.0121160112f,
+	0.146730468f, -0.0121390224f, 0.134580702f, -0.0121602053f, 0.122410677f, -0.0121795563f, 0.110222206f, -0.0121970735f,
+	0.0980171412f, -0.0122127542f, 0.0857973099f, -0.0122265955f, 0.0735645667f, -0.0122385956f, 0.061320737f, -0.0122487517f,
+	0.0490676761f, -0.0122570647f, 0.0368072242f, -0.0122635309f, 0.024541229f, -0.0122681502f, 0.0122715384f, -0.0122709218f,
+	0.0f, -0.0122718466f, -0.0122715384f, -0.0122709218f, -0.024541229f, -0.0122681502f, -0.0368072242f, -0.0122635309f,
+	-0.0490676761f, -0.0122570647f, -0.061320737f, -0.0122487517f, -0.0735645667f, -0.0122385956f, -0.0857973099f, -0.0122265955f,
+	-0.0980171412f, -0.0122127542f, -0.110222206f, -0.0121970735f, -0.122410677f, -0.0121795563f, -0.134580702f, -0.0121602053f,
+	-0.146730468f, -0.0121390224f, -0.15885815f, -0.0121160112f, -0.170961887f, -0.0120911757f, -0.183039889f, -0.0120645193f,
+	-0.195090324f, -0.012036046f, -0.207111374f, -0.0120057603f, -0.219101235f, -0.011973667f, -0.231058106f, -0.0119397696f,
+	-0.242980182f, -0.0119040748f, -0.254865646f, -0.0118665863f, -0.266712755f, -0.0118273115f, -0.27851969f, -0.011786256f,
+	-0.290284663f, -0.0117434245f, -0.302005947f, -0.0116988253f, -0.313681751f, -0.011652464f, -0.32531029f, -0.0116043482f,
+	-0.336889863f, -0.0115544843f, -0.348418683f, -0.0115028806f, -0.359895051f, -0.0114495447f, -0.371317208f, -0.011394484f,
+	-0.382683426f, -0.0113377078f, -0.393992037f, -0.0112792235f, -0.405241311f, -0.0112190414f, -0.416429549f, -0.0111571699f,
+	-0.427555084f, -0.0110936174f, -0.438616246f, -0.011028395f, -0.449611336f, -0.0109615112f, -0.460538715f, -0.010892977f,
+	-0.471396744f, -0.0108228019f, -0.482183784f, -0.0107509978f, -0.492898196f, -0.0106775742f, -0.50353837f, -0.0106025422f,
+	-0.514102757f, -0.0105259139f, -0.524589658f, -0.0104477005f, -0.534997642f, -0.0103679132f, -0.545324981f, -0.0102865649f,
+	-0.555570245f, -0.010203667f, -0.565731823f, -0.0101192333f, -0.575808167f, -0.010033275f, -0.585797846f, -0.00994580612f,
+	-0.59569931f, -0.00985683966f, -0.605511069f, -0.00976638775f, -0.615231574f, -0.00967446622f, -0.624859512f, -0.00958108716f,
+	-0.634393275f, -0.00948626548f, -0.643831551f, -0.00939001516f, -0.653172851f, -0.00929235015f, -0.662415802f, -0.0091932863f,
+	-0.671558976f, -0.0090928385f, -0.680601001f, -0.00899102073f, -0.689540565f, -0.00888784882f, -0.698376238f, -0.00878333859f,
+	-0.707106769f, -0.00867750589f, -0.715730846f, -0.00857036561f, -0.724247098f, -0.00846193545f, -0.732654274f, -0.00835223123f,
+	-0.740951121f, -0.00824126787f, -0.749136388f, -0.00812906493f, -0.757208824f, -0.00801563635f, -0.765167236f, -0.00790100172f,
+	-0.773010433f, -0.00778517686f, -0.780737221f, -0.00766817946f, -0.78834641f, -0.00755002769f, -0.795836926f, -0.0074307383f,
+	-0.803207517f, -0.0073103304f, -0.81045717f, -0.00718882121f, -0.817584813f, -0.00706622982f, -0.824589312f, -0.00694257393f,
+	-0.831469595f, -0.00681787264f, -0.838224709f, -0.00669214455f, -0.84485358f, -0.00656540878f, -0.851355195f, -0.00643768394f,
+	-0.857728601f, -0.00630899007f, -0.863972843f, -0.00617934577f, -0.870086968f, -0.00604877109f, -0.876070082f, -0.0059172851f,
+	-0.881921291f, -0.00578490831f, -0.887639642f, -0.00565166026f, -0.893224299f, -0.00551756099f, -0.898674488f, -0.00538263097f,
+	-0.903989315f, -0.00524689024f, -0.909168005f, -0.00511035975f, -0.914209783f, -0.00497305905f, -0.919113874f, -0.00483500957f,
+	-0.923879504f, -0.00469623227f, -0.928506076f, -0.00455674762f, -0.932992816f, -0.00441657659f, -0.937339008f, -0.00427574059f,
+	-0.941544056f, -0.00413426058f, -0.945607305f, -0.00399215799f, -0.949528158f, -0.00384945399f, -0.953306019f, -0.00370617048f,
+	-0.956940353f, -0.00356232887f, -0.960430503f, -0.00341795082f, -0.963776052f, -0.00327305798f, -0.966976464f, -0.00312767224f,
+	-0.970031261f, -0.00298181549f, -0.972939968f, -0.0028355096f, -0.975702107f, -0.0026887767f, -0.97831738f, -0.00254163891f,
+	-0.980785251f, -0.00239411835f, -0.983105481f, -0.00224623736f, -0.985277653f, -0.00209801807f, -0.987301409f, -0.00194948271f,
+	-0.989176512f, -0.00180065387f, -0.990902662f, -0.00165155379f, -0.992479563f, -0.00150220504f, -0.993906975f, -0.00135262997f,
+	-0.99518472f, -0.0012028513f, -0.996312618f, -0.00105289149f, -0.997290432f, -0.000902772998f, -0.998118103f, -0.000752518652f,
+	-0.99879545f, -0.000602150976f, -0.999322355f, -0.000451692584f, -0.999698818f, -0.000301166176f, -0.999924719f, -0.000150594438f,
+	-1.0f, 0.0f, -0.999924719f, 0.000150594438f, -0.999698818f, 0.000301166176f, -0.999322355f, 0.000451692584f,
+	-0.99879545f, 0.000602150976f, -0.998118103f, 0.000752518652f, -0.997290432f, 0.000902772998f, -0.996312618f, 0.00105289149f,
+	-0.99518472f, 0.0012028513f, -0.993906975f, 0.00135262997f, -0.992479563f, 0.00150220504f, -0.990902662f, 0.00165155379f,
+	-0.989176512f, 0.00180065387f, -0.987301409f, 0.00194948271f, -0.985277653f, 0.00209801807f, -0.983105481f, 0.00224623736f,
+	-0.980785251f, 0.00239411835f, -0.97831738f, 0.00254163891f, -0.975702107f, 0.0026887767f, -0.972939968f, 0.0028355096f,
+	-0.970031261f, 0.00298181549f, -0.966976464f, 0.00312767224f, -0.963776052f, 0.00327305798f, -0.960430503f, 0.00341795082f,
+	-0.956940353f, 0.00356232887f, -0.953306019f, 0.00370617048f, -0.949528158f, 0.00384945399f, -0.945607305f, 0.00399215799f,
+	-0.941544056f, 0.00413426058f, -0.937339008f, 0.00427574059f, -0.932992816f, 0.00441657659f, -0.928506076f, 0.00455674762f,
+	-0.923879504f, 0.00469623227f, -0.919113874f, 0.00483500957f, -0.914209783f, 0.00497305905f, -0.909168005f, 0.00511035975f,
+	-0.903989315f, 0.00524689024f, -0.898674488f, 0.00538263097f, -0.893224299f, 0.00551756099f, -0.887639642f, 0.00565166026f,
+	-0.881921291f, 0.00578490831f, -0.876070082f, 0.0059172851f, -0.870086968f, 0.00604877109f, -0.863972843f, 0.00617934577f,
+	-0.857728601f, 0.00630899007f, -0.851355195f, 0.00643768394f, -0.84485358f, 0.00656540878f, -0.838224709f, 0.00669214455f,
+	-0.831469595f, 0.00681787264f, -0.824589312f, 0.00694257393f, -0.817584813f, 0.00706622982f, -0.81045717f, 0.00718882121f,
+	-0.803207517f, 0.0073103304f, -0.795836926f, 0.0074307383f, -0.78834641f, 0.00755002769f, -0.780737221f, 0.00766817946f,
+	-0.773010433f, 0.00778517686f, -0.765167236f, 0.00790100172f, -0.757208824f, 0.00801563635f, -0.749136388f, 0.00812906493f,
+	-0.740951121f, 0.00824126787f, -0.732654274f, 0.00835223123f, -0.724247098f, 0.00846193545f, -0.715730846f, 0.00857036561f,
+	-0.707106769f, 0.00867750589f, -0.698376238f, 0.00878333859f, -0.689540565f, 0.00888784882f, -0.680601001f, 0.00899102073f,
+	-0.671558976f, 0.0090928385f, -0.662415802f, 0.0091932863f, -0.653172851f, 0.00929235015f, -0.643831551f, 0.00939001516f,
+	-0.634393275f, 0.00948626548f, -0.624859512f, 0.00958108716f, -0.615231574f, 0.00967446622f, -0.605511069f, 0.00976638775f,
+	-0.59569931f, 0.00985683966f, -0.585797846f, 0.00994580612f, -0.575808167f, 0.010033275f, -0.565731823f, 0.0101192333f,
+	-0.555570245f, 0.010203667f, -0.545324981f, 0.0102865649f, -0.534997642f, 0.0103679132f, -0.524589658f, 0.0104477005f,
+	-0.514102757f, 0.0105259139f, -0.50353837f, 0.0106025422f, -0.492898196f, 0.0106775742f, -0.482183784f, 0.0107509978f,
+	-0.471396744f, 0.0108228019f, -0.460538715f, 0.010892977f, -0.449611336f, 0.0109615112f, -0.438616246f, 0.011028395f,
+	-0.427555084f, 0.0110936174f, -0.416429549f, 0.0111571699f, -0.405241311f, 0.0112190414f, -0.393992037f, 0.0112792235f,
+	-0.382683426f, 0.0113377078f, -0.371317208f, 0.011394484f, -0.359895051f, 0.0114495447f, -0.348418683f, 0.0115028806f,
+	-0.336889863f, 0.0115544843f, -0.32531029f, 0.0116043482f, -0.313681751f, 0.011652464f, -0.302005947f, 0.0116988253f,
+	-0.290284663f, 0.0117434245f, -0.27851969f, 0.011786256f, -0.266712755f, 0.0118273115f, -0.254865646f, 0.0118665863f,
+	-0.242980182f, 0.0119040748f, -0.231058106f, 0.0119397696f, -0.219101235f, 0.011973667f, -0.207111374f, 0.0120057603f,
+	-0.195090324f, 0.012036046f, -0.183039889f, 0.0120645193f, -0.170961887f, 0.0120911757f, -0.15885815f, 0.0121160112f,
+	-0.146730468f, 0.0121390224f, -0.134580702f, 0.0121602053f, -0.122410677f, 0.0121795563f, -0.110222206f, 0.0121970735f,
+	-0.0980171412f, 0.0122127542f, -0.0857973099f, 0.0122265955f, -0.0735645667f, 0.0122385956f, -0.061320737f, 0.0122487517f,
+	-0.0490676761f, 0.0122570647f, -0.0368072242f, 0.0122635309f, -0.024541229f, 0.0122681502f, -0.0122715384f, 0.0122709218f,
+	0.0f, 0.0122718466f,
+#elif FMATH_TABLE_BITS == 10
+	0.0f, 0.00613592332f, 0.00613588467f, 0.00613580784f, 0.0122715384f, 0.00613546092f, 0.0184067301f, 0.0061348835f,
+	0.024541229f, 0.00613407511f, 0.030674804f, 0.00613303576f, 0.0368072242f, 0.00613176543f, 0.0429382585f, 0.00613026414f,
+	0.0490676761f, 0.00612853235f, 0.0551952459f, 0.00612656958f, 0.061320737f, 0.00612437585f, 0.0674439222f, 0.00612195209f,
+	0.0735645667f, 0.00611929782f, 0.0796824396f, 0.00611641258f, 0.0857973099f, 0.00611329777f, 0.0919089541f, 0.00610995246f,
+	0.0980171412f, 0.00610637711f, 0.104121633f, 0.00610257173f, 0.110222206f, 0.00609853677f, 0.116318628f, 0.00609427225f,
+	0.122410677f, 0.00608977815f, 0.128498107f, 0.00608505495f, 0.134580702f, 0.00608010264f, 0.140658244f, 0.00607492123f,
+	0.146730468f, 0.00606951118f, 0.152797192f, 0.00606387248f, 0.15885815f, 0.00605800562f, 0.164913118f, 0.00605191058f,
+	0.170961887f, 0.00604558783f, 0.177004218f, 0.00603903737f, 0.183039889f, 0.00603225967f, 0.18906866f, 0.00602525473f,
+	0.195090324f, 0.00601802301f, 0.201104641f, 0.00601056498f, 0.207111374f, 0.00600288017f, 0.213110313f, 0.00599496951f,
+	0.219101235f, 0.00598683348f, 0.225083917f, 0.0059784716f, 0.231058106f, 0.00596988481f, 0.237023607f, 0.0059610731f,
+	0.242980182f, 0.00595203741f, 0.248927608f, 0.00594277726f, 0.254865646f, 0.00593329314f, 0.260794103f, 0.00592358597f,
+	0.266712755f, 0.00591365574f, 0.272621363f, 0.00590350293f, 0.27851969f, 0.00589312799f, 0.284407526f, 0.00588253094f,
+	0.290284663f, 0.00587171223f, 0.296150893f, 0.0058606728f, 0.302005947f, 0.00584941264f, 0.307849646f, 0.00583793223f,
+	0.313681751f, 0.00582623202f, 0.319502026f, 0.00581431249f, 0.32531029f, 0.0058021741f, 0.331106305f, 0.00578981685f,
+	0.336889863f, 0.00577724213f, 0.342660725f, 0.00576444948f, 0.348418683f, 0.0057514403f, 0.354163527f, 0.00573821412f,
+	0.359895051f, 0.00572477235f, 0.365612984f, 0.0057111145f, 0.371317208f, 0.00569724198f, 0.377007425f, 0.0056831548f,
+	0.382683426f, 0.00566885388f, 0.388345033f, 0.00565433921f, 0.393992037f, 0.00563961174f, 0.399624199f, 0.0056246724f,
+	0.405241311f, 0.00560952071f, 0.410843164f, 0.00559415808f, 0.416429549f, 0.00557858497f, 0.422000259f, 0.00556280138f,
+	0.427555084f, 0.00554680871f, 0.433093816f, 0.00553060742f, 0.438616246f, 0.00551419752f, 0.444122136f, 0.00549757993f,
+	0.449611336f, 0.00548075559f, 0.455083579f, 0.00546372496f, 0.460538715f, 0.0054464885f, 0.465976506f, 0.00542904716f,
+	0.471396744f, 0.00541140093f, 0.47679922f, 0.00539355166f, 0.482183784f, 0.00537549891f, 0.487550169f, 0.00535724359f,
+	0.492898196f, 0.0053387871f, 0.498227656f, 0.00532012898f, 0.50353837f, 0.0053012711f, 0.50883013f, 0.00528221345f,
+	0.514102757f, 0.00526295695f, 0.519356012f, 0.00524350209f, 0.524589658f, 0.00522385025f, 0.529803634f, 0.00520400144f,
+	0.534997642f, 0.00518395659f, 0.540171444f, 0.00516371662f, 0.545324981f, 0.00514328247f, 0.550457954f, 0.00512265461f,
+	0.555570245f, 0.00510183349f, 0.560661554f, 0.00508082099f, 0.565731823f, 0.00505961664f, 0.570780754f, 0.00503822183f,
+	0.575808167f, 0.0050166375f, 0.580813944f, 0.00499486458f, 0.585797846f, 0.00497290306f, 0.590759695f, 0.00495075481f,
+	0.59569931f, 0.00492841983f, 0.600616455f, 0.00490589906f, 0.605511069f, 0.00488319388f, 0.610382795f, 0.00486030523f,
+	0.615231574f, 0.00483723311f, 0.620057225f, 0.00481397891f, 0.624859512f, 0.00479054358f, 0.629638255f, 0.00476692803f,
+	0.634393275f, 0.00474313274f, 0.639124453f, 0.0047191591f, 0.643831551f, 0.00469500758f, 0.64851439f, 0.00467067957f,
+	0.653172851f, 0.00464617508f, 0.657806695f, 0.00462149642f, 0.662415802f, 0.00459664315f, 0.666999936f, 0.00457161712f,
+	0.671558976f, 0.00454641925f, 0.676092684f, 0.00452105002f, 0.680601001f, 0.00449551037f, 0.685083687f, 0.00446980167f,
+	0.689540565f, 0.00444392441f, 0.693971455f, 0.00441787997f, 0.698376238f, 0.0043916693f, 0.702754736f, 0.00436529331f,
+	0.707106769f, 0.00433875294f, 0.711432219f, 0.00431204913f, 0.715730846f, 0.0042851828f, 0.720002532f, 0.00425815536f,
+	0.724247098f, 0.00423096772f, 0.728464365f, 0.00420362083f, 0.732654274f, 0.00417611562f, 0.736816585f, 0.00414845301f,
+	0.740951121f, 0.00412063394f, 0.745057762f, 0.00409266027f, 0.749136388f, 0.00406453246f, 0.753186822f, 0.00403625146f,
+	0.757208824f, 0.00400781818f, 0.761202395f, 0.00397923449f, 0.765167236f, 0.00395050086f, 0.769103348f, 0.00392161869f,
+	0.773010433f, 0.00389258843f, 0.77688849f, 0.00386341196f, 0.780737221f, 0.00383408973f, 0.784556568f, 0.00380462338f,
+	0.78834641f, 0.00377501384f, 0.792106569f, 0.00374526205f, 0.795836926f, 0.00371536915f, 0.799537241f, 0.00368533656f,
+	0.803207517f, 0.0036551652f, 0.806847572f, 0.00362485624f, 0.81045717f, 0.00359441061f, 0.81403631f, 0.0035638297f,
+	0.817584813f, 0.00353311491f, 0.8211025f, 0.00350226671f, 0.824589312f, 0.00347128697f, 0.82804507f, 0.00344017637f,
+	0.831469595f, 0.00340893632f, 0.834862888f, 0.00337756774f, 0.838224709f, 0.00334607228f, 0.841554999f, 0.00331445062f,
+	0.84485358f, 0.00328270439f, 0.848120332f, 0.0032508343f, 0.851355195f, 0.00321884197f, 0.854557991f, 0.00318672834f,
+	0.857728601f, 0.00315449503f, 0.860866964f, 0.00312214275f, 0.863972843f, 0.00308967289f, 0.867046237f, 0.00305708661f,
+	0.870086968f, 0.00302438554f, 0.873094976f, 0.00299157039f, 0.876070082f, 0.00295864255f, 0.879012227f, 0.00292560342f,
+	0.881921291f, 0.00289245415f, 0.884797096f, 0.00285919593f, 0.887639642f, 0.00282583013f, 0.890448749f, 0.00279235793f,
+	0.893224299f, 0.00275878049f, 0.895966232f, 0.00272509945f, 0.898674488f, 0.00269131549f, 0.901348829f, 0.00265743048f,
+	0.903989315f, 0.00262344512f, 0.906595707f, 0.00258936128f, 0.909168005f, 0.00255517988f, 0.91170603f, 0.00252090208f,
+	0.914209783f, 0.00248652953f, 0.916679084f, 0.00245206337f, 0.919113874f, 0.00241750479f, 0.921514034f, 0.0023828554f,
+	0.923879504f, 0.00234811613f, 0.926210225f, 0.00231328839f, 0.928506076f, 0.00227837381f, 0.93076694f, 0.00224337331f,
+	0.932992816f, 0.00220828829f, 0.935183525f, 0.00217312016f, 0.937339008f, 0.00213787029f, 0.939459205f, 0.00210253987f,
+	0.941544056f, 0.00206713029f, 0.943593442f, 0.00203164294f, 0.945607305f, 0.00199607899f, 0.947585583f, 0.00196043984f,
+	0.949528158f, 0.001924727f, 0.95143503f, 0.00188894174f, 0.953306019f, 0.00185308524f, 0.955141187f, 0.00181715912f,
+	0.956940353f, 0.00178116444f, 0.958703458f, 0.00174510281f, 0.960430503f, 0.00170897541f, 0.962121427f, 0.00167278363f,
+	0.963776052f, 0.00163652899f, 0.965394437f, 0.00160021265f, 0.966976464f, 0.00156383612f, 0.968522072f, 0.00152740069f,
+	0.970031261f, 0.00149090774f, 0.971503913f, 0.00145435869f, 0.972939968f, 0.0014177548f, 0.974339366f, 0.00138109759f,
+	0.975702107f, 0.00134438835f, 0.977028131f, 0.00130762858f, 0.97831738f, 0.00127081946f, 0.979569793f, 0.0012339626f,
+	0.980785251f, 0.00119705917f, 0.981963873f, 0.00116011081f, 0.983105481f, 0.00112311868f, 0.984210074f, 0.00108608429f,
+	0.985277653f, 0.00104900904f, 0.986308098f, 0.0010118942f, 0.987301409f, 0.000974741357f, 0.988257587f, 0.000937551784f,
+	0.989176512f, 0.000900326937f, 0.990058184f, 0.000863068155f, 0.990902662f, 0.000825776893f, 0.991709769f, 0.000788454548f,
+	0.992479563f, 0.000751102518f, 0.993211925f, 0.000713722198f, 0.993906975f, 0.000676314987f, 0.994564593f, 0.000638882339f,
+	0.99518472f, 0.000601425651f, 0.995767415f, 0.00056394632f, 0.996312618f, 0.000526445743f, 0.996820271f, 0.000488925318f,
+	0.997290432f, 0.000451386499f, 0.997723043f, 0.000413830712f, 0.998118103f, 0.000376259326f, 0.998475552f, 0.000338673766f,
+	0.99879545f, 0.000301075488f, 0.999077737f, 0.00026346583f, 0.999322355f, 0.000225846292f, 0.999529421f, 0.000188218241f,
+	0.999698818f, 0.000150583088f, 0.999830604f, 0.000112942282f, 0.999924719f, 7.52972192e-05f, 0.999981165f, 3.76493153e-05f,
+	1.0f, 0.0f, 0.999981165f, -3.76493153e-05f, 0.999924719f, -7.52972192e-05f, 0.999830604f, -0.000112942282f,
+	0.999698818f, -0.000150583088f, 0.999529421f, -0.000188218241f, 0.999322355f, -0.000225846292f, 0.999077737f, -0.00026346583f,
+	0.99879545f, -0.000301075488f, 0.998475552f, -0.000338673766f, 0.998118103f, -0.000376259326f, 0.997723043f, -0.000413830712f,
+	0.997290432f, -0.000451386499f, 0.996820271f, -0.000488925318f, 0.996312618f, -0.000526445743f, 0.995767415f, -0.00056394632f,
+	0.99518472f, -0.000601425651f, 0.994564593f, -0.000638882339f, 0.993906975f, -0.000676314987f, 0.993211925f, -0.000713722198f,
+	0.992479563f, -0.000751102518f, 0.991709769f, -0.000788454548f, 0.990902662f, -0.000825776893f, 0.990058184f, -0.000863068155f,
+	0.989176512f, -0.000900326937f, 0.988257587f, -0.000937551784f, 0.987301409f, -0.000974741357f, 0.986308098f, -0.0010118942f,
+	0.985277653f, -0.00104900904f, 0.984210074f, -0.00108608429f, 0.983105481f, -0.00112311868f, 0.981963873f, -0.00116011081f,
+	0.980785251f, -0.00119705917f, 0.979569793f, -0.0012339626f, 0.97831738f, -0.00127081946f, 0.977028131f, -0.00130762858f,
+	0.975702107f, -0.00134438835f, 0.974339366f, -0.00138109759f, 0.972939968f, -0.0014177548f, 0.971503913f, -0.00145435869f,
+	0.970031261f, -0.00149090774f, 0.968522072f, -0.00152740069f, 0.966976464f, -0.00156383612f, 0.965394437f, -0.00160021265f,
+	0.963776052f, -0.00163652899f, 0.962121427f, -0.00167278363f, 0.960430503f, -0.00170897541f, 0.958703458f, -0.00174510281f,
+	0.956940353f, -0.00178116444f, 0.955141187f, -0.00181715912f, 0.953306019f, -0.00185308524f, 0.95143503f, -0.00188894174f,
+	0.949528158f, -0.001924727f, 0.947585583f, -0.00196043984f, 0.945607305f, -0.00199607899f, 0.943593442f, -0.00203164294f,
+	0.941544056f, -0.00206713029f, 0.939459205f, -0.00210253987f, 0.937339008f, -0.00213787029f, 0.935183525f, -0.00217312016f,
+	0.932992816f, -0.00220828829f, 0.93076694f, -0.00224337331f, 0.928506076f, -0.00227837381f, 0.926210225f, -0.00231328839f,
+	0.923879504f, -0.00234811613f, 0.921514034f, -0.0023828554f, 0.919113874f, -0.00241750479f, 0.916679084f, -0.00245206337f,
+	0.914209783f, -0.00248652953f, 0.91170603f, -0.00252090208f, 0.909168005f, -0.00255517988f, 0.906595707f, -0.00258936128f,
+	0.903989315f, -0.00262344512f, 0.901348829f, -0.00265743048f, 0.898674488f, -0.00269131549f, 0.895966232f, -0.00272509945f,
+	0.893224299f, -0.00275878049f, 0.890448749f, -0.00279235793f, 0.887639642f, -0.00282583013f, 0.884797096f, -0.00285919593f,
+	0.881921291f, -0.00289245415f, 0.879012227f, -0.00292560342f, 0.876070082f, -0.00295864255f, 0.873094976f, -0.00299157039f,
+	0.870086968f, -0.00302438554f, 0.867046237f, -0.00305708661f, 0.863972843f, -0.00308967289f, 0.860866964f, -0.00312214275f,
+	0.857728601f, -0.00315449503f, 0.854557991f, -0.00318672834f, 0.851355195f, -0.00321884197f, 0.848120332f, -0.0032508343f,
+	0.84485358f, -0.00328270439f, 0.841554999f, -0.00331445062f, 0.838224709f, -0.00334607228f, 0.834862888f, -0.00337756774f,
+	0.831469595f, -0.00340893632f, 0.82804507f, -0.00344017637f, 0.824589312f, -0.00347128697f, 0.8211025f, -0.00350226671f,
+	0.817584813f, -0.00353311491f, 0.81403631f, -0.0035638297f, 0.81045717f, -0.00359441061f, 0.806847572f, -0.00362485624f,
+	0.803207517f, -0.0036551652f, 0.799537241f, -0.00368533656f, 0.795836926f, -0.00371536915f, 0.792106569f, -0.00374526205f,
+	0.78834641f, -0.00377501384f, 0.784556568f, -0.00380462338f, 0.780737221f, -0.00383408973f, 0.77688849f, -0.00386341196f,
+	0.773010433f, -0.00389258843f, 0.769103348f, -0.00392161869f, 0.765167236f, -0.00395050086f, 0.761202395f, -0.00397923449f,
+	0.757208824f, -0.00400781818f, 0.753186822f, -0.00403625146f, 0.749136388f, -0.00406453246f, 0.745057762f, -0.00409266027f,
+	0.740951121f, -0.00412063394f, 0.736816585f, -0.00414845301f, 0.732654274f, -0.00417611562f, 0.728464365f, -0.00420362083f,
+	0.724247098f, -0.00423096772f, 0.720002532f, -0.00425815536f, 0.715730846f, -0.0042851828f, 0.711432219f, -0.00431204913f,
+	0.707106769f, -0.00433875294f, 0.702754736f, -0.00436529331f, 0.698376238f, -0.0043916693f, 0.693971455f, -0.00441787997f,
+	0.689540565f, -0.00444392441f, 0.685083687f, -0.00446980167f, 0.680601001f, -0.00449551037f, 0.676092684f, -0.00452105002f,
+	0.671558976f, -0.00454641925f, 0.666999936f, -0.00457161712f, 0.662415802f, -0.00459664315f, 0.657806695f, -0.00462149642f,
+	0.653172851f, -0.00464617508f, 0.64851439f, -0.00467067957f, 0.643831551f, -0.00469500758f, 0.639124453f, -0.0047191591f,
+	0.634393275f, -0.00474313274f, 0.629638255f, -0.00476692803f, 0.624859512f, -0.00479054358f, 0.620057225f, -0.00481397891f,
+	0.615231574f, -0.00483723311f, 0.610382795f, -0.00486030523f, 0.605511069f, -0.00488319388f, 0.600616455f, -0.00490589906f,
+	0.59569931f, -0.00492841983f, 0.590759695f, -0.00495075481f, 0.585797846f, -0.00497290306f, 0.580813944f, -0.00499486458f,
+	0.575808167f, -0.0050166375f, 0.570780754f, -0.00503822183f, 0.565731823f, -0.00505961664f, 0.560661554f, -0.00508082099f,
+	0.555570245f, -0.00510183349f, 0.550457954f, -0.00512265461f, 0.545324981f, -0.00514328247f, 0.540171444f, -0.00516371662f,
+	0.534997642f, -0.00518395659f, 0.529803634f, -0.00520400144f, 0.524589658f, -0.00522385025f, 0.519356012f, -0.00524350209f,
+	0.514102757f, -0.00526295695f, 0.50883013f, -0.00528221345f, 0.50353837f, -0.0053012711f, 0.498227656f, -0.00532012898f,
+	0.492898196f, -0.0053387871f, 0.487550169f, -0.00535724359f, 0.482183784f, -0.00537549891f, 0.47679922f, -0.00539355166f,
+	0.471396744f, -0.00541140093f, 0.465976506f, -0.00542904716f, 0.460538715f, -0.0054464885f, 0.455083579f, -0.00546372496f,
+	0.449611336f, -0.00548075559f, 0.444122136f, -0.00549757993f, 0.438616246f, -0.00551419752f, 0.433093816f, -0.00553060742f,
+	0.427555084f, -0.00554680871f, 0.422000259f, -0.00556280138f, 0.416429549f, -0.00557858497f, 0.410843164f, -0.00559415808f,
+	0.405241311f, -0.00560952071f, 0.399624199f, -0.0056246724f, 0.393992037f, -0.00563961174f, 0.388345033f, -0.00565433921f,
+	0.382683426f, -0.00566885388f, 0.377007425f, -0.0056831548f, 0.371317208f, -0.00569724198f, 0.365612984f, -0.0057111145f,
+	0.359895051f, -0.00572477235f, 0.354163527f, -0.00573821412f, 0.348418683f, -0.0057514403f, 0.342660725f, -0.00576444948f,
+	0.336889863f, -0.00577724213f, 0.331106305f, -0.00578981685f, 0.32531029f, -0.0058021741f, 0.319502026f, -0.00581431249f,
+	0.313681751f, -0.00582623202f, 0.307849646f, -0.00583793223f, 0.302005947f, -0.00584941264f, 0.296150893f, -0.0058606728f,
+	0.290284663f, -0.00587171223f, 0.284407526f, -0.00588253094f, 0.27851969f, -0.00589312799f, 0.272621363f, -0.00590350293f,
+	0.266712755f, -0.00591365574f, 0.260794103f, -0.00592358597f, 0.254865646f, -0.00593329314f, 0.248927608f, -0.00594277726f,
+	0.242980182f, -0.00595203741f, 0.237023607f, -0.0059610731f, 0.231058106f, -0.00596988481f, 0.225083917f, -0.0059784716f,
+	0.219101235f, -0.00598683348f, 0.213110313f, -0.00599496951f, 0.207111374f, -0.00600288017f, 0.201104641f, -0.00601056498f,
+	0.195090324f, -0.00601802301f, 0.18906866f, -0.00602525473f, 0.183039889f, -0.00603225967f, 0.177004218f, -0.00603903737f,
+	0.170961887f, -0.00604558783f, 0.164913118f, -0.00605191058f, 0.15885815f, -0.00605800562f, 0.152797192f, -0.00606387248f,
+	0.146730468f, -0.00606951118f, 0.140658244f, -0.00607492123f, 0.134580702f, -0.00608010264f, 0.128498107f, -0.00608505495f,
+	0.122410677f, -0.00608977815f, 0.116318628f, -0.00609427225f, 0.110222206f, -0.00609853677f, 0.104121633f, -0.00610257173f,
+	0.0980171412f, -0.00610637711f, 0.0919089541f, -0.00610995246f, 0.0857973099f, -0.00611329777f, 0.0796824396f, -0.00611641258f,
+	0.0735645667f, -0.00611929782f, 0.0674439222f, -0.00612195209f, 0.061320737f, -0.00612437585f, 0.0551952459f, -0.00612656958f,
+	0.0490676761f, -0.00612853235f, 0.0429382585f, -0.00613026414f, 0.0368072242f, -0.00613176543f, 0.030674804f, -0.00613303576f,
+	0.024541229f, -0.00613407511f, 0.0184067301f, -0.0061348835f, 0.0122715384f, -0.00613546092f, 0.00613588467f, -0.00613580784f,
+	0.0f, -0.00613592332f, -0.00613588467f, -0.00613580784f, -0.0122715384f, -0.00613546092f, -0.0184067301f, -0.0061348835f,
+	-0.024541229f, -0.00613407511f, -0.030674804f, -0.00613303576f, -0.0368072242f, -0.00613176543f, -0.0429382585f, -0.00613026414f,
+	-0.0490676761f, -0.00612853235f, -0.0551952459f, -0.00612656958f, -0.061320737f, -0.00612437585f, -0.0674439222f, -0.00612195209f,
+	-0.0735645667f, -0.00611929782f, -0.0796824396f, -0.00611641258f, -0.0857973099f, -0.00611329777f, -0.0919089541f, -0.00610995246f,
+	-0.0980171412f, -0.00610637711f, -0.104121633f, -0.00610257173f, -0.110222206f, -0.00609853677f, -0.116318628f, -0.00609427225f,
+	-0.122410677f, -0.00608977815f, -0.128498107f, -0.00608505495f, -0.134580702f, -0.00608010264f, -0.140658244f, -0.00607492123f,
+	-0.146730468f, -0.00606951118f, -0.152797192f, -0.00606387248f, -0.15885815f, -0.00605800562f, -0.164913118f, -0.00605191058f,
+	-0.170961887f, -0.00604558783f, -0.177004218f, -0.00603903737f, -0.183039889f, -0.00603225967f, -0.18906866f, -0.00602525473f,
+	-0.195090324f, -0.00601802301f, -0.201104641f, -0.00601056498f, -0.207111374f, -0.00600288017f, -0.213110313f, -0.00599496951f,
+	-0.219101235f, -0.00598683348f, -0.225083917f, -0.0059784716f, -0.231058106f, -0.00596988481f, -0.237023607f, -0.0059610731f,
+	-0.242980182f, -0.00595203741f, -0.248927608f, -0.00594277726f, -0.254865646f, -0.00593329314f, -0.260794103f, -0.00592358597f,
+	-0.266712755f, -0.00591365574f, -0.272621363f, -0.00590350293f, -0.27851969f, -0.00589312799f, -0.284407526f, -0.00588253094f,
+	-0.290284663f, -0.00587171223f, -0.296150893f, -0.0058606728f, -0.302005947f, -0.00584941264f, -0.307849646f, -0.00583793223f,
+	-0.313681751f, -0.00582623202f, -0.319502026f, -0.00581431249f, -0.32531029f, -0.0058021741f, -0.331106305f, -0.00578981685f,
+	-0.336889863f, -0.00577724213f, -0.342660725f, -0.00576444948f, -0.348418683f, -0.0057514403f, -0.354163527f, -0.00573821412f,
+	-0.359895051f, -0.00572477235f, -0.365612984f, -0.0057111145f, -0.371317208f, -0.00569724198f, -0.377007425f, -0.0056831548f,
+	-0.382683426f, -0.00566885388f, -0.388345033f, -0.00565433921f, -0.393992037f, -0.00563961174f, -0.399624199f, -0.0056246724f,
+	-0.405241311f, -0.00560952071f, -0.410843164f, -0.00559415808f, -0.416429549f, -0.00557858497f, -0.422000259f, -0.00556280138f,
+	-0.427555084f, -0.00554680871f, -0.433093816f, -0.00553060742f, -0.438616246f, -0.00551419752f, -0.444122136f, -0.00549757993f,
+	-0.449611336f, -0.00548075559f, -0.455083579f, -0.00546372496f, -0.460538715f, -0.0054464885f, -0.465976506f, -0.00542904716f,
+	-0.471396744f, -0.00541140093f, -0.47679922f, -0.00539355166f, -0.482183784f, -0.00537549891f, -0.487550169f, -0.00535724359f,
+	-0.492898196f, -0.0053387871f, -0.498227656f, -0.00532012898f, -0.50353837f, -0.0053012711f, -0.50883013f, -0.00528221345f,
+	-0.514102757f, -0.00526295695f, -0.519356012f, -0.00524350209f, -0.524589658f, -0.00522385025f, -0.529803634f, -0.00520400144f,
+	-0.534997642f, -0.00518395659f, -0.540171444f, -0.00516371662f, -0.545324981f, -0.00514328247f, -0.550457954f, -0.00512265461f,
+	-0.555570245f, -0.00510183349f, -0.560661554f, -0.00508082099f, -0.565731823f, -0.00505961664f, -0.570780754f, -0.00503822183f,
+	-0.575808167f, -0.0050166375f, -0.580813944f, -0.00499486458f, -0.585797846f, -0.00497290306f, -0.590759695f, -0.00495075481f,
+	-0.59569931f, -0.00492841983f, -0.600616455f, -0.00490589906f, -0.605511069f, -0.00488319388f, -0.610382795f, -0.00486030523f,
+	-0.615231574f, -0.00483723311f, -0.620057225f, -0.00481397891f, -0.624859512f, -0.00479054358f, -0.629638255f, -0.00476692803f,
+	-0.634393275f, -0.00474313274f, -0.639124453f, -0.0047191591f, -0.643831551f, -0.00469500758f, -0.64851439f, -0.00467067957f,
+	-0.653172851f, -0.00464617508f, -0.657806695f, -0.00462149642f, -0.662415802f, -0.00459664315f, -0.666999936f, -0.00457161712f,
+	-0.671558976f, -0.00454641925f, -0.676092684f, -0.00452105002f, -0.680601001f, -0.00449551037f, -0.685083687f, -0.00446980167f,
+	-0.689540565f, -0.00444392441f, -0.693971455f, -0.00441787997f, -0.698376238f, -0.0043916693f, -0.702754736f, -0.00436529331f,
+	-0.707106769f, -0.00433875294f, -0.711432219f, -0.00431204913f, -0.715730846f, -0.0042851828f, -0.720002532f, -0.00425815536f,
+	-0.724247098f, -0.00423096772f, -0.728464365f, -0.00420362083f, -0.732654274f, -0.00417611562f, -0.736816585f, -0.00414845301f,
+	-0.740951121f, -0.00412063394f, -0.745057762f, -0.00409266027f, -0.749136388f, -0.00406453246f, -0.753186822f, -0.00403625146f,
+	-0.757208824f, -0.00400781818f, -0.761202395f, -0.00397923449f, -0.765167236f, -0.00395050086f, -0.769103348f, -0.00392161869f,
+	-0.773010433f, -0.00389258843f, -0.77688849f, -0.00386341196f, -0.780737221f, -0.00383408973f, -0.784556568f, -0.00380462338f,
+	-0.78834641f, -0.00377501384f, -0.792106569f, -0.00374526205f, -0.795836926f, -0.00371536915f, -0.799537241f, -0.00368533656f,
+	-0.803207517f, -0.0036551652f, -0.806847572f, -0.00362485624f, -0.81045717f, -0.00359441061f, -0.81403631f, -0.0035638297f,
+	-0.817584813f, -0.00353311491f, -0.8211025f, -0.00350226671f, -0.824589312f, -0.00347128697f, -0.82804507f, -0.00344017637f,
+	-0.831469595f, -0.00340893632f, -0.834862888f, -0.00337756774f, -0.838224709f, -0.00334607228f, -0.841554999f, -0.00331445062f,
+	-0.84485358f, -0.00328270439f, -0.848120332f, -0.0032508343f, -0.851355195f, -0.00321884197f, -0.854557991f, -0.00318672834f,
+	-0.857728601f, -0.00315449503f, -0.860866964f, -0.00312214275f, -0.863972843f, -0.00308967289f, -0.867046237f, -0.00305708661f,
+	-0.870086968f, -0.00302438554f, -0.873094976f, -0.00299157039f, -0.876070082f, -0.00295864255f, -0.879012227f, -0.00292560342f,
+	-0.881921291f, -0.00289245415f, -0.884797096f, -0.00285919593f, -0.887639642f, -0.00282583013f, -0.890448749f, -0.00279235793f,
+	-0.893224299f, -0.00275878049f, -0.895966232f, -0.00272509945f, -0.898674488f, -0.00269131549f, -0.901348829f, -0.00265743048f,
+	-0.903989315f, -0.00262344512f, -0.906595707f, -0.00258936128f, -0.909168005f, -0.00255517988f, -0.91170603f, -0.00252090208f,
+	-0.914209783f, -0.00248652953f, -0.916679084f, -0.00245206337f, -0.919113874f, -0.00241750479f, -0.921514034f, -0.0023828554f,
+	-0.923879504f, -0.00234811613f, -0.926210225f, -0.00231328839f, -0.928506076f, -0.00227837381f, -0.93076694f, -0.00224337331f,
+	-0.932992816f, -0.00220828829f, -0.935183525f, -0.00217312016f, -0.937339008f, -0.00213787029f, -0.939459205f, -0.00210253987f,
+	-0.941544056f, -0.00206713029f, -0.943593442f, -0.00203164294f, -0.945607305f, -0.00199607899f, -0.947585583f, -0.00196043984f,
+	-0.949528158f, -0.001924727f, -0.95143503f, -0.00188894174f, -0.953306019f, -0.00185308524f, -0.955141187f, -0.00181715912f,
+	-0.956940353f, -0.00178116444f, -0.958703458f, -0.00174510281f, -0.960430503f, -0.00170897541f, -0.962121427f, -0.00167278363f,
+	-0.963776052f, -0.00163652899f, -0.965394437f, -0.00160021265f, -0.966976464f, -0.00156383612f, -0.968522072f, -0.00152740069f,
+	-0.970031261f, -0.00149090774f, -0.971503913f, -0.00145435869f, -0.972939968f, -0.0014177548f, -0.974339366f, -0.00138109759f,
+	-0.975702107f, -0.00134438835f, -0.977028131f, -0.00130762858f, -0.97831738f, -0.00127081946f, -0.979569793f, -0.0012339626f,
+	-0.980785251f, -0.00119705917f, -0.981963873f, -0.00116011081f, -0.983105481f, -0.00112311868f, -0.984210074f, -0.00108608429f,
+	-0.985277653f, -0.00104900904f, -0.986308098f, -0.0010118942f, -0.987301409f, -0.000974741357f, -0.988257587f, -0.000937551784f,
+	-0.989176512f, -0.000900326937f, -0.990058184f, -0.000863068155f, -0.990902662f, -0.000825776893f, -0.991709769f, -0.000788454548f,
+	-0.992479563f, -0.000751102518f, -0.993211925f, -0.000713722198f, -0.993906975f, -0.000676314987f, -0.994564593f, -0.000638882339f,
+	-0.99518472f, -0.000601425651f, -0.995767415f, -0.00056394632f, -0.996312618f, -0.000526445743f, -0.996820271f, -0.000488925318f,
+	-0.997290432f, -0.000451386499f, -0.997723043f, -0.000413830712f, -0.998118103f, -0.000376259326f, -0.998475552f, -0.000338673766f,
+	-0.99879545f, -0.000301075488f, -0.999077737f, -0.00026346583f, -0.999322355f, -0.000225846292f, -0.999529421f, -0.000188218241f,
+	-0.999698818f, -0.000150583088f, -0.999830604f, -0.000112942282f, -0.999924719f, -7.52972192e-05f, -0.999981165f, -3.76493153e-05f,
+	-1.0f, 0.0f, -0.999981165f, 3.76493153e-05f, -0.999924719f, 7.52972192e-05f, -0.999830604f, 0.000112942282f,
+	-0.999698818f, 0.000150583088f, -0.999529421f, 0.000188218241f, -0.999322355f, 0.000225846292f, -0.999077737f, 0.00026346583f,
+	-0.99879545f, 0.000301075488f, -0.998475552f, 0.000338673766f, -0.998118103f, 0.000376259326f, -0.997723043f, 0.000413830712f,
+	-0.997290432f, 0.000451386499f, -0.996820271f, 0.000488925318f, -0.996312618f, 0.000526445743f, -0.995767415f, 0.00056394632f,
+	-0.99518472f, 0.000601425651f, -0.994564593f, 0.000638882339f, -0.993906975f, 0.000676314987f, -0.993211925f, 0.000713722198f,
+	-0.992479563f, 0.000751102518f, -0.991709769f, 0.000788454548f, -0.990902662f, 0.000825776893f, -0.990058184f, 0.000863068155f,
+	-0.989176512f, 0.000900326937f, -0.988257587f, 0.000937551784f, -0.987301409f, 0.000974741357f, -0.986308098f, 0.0010118942f,
+	-0.985277653f, 0.00104900904f, -0.984210074f, 0.00108608429f, -0.983105481f, 0.00112311868f, -0.981963873f, 0.00116011081f,
+	-0.980785251f, 0.00119705917f, -0.979569793f, 0.0012339626f, -0.97831738f, 0.00127081946f, -0.977028131f, 0.00130762858f,
+	-0.975702107f, 0.00134438835f, -0.974339366f, 0.00138109759f, -0.972939968f, 0.0014177548f, -0.971503913f, 0.00145435869f,
+	-0.970031261f, 0.00149090774f, -0.968522072f, 0.00152740069f, -0.966976464f, 0.00156383612f, -0.965394437f, 0.00160021265f,
+	-0.963776052f, 0.00163652899f, -0.962121427f, 0.00167278363f, -0.960430503f, 0.00170897541f, -0.958703458f, 0.00174510281f,
+	-0.956940353f, 0.00178116444f, -0.955141187f, 0.00181715912f, -0.953306019f, 0.00185308524f, -0.95143503f, 0.00188894174f,
+	-0.949528158f, 0.001924727f, -0.947585583f, 0.00196043984f, -0.945607305f, 0.00199607899f, -0.943593442f, 0.00203164294f,
+	-0.941544056f, 0.00206713029f, -0.939459205f, 0.00210253987f, -0.937339008f, 0.00213787029f, -0.935183525f, 0.00217312016f,
+	-0.932992816f, 0.00220828829f, -0.93076694f, 0.00224337331f, -0.928506076f, 0.00227837381f, -0.926210225f, 0.00231328839f,
+	-0.923879504f, 0.00234811613f, -0.921514034f, 0.0023828554f, -0.919113874f, 0.00241750479f, -0.916679084f, 0.00245206337f,
+	-0.914209783f, 0.00248652953f, -0.91170603f, 0.00252090208f, -0.909168005f, 0.00255517988f, -0.906595707f, 0.00258936128f,
+	-0.903989315f, 0.00262344512f, -0.901348829f, 0.00265743048f, -0.898674488f, 0.00269131549f, -0.895966232f, 0.00272509945f,
+	-0.893224299f, 0.00275878049f, -0.890448749f, 0.00279235793f, -0.887639642f, 0.00282583013f, -0.884797096f, 0.00285919593f,
+	-0.881921291f, 0.00289245415f, -0.879012227f, 0.00292560342f, -0.876070082f, 0.00295864255f, -0.873094976f, 0.00299157039f,
+	-0.870086968f, 0.00302438554f, -0.867046237f, 0.00305708661f, -0.863972843f, 0.00308967289f, -0.860866964f, 0.00312214275f,
+	-0.857728601f, 0.00315449503f, -0.854557991f, 0.00318672834f, -0.851355195f, 0.00321884197f, -0.848120332f, 0.0032508343f,
+	-0.84485358f, 0.00328270439f, -0.841554999f, 0.00331445062f, -0.838224709f, 0.00334607228f, -0.834862888f, 0.00337756774f,
+	-0.831469595f, 0.00340893632f, -0.82804507f, 0.00344017637f, -0.824589312f, 0.00347128697f, -0.8211025f, 0.00350226671f,
+	-0.817584813f, 0.00353311491f, -0.81403631f, 0.0035638297f, -0.81045717f, 0.00359441061f, -0.806847572f, 0.00362485624f,
+	-0.803207517f, 0.0036551652f, -0.799537241f, 0.00368533656f, -0.795836926f, 0.00371536915f, -0.792106569f, 0.00374526205f,
+	-0.78834641f, 0.00377501384f, -0.784556568f, 0.00380462338f, -0.780737221f, 0.00383408973f, -0.77688849f, 0.00386341196f,
+	-0.773010433f, 0.00389258843f, -0.769103348f, 0.00392161869f, -0.765167236f, 0.00395050086f, -0.761202395f, 0.00397923449f,
+	-0.757208824f, 0.00400781818f, -0.753186822f, 0.00403625146f, -0.749136388f, 0.00406453246f, -0.745057762f, 0.00409266027f,
+	-0.740951121f, 0.00412063394f, -0.736816585f, 0.00414845301f, -0.732654274f, 0.00417611562f, -0.728464365f, 0.00420362083f,
+	-0.724247098f, 0.00423096772f, -0.720002532f, 0.00425815536f, -0.715730846f, 0.0042851828f, -0.711432219f, 0.00431204913f,
+	-0.707106769f, 0.00433875294f, -0.702754736f, 0.00436529331f, -0.698376238f, 0.0043916693f, -0.693971455f, 0.00441787997f,
+	-0.689540565f, 0.00444392441f, -0.685083687f, 0.00446980167f, -0.680601001f, 0.00449551037f, -0.676092684f, 0.00452105002f,
+	-0.671558976f, 0.00454641925f, -0.666999936f, 0.00457161712f, -0.662415802f, 0.00459664315f, -0.657806695f, 0.00462149642f,
+	-0.653172851f, 0.00464617508f, -0.64851439f, 0.00467067957f, -0.643831551f, 0.00469500758f, -0.639124453f, 0.0047191591f,
+	-0.634393275f, 0.00474313274f, -0.629638255f, 0.00476692803f, -0.624859512f, 0.00479054358f, -0.620057225f, 0.00481397891f,
+	-0.615231574f, 0.00483723311f, -0.610382795f, 0.00486030523f, -0.605511069f, 0.00488319388f, -0.600616455f, 0.00490589906f,
+	-0.59569931f, 0.00492841983f, -0.590759695f, 0.00495075481f, -0.585797846f, 0.00497290306f, -0.580813944f, 0.00499486458f,
+	-0.575808167f, 0.0050166375f, -0.570780754f, 0.00503822183f, -0.565731823f, 0.00505961664f, -0.560661554f, 0.00508082099f,
+	-0.555570245f, 0.00510183349f, -0.550457954f, 0.00512265461f, -0.545324981f, 0.00514328247f, -0.540171444f, 0.00516371662f,
+	-0.534997642f, 0.00518395659f, -0.529803634f, 0.00520400144f, -0.524589658f, 0.00522385025f, -0.519356012f, 0.00524350209f,
+	-0.514102757f, 0.00526295695f, -0.50883013f, 0.00528221345f, -0.50353837f, 0.0053012711f, -0.498227656f, 0.00532012898f,
+	-0.492898196f, 0.0053387871f, -0.487550169f, 0.00535724359f, -0.482183784f, 0.00537549891f, -0.47679922f, 0.00539355166f,
+	-0.471396744f, 0.00541140093f, -0.465976506f, 0.00542904716f, -0.460538715f, 0.0054464885f, -0.455083579f, 0.00546372496f,
+	-0.449611336f, 0.00548075559f, -0.444122136f, 0.00549757993f, -0.438616246f, 0.00551419752f, -0.433093816f, 0.00553060742f,
+	-0.427555084f, 0.00554680871f, -0.422000259f, 0.00556280138f, -0.416429549f, 0.00557858497f, -0.410843164f, 0.00559415808f,
+	-0.405241311f, 0.00560952071f, -0.399624199f, 0.0056246724f, -0.393992037f, 0.00563961174f, -0.388345033f, 0.00565433921f,
+	-0.382683426f, 0.00566885388f, -0.377007425f, 0.0056831548f, -0.371317208f, 0.00569724198f, -0.365612984f, 0.0057111145f,
+	-0.359895051f, 0.00572477235f, -0.354163527f, 0.00573821412f, -0.348418683f, 0.0057514403f, -0.342660725f, 0.00576444948f,
+	-0.336889863f, 0.00577724213f, -0.331106305f, 0.00578981685f, -0.32531029f, 0.0058021741f, -0.319502026f, 0.00581431249f,
+	-0.313681751f, 0.00582623202f, -0.307849646f, 0.00583793223f, -0.302005947f, 0.00584941264f, -0.296150893f, 0.0058606728f,
+	-0.290284663f, 0.00587171223f, -0.284407526f, 0.00588253094f, -0.27851969f, 0.00589312799f, -0.272621363f, 0.00590350293f,
+	-0.266712755f, 0.00591365574f, -0.260794103f, 0.00592358597f, -0.254865646f, 0.00593329314f, -0.248927608f, 0.00594277726f,
+	-0.242980182f, 0.00595203741f, -0.237023607f, 0.0059610731f, -0.231058106f, 0.00596988481f, -0.225083917f, 0.0059784716f,
+	-0.219101235f, 0.00598683348f, -0.213110313f, 0.00599496951f, -0.207111374f, 0.00600288017f, -0.201104641f, 0.00601056498f,
+	-0.195090324f, 0.00601802301f, -0.18906866f, 0.00602525473f, -0.183039889f, 0.00603225967f, -0.177004218f, 0.00603903737f,
+	-0.170961887f, 0.00604558783f, -0.164913118f, 0.00605191058f, -0.15885815f, 0.00605800562f, -0.152797192f, 0.00606387248f,
+	-0.146730468f, 0.00606951118f, -0.140658244f, 0.00607492123f, -0.134580702f, 0.00608010264f, -0.128498107f, 0.00608505495f,
+	-0.122410677f, 0.00608977815f, -0.116318628f, 0.00609427225f, -0.110222206f, 0.00609853677f, -0.104121633f, 0.00610257173f,
+	-0.0980171412f, 0.00610637711f, -0.0919089541f, 0.00610995246f, -0.0857973099f, 0.00611329777f, -0.0796824396f, 0.00611641258f,
+	-0.0735645667f, 0.00611929782f, -0.0674439222f, 0.00612195209f, -0.061320737f, 0.00612437585f, -0.0551952459f, 0.00612656958f,
+	-0.0490676761f, 0.00612853235f, -0.0429382585f, 0.00613026414f, -0.0368072242f, 0.00613176543f, -0.030674804f, 0.00613303576f,
+	-0.024541229f, 0.00613407511f, -0.0184067301f, 0.0061348835f, -0.0122715384f, 0.00613546092f, -0.00613588467f, 0.00613580784f,
+	0.0f, 0.00613592332f,
+#else
+#error "no generated Hermite sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c"
+#endif
+#elif FMATH_SIN_LUT_QUARTER
+#if FMATH_TABLE_BITS == 4
+	0.0f, 0.382683426f, 0.707106769f, 0.923879504f, 1.0f,
+#elif FMATH_TABLE_BITS == 5
+	0.0f, 0.195090324f, 0.382683426f, 0.555570245f, 0.707106769f, 0.831469595f, 0.923879504f, 0.980785251f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 6
+	0.0f, 0.0980171412f, 0.195090324f, 0.290284663f, 0.382683426f, 0.471396744f, 0.555570245f, 0.634393275f,
+	0.707106769f, 0.773010433f, 0.831469595f, 0.881921291f, 0.923879504f, 0.956940353f, 0.980785251f, 0.99518472f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 7
+	0.0f, 0.0490676761f, 0.0980171412f, 0.146730468f, 0.195090324f, 0.242980182f, 0.290284663f, 0.336889863f,
+	0.382683426f, 0.427555084f, 0.471396744f, 0.514102757f, 0.555570245f, 0.59569931f, 0.634393275f, 0.671558976f,
+	0.707106769f, 0.740951121f, 0.773010433f, 0.803207517f, 0.831469595f, 0.857728601f, 0.881921291f, 0.903989315f,
+	0.923879504f, 0.941544056f, 0.956940353f, 0.970031261f, 0.980785251f, 0.989176512f, 0.99518472f, 0.99879545f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 8
+	0.0f, 0.024541229f, 0.0490676761f, 0.0735645667f, 0.0980171412f, 0.122410677f, 0.146730468f, 0.170961887f,
+	0.195090324f, 0.219101235f, 0.242980182f, 0.266712755f, 0.290284663f, 0.313681751f, 0.336889863f, 0.359895051f,
+	0.382683426f, 0.405241311f, 0.427555084f, 0.449611336f, 0.471396744f, 0.492898196f, 0.514102757f, 0.534997642f,
+	0.555570245f, 0.575808167f, 0.59569931f, 0.615231574f, 0.634393275f, 0.653172851f, 0.671558976f, 0.689540565f,
+	0.707106769f, 0.724247098f, 0.740951121f, 0.757208824f, 0.773010433f, 0.78834641f, 0.803207517f, 0.817584813f,
+	0.831469595f, 0.84485358f, 0.857728601f, 0.870086968f, 0.881921291f, 0.893224299f, 0.903989315f, 0.914209783f,
+	0.923879504f, 0.932992816f, 0.941544056f, 0.949528158f, 0.956940353f, 0.963776052f, 0.970031261f, 0.975702107f,
+	0.980785251f, 0.985277653f, 0.989176512f, 0.992479563f, 0.99518472f, 0.997290432f, 0.99879545f, 0.999698818f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 9
+	0.0f, 0.0122715384f, 0.024541229f, 0.0368072242f, 0.0490676761f, 0.061320737f, 0.0735645667f, 0.0857973099f,
+	0.0980171412f, 0.110222206f, 0.122410677f, 0.134580702f, 0.146730468f, 0.15885815f, 0.170961887f, 0.183039889f,
+	0.195090324f, 0.207111374f, 0.219101235f, 0.231058106f, 0.242980182f, 0.254865646f, 0.266712755f, 0.27851969f,
+	0.290284663f, 0.302005947f, 0.313681751f, 0.32531029f, 0.336889863f, 0.348418683f, 0.359895051f, 0.371317208f,
+	0.382683426f, 0.393992037f, 0.405241311f, 0.416429549f, 0.427555084f, 0.438616246f, 0.449611336f, 0.460538715f,
+	0.471396744f, 0.482183784f, 0.492898196f, 0.50353837f, 0.514102757f, 0.524589658f, 0.534997642f, 0.545324981f,
+	0.555570245f, 0.565731823f, 0.575808167f, 0.585797846f, 0.59569931f, 0.605511069f, 0.615231574f, 0.624859512f,
+	0.634393275f, 0.643831551f, 0.653172851f, 0.662415802f, 0.671558976f, 0.680601001f, 0.689540565f, 0.698376238f,
+	0.707106769f, 0.715730846f, 0.724247098f, 0.732654274f, 0.740951121f, 0.749136388f, 0.757208824f, 0.765167236f,
+	0.773010433f, 0.780737221f, 0.78834641f, 0.795836926f, 0.803207517f, 0.81045717f, 0.817584813f, 0.824589312f,
+	0.831469595f, 0.838224709f, 0.84485358f, 0.851355195f, 0.857728601f, 0.863972843f, 0.870086968f, 0.876070082f,
+	0.881921291f, 0.887639642f, 0.893224299f, 0.898674488f, 0.903989315f, 0.909168005f, 0.914209783f, 0.919113874f,
+	0.923879504f, 0.928506076f, 0.932992816f, 0.937339008f, 0.941544056f, 0.945607305f, 0.949528158f, 0.953306019f,
+	0.956940353f, 0.960430503f, 0.963776052f, 0.966976464f, 0.970031261f, 0.972939968f, 0.975702107f, 0.97831738f,
+	0.980785251f, 0.983105481f, 0.985277653f, 0.987301409f, 0.989176512f, 0.990902662f, 0.992479563f, 0.993906975f,
+	0.99518472f, 0.996312618f, 0.997290432f, 0.998118103f, 0.99879545f, 0.999322355f, 0.999698818f, 0.999924719f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 10
+	0.0f, 0.00613588467f, 0.0122715384f, 0.0184067301f, 0.024541229f, 0.030674804f, 0.0368072242f, 0.0429382585f,
+	0.0490676761f, 0.0551952459f, 0.061320737f, 0.0674439222f, 0.0735645667f, 0.0796824396f, 0.0857973099f, 0.0919089541f,
+	0.0980171412f, 0.104121633f, 0.110222206f, 0.116318628f, 0.122410677f, 0.128498107f, 0.134580702f, 0.140658244f,
+	0.146730468f, 0.152797192f, 0.15885815f, 0.164913118f, 0.170961887f, 0.177004218f, 0.183039889f, 0.18906866f,
+	0.195090324f, 0.201104641f, 0.207111374f, 0.213110313f, 0.219101235f, 0.225083917f, 0.231058106f, 0.237023607f,
+	0.242980182f, 0.248927608f, 0.254865646f, 0.260794103f, 0.266712755f, 0.272621363f, 0.27851969f, 0.284407526f,
+	0.290284663f, 0.296150893f, 0.302005947f, 0.307849646f, 0.313681751f, 0.319502026f, 0.32531029f, 0.331106305f,
+	0.336889863f, 0.342660725f, 0.348418683f, 0.354163527f, 0.359895051f, 0.365612984f, 0.371317208f, 0.377007425f,
+	0.382683426f, 0.388345033f, 0.393992037f, 0.399624199f, 0.405241311f, 0.410843164f, 0.416429549f, 0.422000259f,
+	0.427555084f, 0.433093816f, 0.438616246f, 0.444122136f, 0.449611336f, 0.455083579f, 0.460538715f, 0.465976506f,
+	0.471396744f, 0.47679922f, 0.482183784f, 0.487550169f, 0.492898196f, 0.498227656f, 0.50353837f, 0.50883013f,
+	0.514102757f, 0.519356012f, 0.524589658f, 0.529803634f, 0.534997642f, 0.540171444f, 0.545324981f, 0.550457954f,
+	0.555570245f, 0.560661554f, 0.565731823f, 0.570780754f, 0.575808167f, 0.580813944f, 0.585797846f, 0.590759695f,
+	0.59569931f, 0.600616455f, 0.605511069f, 0.610382795f, 0.615231574f, 0.620057225f, 0.624859512f, 0.629638255f,
+	0.634393275f, 0.639124453f, 0.643831551f, 0.64851439f, 0.653172851f, 0.657806695f, 0.662415802f, 0.666999936f,
+	0.671558976f, 0.676092684f, 0.680601001f, 0.685083687f, 0.689540565f, 0.693971455f, 0.698376238f, 0.702754736f,
+	0.707106769f, 0.711432219f, 0.715730846f, 0.720002532f, 0.724247098f, 0.728464365f, 0.732654274f, 0.736816585f,
+	0.740951121f, 0.745057762f, 0.749136388f, 0.753186822f, 0.757208824f, 0.761202395f, 0.765167236f, 0.769103348f,
+	0.773010433f, 0.77688849f, 0.780737221f, 0.784556568f, 0.78834641f, 0.792106569f, 0.795836926f, 0.799537241f,
+	0.803207517f, 0.806847572f, 0.81045717f, 0.81403631f, 0.817584813f, 0.8211025f, 0.824589312f, 0.82804507f,
+	0.831469595f, 0.834862888f, 0.838224709f, 0.841554999f, 0.84485358f, 0.848120332f, 0.851355195f, 0.854557991f,
+	0.857728601f, 0.860866964f, 0.863972843f, 0.867046237f, 0.870086968f, 0.873094976f, 0.876070082f, 0.879012227f,
+	0.881921291f, 0.884797096f, 0.887639642f, 0.890448749f, 0.893224299f, 0.895966232f, 0.898674488f, 0.901348829f,
+	0.903989315f, 0.906595707f, 0.909168005f, 0.91170603f, 0.914209783f, 0.916679084f, 0.919113874f, 0.921514034f,
+	0.923879504f, 0.926210225f, 0.928506076f, 0.93076694f, 0.932992816f, 0.935183525f, 0.937339008f, 0.939459205f,
+	0.941544056f, 0.943593442f, 0.945607305f, 0.947585583f, 0.949528158f, 0.95143503f, 0.953306019f, 0.955141187f,
+	0.956940353f, 0.958703458f, 0.960430503f, 0.962121427f, 0.963776052f, 0.965394437f, 0.966976464f, 0.968522072f,
+	0.970031261f, 0.971503913f, 0.972939968f, 0.974339366f, 0.975702107f, 0.977028131f, 0.97831738f, 0.979569793f,
+	0.980785251f, 0.981963873f, 0.983105481f, 0.984210074f, 0.985277653f, 0.986308098f, 0.987301409f, 0.988257587f,
+	0.989176512f, 0.990058184f, 0.990902662f, 0.991709769f, 0.992479563f, 0.993211925f, 0.993906975f, 0.994564593f,
+	0.99518472f, 0.995767415f, 0.996312618f, 0.996820271f, 0.997290432f, 0.997723043f, 0.998118103f, 0.998475552f,
+	0.99879545f, 0.999077737f, 0.999322355f, 0.999529421f, 0.999698818f, 0.999830604f, 0.999924719f, 0.999981165f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 11
+	0.0f, 0.00306795677f, 0.00613588467f, 0.00920375437f, 0.0122715384f, 0.015339206f, 0.0184067301f, 0.0214740802f,
+	0.024541229f, 0.027608145f, 0.030674804f, 0.0337411724f, 0.0368072242f, 0.0398729257f, 0.0429382585f, 0.0460031815f,
+	0.0490676761f, 0.052131705f, 0.0551952459f, 0.0582582653f, 0.061320737f, 0.0643826276f, 0.0674439222f, 0.070504576f,
+	0.0735645667f, 0.0766238645f, 0.0796824396f, 0.0827402622f, 0.0857973099f, 0.0888535529f, 0.0919089541f, 0.0949634984f,
+	0.0980171412f, 0.10106986f, 0.104121633f, 0.107172422f, 0.110222206f, 0.113270953f, 0.116318628f, 0.119365215f,
+	0.122410677f, 0.125454977f, 0.128498107f, 0.13154003f, 0.134580702f, 0.137620121f, 0.140658244f, 0.143695027f,
+	0.146730468f, 0.149764538f, 0.152797192f, 0.155828401f, 0.15885815f, 0.161886394f, 0.164913118f, 0.167938292f,
+	0.170961887f, 0.173983872f, 0.177004218f, 0.180022895f, 0.183039889f, 0.186055154f, 0.18906866f, 0.192080393f,
+	0.195090324f, 0.198098406f, 0.201104641f, 0.204108968f, 0.207111374f, 0.210111842f, 0.213110313f, 0.216106802f,
+	0.219101235f, 0.222093627f, 0.225083917f, 0.228072077f, 0.231058106f, 0.234041959f, 0.237023607f, 0.24000302f,
+	0.242980182f, 0.24595505f, 0.248927608f, 0.251897812f, 0.254865646f, 0.257831097f, 0.260794103f, 0.263754666f,
+	0.266712755f, 0.269668311f, 0.272621363f, 0.275571823f, 0.27851969f, 0.281464934f, 0.284407526f, 0.287347466f,
+	0.290284663f, 0.293219149f, 0.296150893f, 0.299079835f, 0.302005947f, 0.304929227f, 0.307849646f, 0.310767144f,
+	0.313681751f, 0.316593379f, 0.319502026f, 0.322407693f, 0.32531029f, 0.328209847f, 0.331106305f, 0.333999664f,
+	0.336889863f, 0.339776874f, 0.342660725f, 0.345541328f, 0.348418683f, 0.351292759f, 0.354163527f, 0.357030958f,
+	0.359895051f, 0.362755716f, 0.365612984f, 0.368466824f, 0.371317208f, 0.374164075f, 0.377007425f, 0.379847199f,
+	0.382683426f, 0.385516047f, 0.388345033f, 0.391170382f, 0.393992037f, 0.396809995f, 0.399624199f, 0.402434647f,
+	0.405241311f, 0.408044159f, 0.410843164f, 0.413638324f, 0.416429549f, 0.419216901f, 0.422000259f, 0.424779683f,
+	0.427555084f, 0.430326492f, 0.433093816f, 0.435857087f, 0.438616246f, 0.441371262f, 0.444122136f, 0.446868837f,
+	0.449611336f, 0.452349573f, 0.455083579f, 0.457813293f, 0.460538715f, 0.463259786f, 0.465976506f, 0.468688816f,
+	0.471396744f, 0.474100202f, 0.47679922f, 0.479493767f, 0.482183784f, 0.484869242f, 0.487550169f, 0.490226477f,
+	0.492898196f, 0.495565265f, 0.498227656f, 0.500885367f, 0.50353837f, 0.506186664f, 0.50883013f, 0.511468828f,
+	0.514102757f, 0.516731799f, 0.519356012f, 0.521975279f, 0.524589658f, 0.527199149f, 0.529803634f, 0.532403111f,
+	0.534997642f, 0.537587047f, 0.540171444f, 0.542750776f, 0.545324981f, 0.547894061f, 0.550457954f, 0.553016722f,
+	0.555570245f, 0.558118522f, 0.560661554f, 0.563199341f, 0.565731823f, 0.568258941f, 0.570780754f, 0.573297143f,
+	0.575808167f, 0.578313768f, 0.580813944f, 0.583308637f, 0.585797846f, 0.588281572f, 0.590759695f, 0.593232274f,
+	0.59569931f, 0.598160684f, 0.600616455f, 0.603066623f, 0.605511069f, 0.607949793f, 0.610382795f, 0.612810075f,
+	0.615231574f, 0.61764729f, 0.620057225f, 0.622461259f, 0.624859512f, 0.627251804f, 0.629638255f, 0.632018745f,
+	0.634393275f, 0.636761844f, 0.639124453f, 0.641481042f, 0.643831551f, 0.64617604f, 0.64851439f, 0.65084666f,
+	0.653172851f, 0.655492842f, 0.657806695f, 0.660114348f, 0.662415802f, 0.664710999f, 0.666999936f, 0.669282615f,
+	0.671558976f, 0.673829019f, 0.676092684f, 0.678350031f, 0.680601001f, 0.682845533f, 0.685083687f, 0.687315345f,
+	0.689540565f, 0.691759229f, 0.693971455f, 0.696177125f, 0.698376238f, 0.700568795f, 0.702754736f, 0.704934061f,
+	0.707106769f, 0.709272802f, 0.711432219f, 0.71358484f, 0.715730846f, 0.717870057f, 0.720002532f, 0.722128212f,
+	0.724247098f, 0.726359129f, 0.728464365f, 0.730562747f, 0.732654274f, 0.734738886f, 0.736816585f, 0.73888731f,
+	0.740951121f, 0.743007958f, 0.745057762f, 0.747100592f, 0.749136388f, 0.751165152f, 0.753186822f, 0.755201399f,
+	0.757208824f, 0.759209216f, 0.761202395f, 0.763188422f, 0.765167236f, 0.767138898f, 0.769103348f, 0.771060526f,
+	0.773010433f, 0.774953127f, 0.77688849f, 0.778816521f, 0.780737221f, 0.78265059f, 0.784556568f, 0.786455214f,
+	0.78834641f, 0.790230215f, 0.792106569f, 0.793975472f, 0.795836926f, 0.797690868f, 0.799537241f, 0.801376164f,
+	0.803207517f, 0.805031359f, 0.806847572f, 0.808656156f, 0.81045717f, 0.812250614f, 0.81403631f, 0.815814435f,
+	0.817584813f, 0.819347501f, 0.8211025f, 0.82284981f, 0.824589312f, 0.826321065f, 0.82804507f, 0.829761207f,
+	0.831469595f, 0.833170176f, 0.834862888f, 0.836547732f, 0.838224709f, 0.839893818f, 0.841554999f, 0.843208253f,
+	0.84485358f, 0.84649092f, 0.848120332f, 0.849741757f, 0.851355195f, 0.852960587f, 0.854557991f, 0.856147349f,
+	0.857728601f, 0.859301805f, 0.860866964f, 0.862423956f, 0.863972843f, 0.865513623f, 0.867046237f, 0.868570685f,
+	0.870086968f, 0.871595085f, 0.873094976f, 0.874586642f, 0.876070082f, 0.877545297f, 0.879012227f, 0.880470872f,
+	0.881921291f, 0.883363366f, 0.884797096f, 0.886222541f, 0.887639642f, 0.889048338f, 0.890448749f, 0.891840696f,
+	0.893224299f, 0.894599497f, 0.895966232f, 0.897324562f, 0.898674488f, 0.900015891f, 0.901348829f, 0.902673304f,
+	0.903989315f, 0.905296743f, 0.906595707f, 0.907886088f, 0.909168005f, 0.910441279f, 0.91170603f, 0.912962198f,
+	0.914209783f, 0.915448725f, 0.916679084f, 0.917900801f, 0.919113874f, 0.920318305f, 0.921514034f, 0.92270112f,
+	0.923879504f, 0.925049245f, 0.926210225f, 0.927362502f, 0.928506076f, 0.929640889f, 0.93076694f, 0.931884289f,
+	0.932992816f, 0.934092522f, 0.935183525f, 0.936265647f, 0.937339008f, 0.938403547f, 0.939459205f, 0.940506041f,
+	0.941544056f, 0.94257319f, 0.943593442f, 0.944604814f, 0.945607305f, 0.946600914f, 0.947585583f, 0.94856137f,
+	0.949528158f, 0.950486064f, 0.95143503f, 0.952374995f, 0.953306019f, 0.954228103f, 0.955141187f, 0.95604527f,
+	0.956940353f, 0.957826436f, 0.958703458f, 0.95957154f, 0.960430503f, 0.961280465f, 0.962121427f, 0.962953269f,
+	0.963776052f, 0.964589775f, 0.965394437f, 0.966189981f, 0.966976464f, 0.967753828f, 0.968522072f, 0.969281256f,
+	0.970031261f, 0.970772147f, 0.971503913f, 0.972226501f, 0.972939968f, 0.973644257f, 0.974339366f, 0.975025356f,
+	0.975702107f, 0.976369739f, 0.977028131f, 0.977677345f, 0.97831738f, 0.978948176f, 0.979569793f, 0.980182111f,
+	0.980785251f, 0.981379211f, 0.981963873f, 0.982539296f, 0.983105481f, 0.983662426f, 0.984210074f, 0.984748483f,
+	0.985277653f, 0.985797524f, 0.986308098f, 0.986809373f, 0.987301409f, 0.987784147f, 0.988257587f, 0.988721669f,
+	0.989176512f, 0.989621997f, 0.990058184f, 0.990485072f, 0.990902662f, 0.991310835f, 0.991709769f, 0.992099285f,
+	0.992479563f, 0.992850423f, 0.993211925f, 0.993564129f, 0.993906975f, 0.994240463f, 0.994564593f, 0.994879305f,
+	0.99518472f, 0.995480776f, 0.995767415f, 0.996044695f, 0.996312618f, 0.996571124f, 0.996820271f, 0.997060061f,
+	0.997290432f, 0.997511446f, 0.997723043f, 0.997925282f, 0.998118103f, 0.998301566f, 0.998475552f, 0.998640239f,
+	0.99879545f, 0.998941302f, 0.999077737f, 0.999204755f, 0.999322355f, 0.999430597f, 0.999529421f, 0.999618828f,
+	0.999698818f, 0.99976939f, 0.999830604f, 0.99988234f, 0.999924719f, 0.999957621f, 0.999981165f, 0.999995291f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 12
+	0.0f, 0.00153398013f, 0.00306795677f, 0.00460192608f, 0.00613588467f, 0.00766982883f, 0.00920375437f, 0.0107376594f,
+	0.0122715384f, 0.0138053885f, 0.015339206f, 0.0168729872f, 0.0184067301f, 0.0199404284f, 0.0214740802f, 0.0230076816f,
+	0.024541229f, 0.0260747187f, 0.027608145f, 0.029141508f, 0.030674804f, 0.0322080255f, 0.0337411724f, 0.0352742374f,
+	0.0368072242f, 0.0383401215f, 0.0398729257f, 0.0414056405f, 0.0429382585f, 0.0444707721f, 0.0460031815f, 0.0475354828f,
+	0.0490676761f, 0.0505997501f, 0.052131705f, 0.0536635369f, 0.0551952459f, 0.0567268208f, 0.0582582653f, 0.0597895719f,
+	0.061320737f, 0.0628517568f, 0.0643826276f, 0.0659133494f, 0.0674439222f, 0.068974331f, 0.070504576f, 0.0720346496f,
+	0.0735645667f, 0.0750942975f, 0.0766238645f, 0.0781532452f, 0.0796824396f, 0.0812114477f, 0.0827402622f, 0.0842688903f,
+	0.0857973099f, 0.0873255357f, 0.0888535529f, 0.0903813615f, 0.0919089541f, 0.093436338f, 0.0949634984f, 0.0964904279f,
+	0.0980171412f, 0.0995436162f, 0.10106986f, 0.102595866f, 0.104121633f, 0.105647154f, 0.107172422f, 0.108697444f,
+	0.110222206f, 0.111746714f, 0.113270953f, 0.114794925f, 0.116318628f, 0.117842063f, 0.119365215f, 0.120888084f,
+	0.122410677f, 0.123932973f, 0.125454977f, 0.126976699f, 0.128498107f, 0.130019218f, 0.13154003f, 0.13306053f,
+	0.134580702f, 0.136100575f, 0.137620121f, 0.139139339f, 0.140658244f, 0.142176807f, 0.143695027f, 0.145212919f,
+	0.146730468f, 0.148247674f, 0.149764538f, 0.151281044f, 0.152797192f, 0.154312968f, 0.155828401f, 0.157343462f,
+	0.15885815f, 0.160372451f, 0.161886394f, 0.16339995f, 0.164913118f, 0.166425899f, 0.167938292f, 0.169450298f,
+	0.170961887f, 0.172473088f, 0.173983872f, 0.175494254f, 0.177004218f, 0.178513765f, 0.180022895f, 0.181531608f,
+	0.183039889f, 0.184547737f, 0.186055154f, 0.187562123f, 0.18906866f, 0.19057475f, 0.192080393f, 0.19358559f,
+	0.195090324f, 0.196594596f, 0.198098406f, 0.199601755f, 0.201104641f, 0.202607036f, 0.204108968f, 0.205610409f,
+	0.207111374f, 0.208611846f, 0.210111842f, 0.211611331f, 0.213110313f, 0.214608818f, 0.216106802f, 0.21760428f,
+	0.219101235f, 0.220597684f, 0.222093627f, 0.223589033f, 0.225083917f, 0.226578265f, 0.228072077f, 0.229565367f,
+	0.231058106f, 0.232550308f, 0.234041959f, 0.235533059f, 0.237023607f, 0.238513589f, 0.24000302f, 0.241491884f,
+	0.242980182f, 0.244467899f, 0.24595505f, 0.24744162f, 0.248927608f, 0.250413001f, 0.251897812f, 0.253382027f,
+	0.254865646f, 0.25634867f, 0.257831097f, 0.259312928f, 0.260794103f, 0.262274712f, 0.263754666f, 0.265234023f,
+	0.266712755f, 0.268190861f, 0.269668311f, 0.271145165f, 0.272621363f, 0.274096906f, 0.275571823f, 0.277046084f,
+	0.27851969f, 0.27999264f, 0.281464934f, 0.282936573f, 0.284407526f, 0.285877824f, 0.287347466f, 0.288816422f,
+	0.290284663f, 0.291752249f, 0.293219149f, 0.294685364f, 0.296150893f, 0.297615707f, 0.299079835f, 0.300543249f,
+	0.302005947f, 0.303467959f, 0.304929227f, 0.306389809f, 0.307849646f, 0.309308767f, 0.310767144f, 0.312224805f,
+	0.313681751f, 0.315137923f, 0.316593379f, 0.31804809f, 0.319502026f, 0.320955247f, 0.322407693f, 0.323859364f,
+	0.32531029f, 0.326760441f, 0.328209847f, 0.329658449f, 0.331106305f, 0.332553357f, 0.333999664f, 0.335445136f,
+	0.336889863f, 0.338333756f, 0.339776874f, 0.341219217f, 0.342660725f, 0.344101429f, 0.345541328f, 0.346980423f,
+	0.348418683f, 0.349856138f, 0.351292759f, 0.352728546f, 0.354163527f, 0.355597675f, 0.357030958f, 0.358463407f,
+	0.359895051f, 0.3613258f, 0.362755716f, 0.364184797f, 0.365612984f, 0.367040336f, 0.368466824f, 0.369892448f,
+	0.371317208f, 0.372741073f, 0.374164075f, 0.375586182f, 0.377007425f, 0.378427744f, 0.379847199f, 0.381265759f,
+	0.382683426f, 0.384100199f, 0.385516047f, 0.386931002f, 0.388345033f, 0.38975817f, 0.391170382f, 0.392581671f,
+	0.393992037f, 0.395401478f, 0.396809995f, 0.398217559f, 0.399624199f, 0.401029885f, 0.402434647f, 0.403838456f,
+	0.405241311f, 0.406643212f, 0.408044159f, 0.409444153f, 0.410843164f, 0.41224122f, 0.413638324f, 0.415034413f,
+	0.416429549f, 0.417823702f, 0.419216901f, 0.420609087f, 0.422000259f, 0.423390478f, 0.424779683f, 0.426167876f,
+	0.427555084f, 0.42894128f, 0.430326492f, 0.43171066f, 0.433093816f, 0.434475958f, 0.435857087f, 0.437237173f,
+	0.438616246f, 0.439994276f, 0.441371262f, 0.442747235f, 0.444122136f, 0.445496023f, 0.446868837f, 0.448240608f,
+	0.449611336f, 0.450980991f, 0.452349573f, 0.453717113f, 0.455083579f, 0.456448972f, 0.457813293f, 0.45917654f,
+	0.460538715f, 0.461899787f, 0.463259786f, 0.464618683f, 0.465976506f, 0.467333198f, 0.468688816f, 0.470043331f,
+	0.471396744f, 0.472749025f, 0.474100202f, 0.475450277f, 0.47679922f, 0.47814706f, 0.479493767f, 0.480839342f,
+	0.482183784f, 0.483527064f, 0.484869242f, 0.486210287f, 0.487550169f, 0.48888889f, 0.490226477f, 0.491562903f,
+	0.492898196f, 0.494232297f, 0.495565265f, 0.496897042f, 0.498227656f, 0.499557108f, 0.500885367f, 0.502212465f,
+	0.50353837f, 0.504863083f, 0.506186664f, 0.507508993f, 0.50883013f, 0.510150075f, 0.511468828f, 0.512786388f,
+	0.514102757f, 0.515417874f, 0.516731799f, 0.518044531f, 0.519356012f, 0.520666242f, 0.521975279f, 0.523283124f,
+	0.524589658f, 0.525895f, 0.527199149f, 0.528501987f, 0.529803634f, 0.531104028f, 0.532403111f, 0.533701003f,
+	0.534997642f, 0.53629297f, 0.537587047f, 0.538879931f, 0.540171444f, 0.541461766f, 0.542750776f, 0.544038534f,
+	0.545324981f, 0.546610177f, 0.547894061f, 0.549176633f, 0.550457954f, 0.551737964f, 0.553016722f, 0.554294109f,
+	0.555570245f, 0.556845009f, 0.558118522f, 0.559390724f, 0.560661554f, 0.561931133f, 0.563199341f, 0.564466238f,
+	0.565731823f, 0.566996038f, 0.568258941f, 0.569520533f, 0.570780754f, 0.572039604f, 0.573297143f, 0.57455337f,
+	0.575808167f, 0.577061653f, 0.578313768f, 0.579564571f, 0.580813944f, 0.582062006f, 0.583308637f, 0.584553957f,
+	0.585797846f, 0.587040365f, 0.588281572f, 0.589521289f, 0.590759695f, 0.59199667f, 0.593232274f, 0.594466507f,
+	0.59569931f, 0.596930683f, 0.598160684f, 0.599389315f, 0.600616455f, 0.601842225f, 0.603066623f, 0.604289532f,
+	0.605511069f, 0.606731117f, 0.607949793f, 0.609167039f, 0.610382795f, 0.61159718f, 0.612810075f, 0.61402154f,
+	0.615231574f, 0.616440177f, 0.61764729f, 0.618852973f, 0.620057225f, 0.621259987f, 0.622461259f, 0.623661101f,
+	0.624859512f, 0.626056373f, 0.627251804f, 0.628445745f, 0.629638255f, 0.630829215f, 0.632018745f, 0.633206785f,
+	0.634393275f, 0.635578334f, 0.636761844f, 0.637943923f, 0.639124453f, 0.640303493f, 0.641481042f, 0.642657042f,
+	0.643831551f, 0.645004511f, 0.64617604f, 0.64734596f, 0.64851439f, 0.64968133f, 0.65084666f, 0.65201056f,
+	0.653172851f, 0.654333591f, 0.655492842f, 0.656650543f, 0.657806695f, 0.658961296f, 0.660114348f, 0.66126585f,
+	0.662415802f, 0.663564146f, 0.664710999f, 0.665856242f, 0.666999936f, 0.668142021f, 0.669282615f, 0.670421541f,
+	0.671558976f, 0.672694743f, 0.673829019f, 0.674961627f, 0.676092684f, 0.677222192f, 0.678350031f, 0.679476321f,
+	0.680601001f, 0.681724072f, 0.682845533f, 0.683965385f, 0.685083687f, 0.686200321f, 0.687315345f, 0.68842876f,
+	0.689540565f, 0.690650702f, 0.691759229f, 0.692866147f, 0.693971455f, 0.695075095f, 0.696177125f, 0.697277486f,
+	0.698376238f, 0.699473321f, 0.700568795f, 0.7016626f, 0.702754736f, 0.703845263f, 0.704934061f, 0.706021249f,
+	0.707106769f, 0.70819062f, 0.709272802f, 0.710353374f, 0.711432219f, 0.712509394f, 0.71358484f, 0.714658678f,
+	0.715730846f, 0.716801286f, 0.717870057f, 0.718937099f, 0.720002532f, 0.721066177f, 0.722128212f, 0.72318846f,
+	0.724247098f, 0.725303948f, 0.726359129f, 0.727412641f, 0.728464365f, 0.72951442f, 0.730562747f, 0.731609404f,
+	0.732654274f, 0.733697414f, 0.734738886f, 0.73577857f, 0.736816585f, 0.737852812f, 0.73888731f, 0.73992008f,
+	0.740951121f, 0.741980433f, 0.743007958f, 0.744033754f, 0.745057762f, 0.746080101f, 0.747100592f, 0.748119354f,
+	0.749136388f, 0.750151634f, 0.751165152f, 0.752176821f, 0.753186822f, 0.754194975f, 0.755201399f, 0.756205976f,
+	0.757208824f, 0.758209884f, 0.759209216f, 0.760206699f, 0.761202395f, 0.762196302f, 0.763188422f, 0.764178753f,
+	0.765167236f, 0.766153991f, 0.767138898f, 0.768122017f, 0.769103348f, 0.770082831f, 0.771060526f, 0.772036374f,
+	0.773010433f, 0.773982704f, 0.774953127f, 0.775921702f, 0.77688849f, 0.777853429f, 0.778816521f, 0.779777765f,
+	0.780737221f, 0.781694829f, 0.78265059f, 0.783604503f, 0.784556568f, 0.785506845f, 0.786455214f, 0.787401736f,
+	0.78834641f, 0.789289236f, 0.790230215f, 0.791169345f, 0.792106569f, 0.793041945f, 0.793975472f, 0.794907153f,
+	0.795836926f, 0.796764791f, 0.797690868f, 0.798614979f, 0.799537241f, 0.800457656f, 0.801376164f, 0.802292824f,
+	0.803207517f, 0.804120362f, 0.805031359f, 0.80594039f, 0.806847572f, 0.807752848f, 0.808656156f, 0.809557617f,
+	0.81045717f, 0.811354876f, 0.812250614f, 0.813144386f, 0.81403631f, 0.814926326f, 0.815814435f, 0.816700578f,
+	0.817584813f, 0.81846714f, 0.819347501f, 0.820225954f, 0.8211025f, 0.821977139f, 0.82284981f, 0.823720515f,
+	0.824589312f, 0.825456142f, 0.826321065f, 0.827184021f, 0.82804507f, 0.828904092f, 0.829761207f, 0.830616415f,
+	0.831469595f, 0.832320869f, 0.833170176f, 0.834017515f, 0.834862888f, 0.835706294f, 0.836547732f, 0.837387204f,
+	0.838224709f, 0.839060247f, 0.839893818f, 0.840725362f, 0.841554999f, 0.84238261f, 0.843208253f, 0.84403187f,
+	0.84485358f, 0.845673263f, 0.84649092f, 0.847306609f, 0.848120332f, 0.848932028f, 0.849741757f, 0.850549459f,
+	0.851355195f, 0.852158904f, 0.852960587f, 0.853760302f, 0.854557991f, 0.855353653f, 0.856147349f, 0.856938958f,
+	0.857728601f, 0.858516216f, 0.859301805f, 0.860085368f, 0.860866964f, 0.861646473f, 0.862423956f, 0.863199413f,
+	0.863972843f, 0.864744246f, 0.865513623f, 0.866280973f, 0.867046237f, 0.867809474f, 0.868570685f, 0.86932987f,
+	0.870086968f, 0.87084204f, 0.871595085f, 0.872346044f, 0.873094976f, 0.873841822f, 0.874586642f, 0.875329375f,
+	0.876070082f, 0.876808703f, 0.877545297f, 0.878279805f, 0.879012227f, 0.879742622f, 0.880470872f, 0.881197095f,
+	0.881921291f, 0.882643342f, 0.883363366f, 0.884081244f, 0.884797096f, 0.885510862f, 0.886222541f, 0.886932135f,
+	0.887639642f, 0.888345063f, 0.889048338f, 0.889749587f, 0.890448749f, 0.891145766f, 0.891840696f, 0.892533541f,
+	0.893224299f, 0.893912971f, 0.894599497f, 0.895283937f, 0.895966232f, 0.8966465f, 0.897324562f, 0.898000598f,
+	0.898674488f, 0.899346232f, 0.900015891f, 0.900683403f, 0.901348829f, 0.902012169f, 0.902673304f, 0.903332353f,
+	0.903989315f, 0.904644072f, 0.905296743f, 0.905947268f, 0.906595707f, 0.907242f, 0.907886088f, 0.90852809f,
+	0.909168005f, 0.909805715f, 0.910441279f, 0.911074758f, 0.91170603f, 0.912335157f, 0.912962198f, 0.913587034f,
+	0.914209783f, 0.914830327f, 0.915448725f, 0.916064978f, 0.916679084f, 0.917290986f, 0.917900801f, 0.91850841f,
+	0.919113874f, 0.919717133f, 0.920318305f, 0.920917213f, 0.921514034f, 0.92210865f, 0.92270112f, 0.923291445f,
+	0.923879504f, 0.924465477f, 0.925049245f, 0.925630808f, 0.926210225f, 0.926787496f, 0.927362502f, 0.927935421f,
+	0.928506076f, 0.929074585f, 0.929640889f, 0.930205047f, 0.93076694f, 0.931326687f, 0.931884289f, 0.932439625f,
+	0.932992816f, 0.933543801f, 0.934092522f, 0.934639156f, 0.935183525f, 0.935725689f, 0.936265647f, 0.93680346f,
+	0.937339008f, 0.93787235f, 0.938403547f, 0.938932478f, 0.939459205f, 0.939983726f, 0.940506041f, 0.941026151f,
+	0.941544056f, 0.942059755f, 0.94257319f, 0.943084419f, 0.943593442f, 0.944100261f, 0.944604814f, 0.945107222f,
+	0.945607305f, 0.946105242f, 0.946600914f, 0.947094381f, 0.947585583f, 0.948074579f, 0.94856137f, 0.949045897f,
+	0.949528158f, 0.950008273f, 0.950486064f, 0.950961649f, 0.95143503f, 0.951906145f, 0.952374995f, 0.95284164f,
+	0.953306019f, 0.953768194f, 0.954228103f, 0.954685748f, 0.955141187f, 0.955594361f, 0.95604527f, 0.956493914f,
+	0.956940353f, 0.957384527f, 0.957826436f, 0.958266079f, 0.958703458f, 0.959138632f, 0.95957154f, 0.960002124f,
+	0.960430503f, 0.960856616f, 0.961280465f, 0.961702049f, 0.962121427f, 0.962538481f, 0.962953269f, 0.963365793f,
+	0.963776052f, 0.964184046f, 0.964589775f, 0.964993238f, 0.965394437f, 0.965793371f, 0.966189981f, 0.966584384f,
+	0.966976464f, 0.967366278f, 0.967753828f, 0.968139112f, 0.968522072f, 0.968902826f, 0.969281256f, 0.969657362f,
+	0.970031261f, 0.970402837f, 0.970772147f, 0.971139133f, 0.971503913f, 0.97186631f, 0.972226501f, 0.972584367f,
+	0.972939968f, 0.973293245f, 0.973644257f, 0.973992944f, 0.974339366f, 0.974683523f, 0.975025356f, 0.975364864f,
+	0.975702107f, 0.976037085f, 0.976369739f, 0.976700068f, 0.977028131f, 0.977353871f, 0.977677345f, 0.977998495f,
+	0.97831738f, 0.97863394f, 0.978948176f, 0.979260147f, 0.979569793f, 0.979877114f, 0.980182111f, 0.980484843f,
+	0.980785251f, 0.981083393f, 0.981379211f, 0.981672704f, 0.981963873f, 0.982252717f, 0.982539296f, 0.982823551f,
+	0.983105481f, 0.983385086f, 0.983662426f, 0.983937442f, 0.984210074f, 0.984480441f, 0.984748483f, 0.98501426f,
+	0.985277653f, 0.985538721f, 0.985797524f, 0.986053944f, 0.986308098f, 0.986559927f, 0.986809373f, 0.987056553f,
+	0.987301409f, 0.987543941f, 0.987784147f, 0.988022029f, 0.988257587f, 0.98849082f, 0.988721669f, 0.988950253f,
+	0.989176512f, 0.989400446f, 0.989621997f, 0.989841282f, 0.990058184f, 0.99027282f, 0.990485072f, 0.990695f,
+	0.990902662f, 0.991107941f, 0.991310835f, 0.991511464f, 0.991709769f, 0.991905689f, 0.992099285f, 0.992290616f,
+	0.992479563f, 0.992666125f, 0.992850423f, 0.993032336f, 0.993211925f, 0.993389189f, 0.993564129f, 0.993736744f,
+	0.993906975f, 0.994074881f, 0.994240463f, 0.99440366f, 0.994564593f, 0.994723141f, 0.994879305f, 0.995033205f,
+	0.99518472f, 0.99533391f, 0.995480776f, 0.995625257f, 0.995767415f, 0.995907247f, 0.996044695f, 0.996179819f,
+	0.996312618f, 0.996443033f, 0.996571124f, 0.996696889f, 0.996820271f, 0.996941328f, 0.997060061f, 0.997176409f,
+	0.997290432f, 0.997402132f, 0.997511446f, 0.997618437f, 0.997723043f, 0.997825325f, 0.997925282f, 0.998022854f,
+	0.998118103f, 0.998211026f, 0.998301566f, 0.998389721f, 0.998475552f, 0.998559058f, 0.998640239f, 0.998719037f,
+	0.99879545f, 0.998869538f, 0.998941302f, 0.999010682f, 0.999077737f, 0.999142408f, 0.999204755f, 0.999264777f,
+	0.999322355f, 0.999377668f, 0.999430597f, 0.999481201f, 0.999529421f, 0.999575317f, 0.999618828f, 0.999660015f,
+	0.999698818f, 0.999735296f, 0.99976939f, 0.999801159f, 0.999830604f, 0.999857664f, 0.99988234f, 0.999904692f,
+	0.999924719f, 0.999942362f, 0.999957621f, 0.999970615f, 0.999981165f, 0.99998939f, 0.999995291f, 0.999998808f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 13
+	0.0f, 0.000766990299f, 0.00153398013f, 0.00230096909f, 0.00306795677f, 0.00383494259f, 0.00460192608f, 0.005368907f,
+	0.00613588467f, 0.00690285861f, 0.00766982883f, 0.00843679439f, 0.00920375437f, 0.00997070968f, 0.0107376594f, 0.0115046017f,
+	0.0122715384f, 0.0130384676f, 0.0138053885f, 0.0145723019f, 0.015339206f, 0.0161061026f, 0.0168729872f, 0.0176398642f,
+	0.0184067301f, 0.0191735849f, 0.0199404284f, 0.0207072608f, 0.0214740802f, 0.0222408883f, 0.0230076816f, 0.0237744618f,
+	0.024541229f, 0.0253079813f, 0.0260747187f, 0.0268414393f, 0.027608145f, 0.0283748358f, 0.029141508f, 0.0299081653f,
+	0.030674804f, 0.031441424f, 0.0322080255f, 0.0329746082f, 0.0337411724f, 0.0345077142f, 0.0352742374f, 0.036040742f,
+	0.0368072242f, 0.037573684f, 0.0383401215f, 0.0391065367f, 0.0398729257f, 0.0406392962f, 0.0414056405f, 0.0421719626f,
+	0.0429382585f, 0.0437045284f, 0.0444707721f, 0.0452369899f, 0.0460031815f, 0.046769347f, 0.0475354828f, 0.0483015925f,
+	0.0490676761f, 0.0498337261f, 0.0505997501f, 0.0513657406f, 0.052131705f, 0.0528976358f, 0.0536635369f, 0.0544294082f,
+	0.0551952459f, 0.0559610501f, 0.0567268208f, 0.0574925579f, 0.0582582653f, 0.0590239353f, 0.0597895719f, 0.0605551712f,
+	0.061320737f, 0.0620862655f, 0.0628517568f, 0.0636172146f, 0.0643826276f, 0.0651480108f, 0.0659133494f, 0.0666786581f,
+	0.0674439222f, 0.0682091415f, 0.068974331f, 0.0697394684f, 0.070504576f, 0.0712696314f, 0.0720346496f, 0.0727996305f,
+	0.0735645667f, 0.0743294507f, 0.0750942975f, 0.0758591071f, 0.0766238645f, 0.0773885772f, 0.0781532452f, 0.078917861f,
+	0.0796824396f, 0.080446966f, 0.0812114477f, 0.0819758773f, 0.0827402622f, 0.0835046023f, 0.0842688903f, 0.0850331262f,
+	0.0857973099f, 0.0865614489f, 0.0873255357f, 0.0880895704f, 0.0888535529f, 0.0896174833f, 0.0903813615f, 0.0911451876f,
+	0.0919089541f, 0.0926726758f, 0.093436338f, 0.0941999406f, 0.0949634984f, 0.0957269892f, 0.0964904279f, 0.0972538143f,
+	0.0980171412f, 0.0987804085f, 0.0995436162f, 0.100306772f, 0.10106986f, 0.101832896f, 0.102595866f, 0.103358783f,
+	0.104121633f, 0.104884423f, 0.105647154f, 0.106409818f, 0.107172422f, 0.107934967f, 0.108697444f, 0.109459855f,
+	0.110222206f, 0.110984489f, 0.111746714f, 0.112508863f, 0.113270953f, 0.114032976f, 0.114794925f, 0.115556814f,
+	0.116318628f, 0.117080383f, 0.117842063f, 0.118603677f, 0.119365215f, 0.120126687f, 0.120888084f, 0.121649414f,
+	0.122410677f, 0.123171858f, 0.123932973f, 0.12469402f, 0.125454977f, 0.126215875f, 0.126976699f, 0.127737448f,
+	0.128498107f, 0.129258707f, 0.130019218f, 0.130779669f, 0.13154003f, 0.132300317f, 0.13306053f, 0.133820653f,
+	0.134580702f, 0.135340676f, 0.136100575f, 0.136860386f, 0.137620121f, 0.138379768f, 0.139139339f, 0.139898837f,
+	0.140658244f, 0.141417563f, 0.142176807f, 0.142935961f, 0.143695027f, 0.144454017f, 0.145212919f, 0.145971745f,
+	0.146730468f, 0.147489116f, 0.148247674f, 0.149006143f, 0.149764538f, 0.150522828f, 0.151281044f, 0.152039155f,
+	0.152797192f, 0.153555125f, 0.154312968f, 0.155070737f, 0.155828401f, 0.156585976f, 0.157343462f, 0.158100843f,
+	0.15885815f, 0.159615353f, 0.160372451f, 0.161129475f, 0.161886394f, 0.162643224f, 0.16339995f, 0.164156586f,
+	0.164913118f, 0.16566956f, 0.166425899f, 0.167182148f, 0.167938292f, 0.168694347f, 0.169450298f, 0.170206144f,
+	0.170961887f, 0.171717539f, 0.172473088f, 0.173228532f, 0.173983872f, 0.174739107f, 0.175494254f, 0.176249295f,
+	0.177004218f, 0.177759051f, 0.178513765f, 0.17926839f, 0.180022895f, 0.180777311f, 0.181531608f, 0.182285801f,
+	0.183039889f, 0.183793873f, 0.184547737f, 0.185301498f, 0.186055154f, 0.18680869f, 0.187562123f, 0.188315451f,
+	0.18906866f, 0.189821765f, 0.19057475f, 0.191327631f, 0.192080393f, 0.192833051f, 0.19358559f, 0.194338009f,
+	0.195090324f, 0.195842519f, 0.196594596f, 0.197346568f, 0.198098406f, 0.19885014f, 0.199601755f, 0.20035325f,
+	0.201104641f, 0.201855898f, 0.202607036f, 0.203358069f, 0.204108968f, 0.204859748f, 0.205610409f, 0.206360951f,
+	0.207111374f, 0.207861677f, 0.208611846f, 0.209361911f, 0.210111842f, 0.210861638f, 0.211611331f, 0.212360889f,
+	0.213110313f, 0.213859633f, 0.214608818f, 0.21535787f, 0.216106802f, 0.2168556f, 0.21760428f, 0.218352824f,
+	0.219101235f, 0.219849527f, 0.220597684f, 0.221345723f, 0.222093627f, 0.222841397f, 0.223589033f, 0.224336535f,
+	0.225083917f, 0.225831151f, 0.226578265f, 0.227325246f, 0.228072077f, 0.228818789f, 0.229565367f, 0.230311811f,
+	0.231058106f, 0.231804281f, 0.232550308f, 0.233296201f, 0.234041959f, 0.234787583f, 0.235533059f, 0.2362784f,
+	0.237023607f, 0.237768665f, 0.238513589f, 0.239258379f, 0.24000302f, 0.240747526f, 0.241491884f, 0.242236108f,
+	0.242980182f, 0.243724108f, 0.244467899f, 0.245211542f, 0.24595505f, 0.246698409f, 0.24744162f, 0.248184681f,
+	0.248927608f, 0.249670386f, 0.250413001f, 0.251155496f, 0.251897812f, 0.252640009f, 0.253382027f, 0.254123926f,
+	0.254865646f, 0.255607247f, 0.25634867f, 0.257089972f, 0.257831097f, 0.258572072f, 0.259312928f, 0.260053605f,
+	0.260794103f, 0.261534482f, 0.262274712f, 0.263014764f, 0.263754666f, 0.264494419f, 0.265234023f, 0.265973479f,
+	0.266712755f, 0.267451882f, 0.268190861f, 0.26892966f, 0.269668311f, 0.270406812f, 0.271145165f, 0.271883339f,
+	0.272621363f, 0.273359209f, 0.274096906f, 0.274834454f, 0.275571823f, 0.276309043f, 0.277046084f, 0.277782977f,
+	0.27851969f, 0.279256254f, 0.27999264f, 0.280728877f, 0.281464934f, 0.282200843f, 0.282936573f, 0.283672124f,
+	0.284407526f, 0.285142779f, 0.285877824f, 0.286612719f, 0.287347466f, 0.288082033f, 0.288816422f, 0.289550632f,
+	0.290284663f, 0.291018546f, 0.291752249f, 0.292485803f, 0.293219149f, 0.293952346f, 0.294685364f, 0.295418203f,
+	0.296150893f, 0.296883374f, 0.297615707f, 0.298347861f, 0.299079835f, 0.299811631f, 0.300543249f, 0.301274687f,
+	0.302005947f, 0.302737027f, 0.303467959f, 0.304198682f, 0.304929227f, 0.305659592f, 0.306389809f, 0.307119817f,
+	0.307849646f, 0.308579296f, 0.309308767f, 0.31003806f, 0.310767144f, 0.311496079f, 0.312224805f, 0.312953383f,
+	0.313681751f, 0.314409941f, 0.315137923f, 0.315865755f, 0.316593379f, 0.317320824f, 0.31804809f, 0.318775147f,
+	0.319502026f, 0.320228726f, 0.320955247f, 0.321681559f, 0.322407693f, 0.323133618f, 0.323859364f, 0.324584931f,
+	0.32531029f, 0.32603547f, 0.326760441f, 0.327485234f, 0.328209847f, 0.328934252f, 0.329658449f, 0.330382496f,
+	0.331106305f, 0.331829935f, 0.332553357f, 0.3332766f, 0.333999664f, 0.334722489f, 0.335445136f, 0.336167604f,
+	0.336889863f, 0.337611914f, 0.338333756f, 0.339055419f, 0.339776874f, 0.340498149f, 0.341219217f, 0.341940075f,
+	0.342660725f, 0.343381166f, 0.344101429f, 0.344821483f, 0.345541328f, 0.346260965f, 0.346980423f, 0.347699642f,
+	0.348418683f, 0.349137515f, 0.349856138f, 0.350574553f, 0.351292759f, 0.352010757f, 0.352728546f, 0.353446156f,
+	0.354163527f, 0.354880691f, 0.355597675f, 0.356314421f, 0.357030958f, 0.357747287f, 0.358463407f, 0.359179348f,
+	0.359895051f, 0.360610515f, 0.3613258f, 0.362040877f, 0.362755716f, 0.363470376f, 0.364184797f, 0.364899009f,
+	0.365612984f, 0.366326779f, 0.367040336f, 0.367753685f, 0.368466824f, 0.369179755f, 0.369892448f, 0.370604932f,
+	0.371317208f, 0.372029245f, 0.372741073f, 0.373452663f, 0.374164075f, 0.374875218f, 0.375586182f, 0.376296908f,
+	0.377007425f, 0.377717704f, 0.378427744f, 0.379137605f, 0.379847199f, 0.380556613f, 0.381265759f, 0.381974727f,
+	0.382683426f, 0.383391917f, 0.384100199f, 0.384808242f, 0.385516047f, 0.386223644f, 0.386931002f, 0.387638152f,
+	0.388345033f, 0.389051735f, 0.38975817f, 0.390464395f, 0.391170382f, 0.391876131f, 0.392581671f, 0.393286973f,
+	0.393992037f, 0.394696862f, 0.395401478f, 0.396105856f, 0.396809995f, 0.397513896f, 0.398217559f, 0.398921013f,
+	0.399624199f, 0.400327176f, 0.401029885f, 0.401732385f, 0.402434647f, 0.403136671f, 0.403838456f, 0.404540002f,
+	0.405241311f, 0.40594238f, 0.406643212f, 0.407343805f, 0.408044159f, 0.408744276f, 0.409444153f, 0.410143793f,
+	0.410843164f, 0.411542326f, 0.41224122f, 0.412939876f, 0.413638324f, 0.414336503f, 0.415034413f, 0.415732116f,
+	0.416429549f, 0.417126775f, 0.417823702f, 0.418520421f, 0.419216901f, 0.419913113f, 0.420609087f, 0.421304792f,
+	0.422000259f, 0.422695488f, 0.423390478f, 0.4240852f, 0.424779683f, 0.425473899f, 0.426167876f, 0.426861614f,
+	0.427555084f, 0.428248316f, 0.42894128f, 0.429634005f, 0.430326492f, 0.43101871f, 0.43171066f, 0.432402372f,
+	0.433093816f, 0.433785021f, 0.434475958f, 0.435166657f, 0.435857087f, 0.43654725f, 0.437237173f, 0.437926829f,
+	0.438616246f, 0.439305395f, 0.439994276f, 0.440682888f, 0.441371262f, 0.442059368f, 0.442747235f, 0.443434805f,
+	0.444122136f, 0.444809198f, 0.445496023f, 0.446182549f, 0.446868837f, 0.447554857f, 0.448240608f, 0.448926091f,
+	0.449611336f, 0.450296283f, 0.450980991f, 0.451665431f, 0.452349573f, 0.453033477f, 0.453717113f, 0.45440048f,
+	0.455083579f, 0.45576641f, 0.456448972f, 0.457131267f, 0.457813293f, 0.458495051f, 0.45917654f, 0.459857762f,
+	0.460538715f, 0.4612194f, 0.461899787f, 0.462579936f, 0.463259786f, 0.463939369f, 0.464618683f, 0.465297729f,
+	0.465976506f, 0.466654986f, 0.467333198f, 0.468011141f, 0.468688816f, 0.469366223f, 0.470043331f, 0.470720172f,
+	0.471396744f, 0.472073019f, 0.472749025f, 0.473424762f, 0.474100202f, 0.474775374f, 0.475450277f, 0.476124883f,
+	0.47679922f, 0.477473289f, 0.47814706f, 0.478820562f, 0.479493767f, 0.480166674f, 0.480839342f, 0.481511682f,
+	0.482183784f, 0.482855558f, 0.483527064f, 0.484198302f, 0.484869242f, 0.485539913f, 0.486210287f, 0.486880362f,
+	0.487550169f, 0.488219678f, 0.48888889f, 0.489557832f, 0.490226477f, 0.490894854f, 0.491562903f, 0.492230713f,
+	0.492898196f, 0.49356541f, 0.494232297f, 0.494898945f, 0.495565265f, 0.496231288f, 0.496897042f, 0.497562498f,
+	0.498227656f, 0.498892546f, 0.499557108f, 0.500221372f, 0.500885367f, 0.501549065f, 0.502212465f, 0.502875566f,
+	0.50353837f, 0.504200876f, 0.504863083f, 0.505525053f, 0.506186664f, 0.506847978f, 0.507508993f, 0.508169711f,
+	0.50883013f, 0.509490252f, 0.510150075f, 0.5108096f, 0.511468828f, 0.512127757f, 0.512786388f, 0.513444722f,
+	0.514102757f, 0.514760435f, 0.515417874f, 0.516075015f, 0.516731799f, 0.517388284f, 0.518044531f, 0.518700421f,
+	0.519356012f, 0.520011246f, 0.520666242f, 0.521320939f, 0.521975279f, 0.52262938f, 0.523283124f, 0.52393657f,
+	0.524589658f, 0.525242507f, 0.525895f, 0.526547253f, 0.527199149f, 0.527850747f, 0.528501987f, 0.529152989f,
+	0.529803634f, 0.53045398f, 0.531104028f, 0.531753719f, 0.532403111f, 0.533052206f, 0.533701003f, 0.534349442f,
+	0.534997642f, 0.535645485f, 0.53629297f, 0.536940157f, 0.537587047f, 0.538233638f, 0.538879931f, 0.539525867f,
+	0.540171444f, 0.540816784f, 0.541461766f, 0.54210645f, 0.542750776f, 0.543394804f, 0.544038534f, 0.544681907f,
+	0.545324981f, 0.545967758f, 0.546610177f, 0.547252297f, 0.547894061f, 0.548535526f, 0.549176633f, 0.549817502f,
+	0.550457954f, 0.551098168f, 0.551737964f, 0.552377522f, 0.553016722f, 0.553655565f, 0.554294109f, 0.554932356f,
+	0.555570245f, 0.556207776f, 0.556845009f, 0.557481945f, 0.558118522f, 0.558754802f, 0.559390724f, 0.560026288f,
+	0.560661554f, 0.561296523f, 0.561931133f, 0.562565386f, 0.563199341f, 0.563832939f, 0.564466238f, 0.56509918f,
+	0.565731823f, 0.56636411f, 0.566996038f, 0.567627668f, 0.568258941f, 0.568889916f, 0.569520533f, 0.570150793f,
+	0.570780754f, 0.571410358f, 0.572039604f, 0.572668552f, 0.573297143f, 0.573925436f, 0.57455337f, 0.575180948f,
+	0.575808167f, 0.576435089f, 0.577061653f, 0.577687919f, 0.578313768f, 0.578939319f, 0.579564571f, 0.580189407f,
+	0.580813944f, 0.581438124f, 0.582062006f, 0.582685471f, 0.583308637f, 0.583931446f, 0.584553957f, 0.585176051f,
+	0.585797846f, 0.586419284f, 0.587040365f, 0.587661147f, 0.588281572f, 0.588901579f, 0.589521289f, 0.5901407f,
+	0.590759695f, 0.591378391f, 0.59199667f, 0.592614651f, 0.593232274f, 0.593849599f, 0.594466507f, 0.595083058f,
+	0.59569931f, 0.596315205f, 0.596930683f, 0.597545862f, 0.598160684f, 0.598775208f, 0.599389315f, 0.600003064f,
+	0.600616455f, 0.601229548f, 0.601842225f, 0.602454603f, 0.603066623f, 0.603678226f, 0.604289532f, 0.604900479f,
+	0.605511069f, 0.606121242f, 0.606731117f, 0.607340634f, 0.607949793f, 0.608558595f, 0.609167039f, 0.609775066f,
+	0.610382795f, 0.610990167f, 0.61159718f, 0.612203777f, 0.612810075f, 0.613416016f, 0.61402154f, 0.614626765f,
+	0.615231574f, 0.615836084f, 0.616440177f, 0.617043912f, 0.61764729f, 0.61825031f, 0.618852973f, 0.619455278f,
+	0.620057225f, 0.620658755f, 0.621259987f, 0.621860802f, 0.622461259f, 0.623061359f, 0.623661101f, 0.624260485f,
+	0.624859512f, 0.625458121f, 0.626056373f, 0.626654267f, 0.627251804f, 0.627848983f, 0.628445745f, 0.629042208f,
+	0.629638255f, 0.630233943f, 0.630829215f, 0.631424189f, 0.632018745f, 0.632612944f, 0.633206785f, 0.633800209f,
+	0.634393275f, 0.634985983f, 0.635578334f, 0.636170268f, 0.636761844f, 0.637353063f, 0.637943923f, 0.638534367f,
+	0.639124453f, 0.639714181f, 0.640303493f, 0.640892446f, 0.641481042f, 0.642069221f, 0.642657042f, 0.643244505f,
+	0.643831551f, 0.64441824f, 0.645004511f, 0.645590484f, 0.64617604f, 0.646761179f, 0.64734596f, 0.647930384f,
+	0.64851439f, 0.649098039f, 0.64968133f, 0.650264204f, 0.65084666f, 0.651428819f, 0.65201056f, 0.652591884f,
+	0.653172851f, 0.6537534f, 0.654333591f, 0.654913425f, 0.655492842f, 0.656071901f, 0.656650543f, 0.657228827f,
+	0.657806695f, 0.658384204f, 0.658961296f, 0.659538031f, 0.660114348f, 0.660690308f, 0.66126585f, 0.661840975f,
+	0.662415802f, 0.662990153f, 0.663564146f, 0.664137781f, 0.664710999f, 0.665283799f, 0.665856242f, 0.666428268f,
+	0.666999936f, 0.667571187f, 0.668142021f, 0.668712497f, 0.669282615f, 0.669852257f, 0.670421541f, 0.670990467f,
+	0.671558976f, 0.672127068f, 0.672694743f, 0.67326206f, 0.673829019f, 0.674395502f, 0.674961627f, 0.675527394f,
+	0.676092684f, 0.676657617f, 0.677222192f, 0.677786291f, 0.678350031f, 0.678913355f, 0.679476321f, 0.680038869f,
+	0.680601001f, 0.681162715f, 0.681724072f, 0.682285011f, 0.682845533f, 0.683405697f, 0.683965385f, 0.684524715f,
+	0.685083687f, 0.685642183f, 0.686200321f, 0.686758041f, 0.687315345f, 0.687872231f, 0.68842876f, 0.688984871f,
+	0.689540565f, 0.690095842f, 0.690650702f, 0.691205204f, 0.691759229f, 0.692312896f, 0.692866147f, 0.693419039f,
+	0.693971455f, 0.694523513f, 0.695075095f, 0.695626318f, 0.696177125f, 0.696727514f, 0.697277486f, 0.697827101f,
+	0.698376238f, 0.698925018f, 0.699473321f, 0.700021267f, 0.700568795f, 0.701115906f, 0.7016626f, 0.702208877f,
+	0.702754736f, 0.703300178f, 0.703845263f, 0.70438987f, 0.704934061f, 0.705477893f, 0.706021249f, 0.706564248f,
+	0.707106769f, 0.707648933f, 0.70819062f, 0.708731949f, 0.709272802f, 0.709813297f, 0.710353374f, 0.710892975f,
+	0.711432219f, 0.711970985f, 0.712509394f, 0.713047326f, 0.71358484f, 0.714121997f, 0.714658678f, 0.715194941f,
+	0.715730846f, 0.716266274f, 0.716801286f, 0.71733588f, 0.717870057f, 0.718403816f, 0.718937099f, 0.719470024f,
+	0.720002532f, 0.720534563f, 0.721066177f, 0.721597433f, 0.722128212f, 0.722658575f, 0.72318846f, 0.723717988f,
+	0.724247098f, 0.724775732f, 0.725303948f, 0.725831807f, 0.726359129f, 0.726886094f, 0.727412641f, 0.727938712f,
+	0.728464365f, 0.728989601f, 0.72951442f, 0.730038822f, 0.730562747f, 0.731086314f, 0.731609404f, 0.732132018f,
+	0.732654274f, 0.733176053f, 0.733697414f, 0.734218359f, 0.734738886f, 0.735258937f, 0.73577857f, 0.736297786f,
+	0.736816585f, 0.737334907f, 0.737852812f, 0.738370299f, 0.73888731f, 0.739403903f, 0.73992008f, 0.740435839f,
+	0.740951121f, 0.741465986f, 0.741980433f, 0.742494404f, 0.743007958f, 0.743521094f, 0.744033754f, 0.744545996f,
+	0.745057762f, 0.74556917f, 0.746080101f, 0.746590555f, 0.747100592f, 0.747610211f, 0.748119354f, 0.74862808f,
+	0.749136388f, 0.74964422f, 0.750151634f, 0.750658631f, 0.751165152f, 0.751671195f, 0.752176821f, 0.75268203f,
+	0.753186822f, 0.753691137f, 0.754194975f, 0.754698396f, 0.755201399f, 0.755703926f, 0.756205976f, 0.756707668f,
+	0.757208824f, 0.757709622f, 0.758209884f, 0.758709788f, 0.759209216f, 0.759708166f, 0.760206699f, 0.760704756f,
+	0.761202395f, 0.761699557f, 0.762196302f, 0.762692571f, 0.763188422f, 0.763683796f, 0.764178753f, 0.764673233f,
+	0.765167236f, 0.765660882f, 0.766153991f, 0.766646683f, 0.767138898f, 0.767630696f, 0.768122017f, 0.768612921f,
+	0.769103348f, 0.769593298f, 0.770082831f, 0.770571887f, 0.771060526f, 0.771548688f, 0.772036374f, 0.772523642f,
+	0.773010433f, 0.773496807f, 0.773982704f, 0.774468124f, 0.774953127f, 0.775437653f, 0.775921702f, 0.776405334f,
+	0.77688849f, 0.777371168f, 0.777853429f, 0.778335214f, 0.778816521f, 0.779297352f, 0.779777765f, 0.780257761f,
+	0.780737221f, 0.781216264f, 0.781694829f, 0.782172918f, 0.78265059f, 0.783127785f, 0.783604503f, 0.784080803f,
+	0.784556568f, 0.785031915f, 0.785506845f, 0.785981238f, 0.786455214f, 0.786928713f, 0.787401736f, 0.787874341f,
+	0.78834641f, 0.788818061f, 0.789289236f, 0.789759994f, 0.790230215f, 0.790700018f, 0.791169345f, 0.791638196f,
+	0.792106569f, 0.792574525f, 0.793041945f, 0.793508947f, 0.793975472f, 0.794441521f, 0.794907153f, 0.795372248f,
+	0.795836926f, 0.796301067f, 0.796764791f, 0.797228038f, 0.797690868f, 0.798153162f, 0.798614979f, 0.799076378f,
+	0.799537241f, 0.799997687f, 0.800457656f, 0.800917149f, 0.801376164f, 0.801834702f, 0.802292824f, 0.802750409f,
+	0.803207517f, 0.803664207f, 0.804120362f, 0.804576099f, 0.805031359f, 0.805486083f, 0.80594039f, 0.806394219f,
+	0.806847572f, 0.807300448f, 0.807752848f, 0.80820471f, 0.808656156f, 0.809107125f, 0.809557617f, 0.810007632f,
+	0.81045717f, 0.810906231f, 0.811354876f, 0.811802983f, 0.812250614f, 0.812697768f, 0.813144386f, 0.813590586f,
+	0.81403631f, 0.814481556f, 0.814926326f, 0.815370619f, 0.815814435f, 0.816257715f, 0.816700578f, 0.817142904f,
+	0.817584813f, 0.818026185f, 0.81846714f, 0.818907559f, 0.819347501f, 0.819786966f, 0.820225954f, 0.820664465f,
+	0.8211025f, 0.821540058f, 0.821977139f, 0.822413683f, 0.82284981f, 0.823285401f, 0.823720515f, 0.824155152f,
+	0.824589312f, 0.825022995f, 0.825456142f, 0.825888872f, 0.826321065f, 0.826752782f, 0.827184021f, 0.827614784f,
+	0.82804507f, 0.82847482f, 0.828904092f, 0.829332948f, 0.829761207f, 0.830189049f, 0.830616415f, 0.831043243f,
+	0.831469595f, 0.831895471f, 0.832320869f, 0.83274579f, 0.833170176f, 0.833594084f, 0.834017515f, 0.83444041f,
+	0.834862888f, 0.835284829f, 0.835706294f, 0.836127281f, 0.836547732f, 0.836967707f, 0.837387204f, 0.837806225f,
+	0.838224709f, 0.838642716f, 0.839060247f, 0.839477241f, 0.839893818f, 0.840309858f, 0.840725362f, 0.841140449f,
+	0.841554999f, 0.841969013f, 0.84238261f, 0.84279567f, 0.843208253f, 0.8436203f, 0.84403187f, 0.844442964f,
+	0.84485358f, 0.84526366f, 0.845673263f, 0.84608233f, 0.84649092f, 0.846899033f, 0.847306609f, 0.847713768f,
+	0.848120332f, 0.848526478f, 0.848932028f, 0.849337161f, 0.849741757f, 0.850145876f, 0.850549459f, 0.850952566f,
+	0.851355195f, 0.851757288f, 0.852158904f, 0.852559984f, 0.852960587f, 0.853360713f, 0.853760302f, 0.854159415f,
+	0.854557991f, 0.85495609f, 0.855353653f, 0.85575074f, 0.856147349f, 0.856543422f, 0.856938958f, 0.857334018f,
+	0.857728601f, 0.858122647f, 0.858516216f, 0.858909249f, 0.859301805f, 0.859693885f, 0.860085368f, 0.860476434f,
+	0.860866964f, 0.861256957f, 0.861646473f, 0.862035453f, 0.862423956f, 0.862811923f, 0.863199413f, 0.863586366f,
+	0.863972843f, 0.864358783f, 0.864744246f, 0.865129173f, 0.865513623f, 0.865897536f, 0.866280973f, 0.866663873f,
+	0.867046237f, 0.867428124f, 0.867809474f, 0.868190348f, 0.868570685f, 0.868950546f, 0.86932987f, 0.869708657f,
+	0.870086968f, 0.870464802f, 0.87084204f, 0.87121886f, 0.871595085f, 0.871970832f, 0.872346044f, 0.872720778f,
+	0.873094976f, 0.873468697f, 0.873841822f, 0.87421453f, 0.874586642f, 0.874958277f, 0.875329375f, 0.875699997f,
+	0.876070082f, 0.876439691f, 0.876808703f, 0.877177238f, 0.877545297f, 0.877912819f, 0.878279805f, 0.878646255f,
+	0.879012227f, 0.879377663f, 0.879742622f, 0.880106986f, 0.880470872f, 0.880834281f, 0.881197095f, 0.881559432f,
+	0.881921291f, 0.882282555f, 0.882643342f, 0.883003592f, 0.883363366f, 0.883722544f, 0.884081244f, 0.884439468f,
+	0.884797096f, 0.885154247f, 0.885510862f, 0.88586694f, 0.886222541f, 0.886577606f, 0.886932135f, 0.887286127f,
+	0.887639642f, 0.887992561f, 0.888345063f, 0.888696969f, 0.889048338f, 0.88939923f, 0.889749587f, 0.890099406f,
+	0.890448749f, 0.890797496f, 0.891145766f, 0.891493499f, 0.891840696f, 0.892187417f, 0.892533541f, 0.892879188f,
+	0.893224299f, 0.893568873f, 0.893912971f, 0.894256473f, 0.894599497f, 0.894941986f, 0.895283937f, 0.895625353f,
+	0.895966232f, 0.896306634f, 0.8966465f, 0.896985769f, 0.897324562f, 0.897662818f, 0.898000598f, 0.898337781f,
+	0.898674488f, 0.899010599f, 0.899346232f, 0.89968133f, 0.900015891f, 0.900349915f, 0.900683403f, 0.901016414f,
+	0.901348829f, 0.901680768f, 0.902012169f, 0.902342975f, 0.902673304f, 0.903003097f, 0.903332353f, 0.903661072f,
+	0.903989315f, 0.904316962f, 0.904644072f, 0.904970706f, 0.905296743f, 0.905622303f, 0.905947268f, 0.906271756f,
+	0.906595707f, 0.906919122f, 0.907242f, 0.907564342f, 0.907886088f, 0.908207357f, 0.90852809f, 0.908848345f,
+	0.909168005f, 0.909487128f, 0.909805715f, 0.910123765f, 0.910441279f, 0.910758257f, 0.911074758f, 0.911390662f,
+	0.91170603f, 0.912020862f, 0.912335157f, 0.912648976f, 0.912962198f, 0.913274884f, 0.913587034f, 0.913898647f,
+	0.914209783f, 0.914520323f, 0.914830327f, 0.915139794f, 0.915448725f, 0.91575712f, 0.916064978f, 0.916372299f,
+	0.916679084f, 0.916985273f, 0.917290986f, 0.917596161f, 0.917900801f, 0.918204844f, 0.91850841f, 0.918811381f,
+	0.919113874f, 0.919415772f, 0.919717133f, 0.920017958f, 0.920318305f, 0.920618057f, 0.920917213f, 0.921215892f,
+	0.921514034f, 0.92181164f, 0.92210865f, 0.922405183f, 0.92270112f, 0.922996521f, 0.923291445f, 0.923585773f,
+	0.923879504f, 0.924172759f, 0.924465477f, 0.9247576f, 0.925049245f, 0.925340295f, 0.925630808f, 0.925920784f,
+	0.926210225f, 0.926499128f, 0.926787496f, 0.927075267f, 0.927362502f, 0.92764926f, 0.927935421f, 0.928220987f,
+	0.928506076f, 0.928790629f, 0.929074585f, 0.929358006f, 0.929640889f, 0.929923236f, 0.930205047f, 0.930486262f,
+	0.93076694f, 0.931047082f, 0.931326687f, 0.931605756f, 0.931884289f, 0.932162225f, 0.932439625f, 0.932716489f,
+	0.932992816f, 0.933268547f, 0.933543801f, 0.93381846f, 0.934092522f, 0.934366107f, 0.934639156f, 0.934911609f,
+	0.935183525f, 0.935454845f, 0.935725689f, 0.935995936f, 0.936265647f, 0.936534822f, 0.93680346f, 0.937071502f,
+	0.937339008f, 0.937605977f, 0.93787235f, 0.938138247f, 0.938403547f, 0.938668311f, 0.938932478f, 0.93919611f,
+	0.939459205f, 0.939721763f, 0.939983726f, 0.940245211f, 0.940506041f, 0.940766394f, 0.941026151f, 0.941285372f,
+	0.941544056f, 0.941802204f, 0.942059755f, 0.942316771f, 0.94257319f, 0.942829072f, 0.943084419f, 0.943339229f,
+	0.943593442f, 0.94384712f, 0.944100261f, 0.944352806f, 0.944604814f, 0.944856286f, 0.945107222f, 0.945357561f,
+	0.945607305f, 0.945856571f, 0.946105242f, 0.946353376f, 0.946600914f, 0.946847916f, 0.947094381f, 0.94734025f,
+	0.947585583f, 0.947830379f, 0.948074579f, 0.948318243f, 0.94856137f, 0.948803902f, 0.949045897f, 0.949287295f,
+	0.949528158f, 0.949768484f, 0.950008273f, 0.950247467f, 0.950486064f, 0.950724125f, 0.950961649f, 0.951198637f,
+	0.95143503f, 0.951670885f, 0.951906145f, 0.952140868f, 0.952374995f, 0.952608585f, 0.95284164f, 0.953074098f,
+	0.953306019f, 0.953537405f, 0.953768194f, 0.953998446f, 0.954228103f, 0.954457223f, 0.954685748f, 0.954913735f,
+	0.955141187f, 0.955368042f, 0.955594361f, 0.955820084f, 0.95604527f, 0.95626986f, 0.956493914f, 0.956717432f,
+	0.956940353f, 0.957162678f, 0.957384527f, 0.95760572f, 0.957826436f, 0.958046496f, 0.958266079f, 0.958485067f,
+	0.958703458f, 0.958921313f, 0.959138632f, 0.959355354f, 0.95957154f, 0.95978713f, 0.960002124f, 0.960216641f,
+	0.960430503f, 0.960643888f, 0.960856616f, 0.961068869f, 0.961280465f, 0.961491585f, 0.961702049f, 0.961912036f,
+	0.962121427f, 0.962330222f, 0.962538481f, 0.962746143f, 0.962953269f, 0.9631598f, 0.963365793f, 0.963571191f,
+	0.963776052f, 0.963980377f, 0.964184046f, 0.964387238f, 0.964589775f, 0.964791834f, 0.964993238f, 0.965194106f,
+	0.965394437f, 0.965594172f, 0.965793371f, 0.965991974f, 0.966189981f, 0.966387451f, 0.966584384f, 0.966780722f,
+	0.966976464f, 0.967171669f, 0.967366278f, 0.967560351f, 0.967753828f, 0.967946768f, 0.968139112f, 0.96833086f,
+	0.968522072f, 0.968712747f, 0.968902826f, 0.969092309f, 0.969281256f, 0.969469607f, 0.969657362f, 0.96984458f,
+	0.970031261f, 0.970217347f, 0.970402837f, 0.97058779f, 0.970772147f, 0.970955908f, 0.971139133f, 0.971321821f,
+	0.971503913f, 0.97168541f, 0.97186631f, 0.972046733f, 0.972226501f, 0.972405732f, 0.972584367f, 0.972762465f,
+	0.972939968f, 0.973116875f, 0.973293245f, 0.973469019f, 0.973644257f, 0.973818898f, 0.973992944f, 0.974166453f,
+	0.974339366f, 0.974511743f, 0.974683523f, 0.974854708f, 0.975025356f, 0.975195408f, 0.975364864f, 0.975533783f,
+	0.975702107f, 0.975869894f, 0.976037085f, 0.97620368f, 0.976369739f, 0.976535201f, 0.976700068f, 0.976864398f,
+	0.977028131f, 0.977191329f, 0.977353871f, 0.977515936f, 0.977677345f, 0.977838218f, 0.977998495f, 0.978158236f,
+	0.97831738f, 0.978475928f, 0.97863394f, 0.978791356f, 0.978948176f, 0.979104459f, 0.979260147f, 0.979415238f,
+	0.979569793f, 0.979723752f, 0.979877114f, 0.980029881f, 0.980182111f, 0.980333805f, 0.980484843f, 0.980635345f,
+	0.980785251f, 0.98093462f, 0.981083393f, 0.98123157f, 0.981379211f, 0.981526256f, 0.981672704f, 0.981818557f,
+	0.981963873f, 0.982108593f, 0.982252717f, 0.982396305f, 0.982539296f, 0.982681692f, 0.982823551f, 0.982964814f,
+	0.983105481f, 0.983245611f, 0.983385086f, 0.983524024f, 0.983662426f, 0.983800232f, 0.983937442f, 0.984074056f,
+	0.984210074f, 0.984345555f, 0.984480441f, 0.984614789f, 0.984748483f, 0.984881639f, 0.98501426f, 0.985146224f,
+	0.985277653f, 0.985408485f, 0.985538721f, 0.985668421f, 0.985797524f, 0.985926032f, 0.986053944f, 0.986181319f,
+	0.986308098f, 0.986434281f, 0.986559927f, 0.986684918f, 0.986809373f, 0.986933291f, 0.987056553f, 0.987179279f,
+	0.987301409f, 0.987422943f, 0.987543941f, 0.987664342f, 0.987784147f, 0.987903357f, 0.988022029f, 0.988140106f,
+	0.988257587f, 0.988374472f, 0.98849082f, 0.988606513f, 0.988721669f, 0.988836288f, 0.988950253f, 0.98906368f,
+	0.989176512f, 0.989288747f, 0.989400446f, 0.98951149f, 0.989621997f, 0.989731967f, 0.989841282f, 0.989950061f,
+	0.990058184f, 0.99016583f, 0.99027282f, 0.990379214f, 0.990485072f, 0.990590334f, 0.990695f, 0.990799129f,
+	0.990902662f, 0.99100554f, 0.991107941f, 0.991209686f, 0.991310835f, 0.991411448f, 0.991511464f, 0.991610885f,
+	0.991709769f, 0.991807997f, 0.991905689f, 0.992002785f, 0.992099285f, 0.992195249f, 0.992290616f, 0.992385328f,
+	0.992479563f, 0.992573142f, 0.992666125f, 0.992758572f, 0.992850423f, 0.992941678f, 0.993032336f, 0.993122458f,
+	0.993211925f, 0.993300855f, 0.993389189f, 0.993476987f, 0.993564129f, 0.993650734f, 0.993736744f, 0.993822157f,
+	0.993906975f, 0.993991196f, 0.994074881f, 0.99415797f, 0.994240463f, 0.99432236f, 0.99440366f, 0.994484425f,
+	0.994564593f, 0.994644165f, 0.994723141f, 0.994801521f, 0.994879305f, 0.994956553f, 0.995033205f, 0.99510926f,
+	0.99518472f, 0.995259583f, 0.99533391f, 0.995407641f, 0.995480776f, 0.995553315f, 0.995625257f, 0.995696604f,
+	0.995767415f, 0.995837629f, 0.995907247f, 0.995976269f, 0.996044695f, 0.996112585f, 0.996179819f, 0.996246517f,
+	0.996312618f, 0.996378124f, 0.996443033f, 0.996507406f, 0.996571124f, 0.996634305f, 0.996696889f, 0.996758878f,
+	0.996820271f, 0.996881127f, 0.996941328f, 0.997000992f, 0.997060061f, 0.997118533f, 0.997176409f, 0.997233748f,
+	0.997290432f, 0.99734658f, 0.997402132f, 0.997457087f, 0.997511446f, 0.99756521f, 0.997618437f, 0.997671068f,
+	0.997723043f, 0.997774482f, 0.997825325f, 0.997875631f, 0.997925282f, 0.997974396f, 0.998022854f, 0.998070776f,
+	0.998118103f, 0.998164833f, 0.998211026f, 0.998256564f, 0.998301566f, 0.998345912f, 0.998389721f, 0.998432934f,
+	0.998475552f, 0.998517632f, 0.998559058f, 0.998599946f, 0.998640239f, 0.998679936f, 0.998719037f, 0.998757541f,
+	0.99879545f, 0.998832822f, 0.998869538f, 0.998905718f, 0.998941302f, 0.99897629f, 0.999010682f, 0.999044478f,
+	0.999077737f, 0.999110341f, 0.999142408f, 0.99917388f, 0.999204755f, 0.999235034f, 0.999264777f, 0.999293864f,
+	0.999322355f, 0.999350309f, 0.999377668f, 0.99940443f, 0.999430597f, 0.999456167f, 0.999481201f, 0.999505579f,
+	0.999529421f, 0.999552667f, 0.999575317f, 0.999597371f, 0.999618828f, 0.99963969f, 0.999660015f, 0.999679685f,
+	0.999698818f, 0.999717355f, 0.999735296f, 0.999752641f, 0.99976939f, 0.999785602f, 0.999801159f, 0.999816179f,
+	0.999830604f, 0.999844432f, 0.999857664f, 0.9998703f, 0.99988234f, 0.999893844f, 0.999904692f, 0.999915004f,
+	0.999924719f, 0.999933839f, 0.999942362f, 0.99995029f, 0.999957621f, 0.999964416f, 0.999970615f, 0.999976158f,
+	0.999981165f, 0.999985576f, 0.99998939f, 0.999992669f, 0.999995291f, 0.999997377f, 0.999998808f, 0.999999702f,
+	1.0f,
+#elif FMATH_TABLE_BITS == 14
+	0.0f, 0.000383495179f, 0.000766990299f, 0.00115048536f, 0.00153398013f, 0.00191747479f, 0.00230096909f, 0.00268446305f,
+	0.00306795677f, 0.00345145003f, 0.00383494259f, 0.00421843445f, 0.00460192608f, 0.00498541677f, 0.005368907f, 0.0057523963f,
+	0.00613588467f, 0.00651937211f, 0.00690285861f, 0.00728634419f, 0.00766982883f, 0.00805331208f, 0.00843679439f, 0.00882027484f,
+	0.00920375437f, 0.00958723295f, 0.00997070968f, 0.0103541855f, 0.0107376594f, 0.0111211315f, 0.0115046017f, 0.011888071f,
+	0.0122715384f, 0.0126550039f, 0.0130384676f, 0.0134219285f, 0.0138053885f, 0.0141888466f, 0.0145723019f, 0.0149557553f,
+	0.015339206f, 0.0157226548f, 0.0161061026f, 0.0164895467f, 0.0168729872f, 0.0172564276f, 0.0176398642f, 0.0180232991f,
+	0.0184067301f, 0.0187901594f, 0.0191735849f, 0.0195570085f, 0.0199404284f, 0.0203238465f, 0.0207072608f, 0.0210906714f,
+	0.0214740802f, 0.0218574852f, 0.0222408883f, 0.0226242859f, 0.0230076816f, 0.0233910736f, 0.0237744618f, 0.0241578463f,
+	0.024541229f, 0.0249246061f, 0.0253079813f, 0.0256913509f, 0.0260747187f, 0.0264580809f, 0.0268414393f, 0.027224794f,
+	0.027608145f, 0.0279914923f, 0.0283748358f, 0.0287581738f, 0.029141508f, 0.0295248386f, 0.0299081653f, 0.0302914865f,
+	0.030674804f, 0.0310581159f, 0.031441424f, 0.0318247266f, 0.0322080255f, 0.0325913206f, 0.0329746082f, 0.0333578922f,
+	0.0337411724f, 0.0341244452f, 0.0345077142f, 0.0348909795f, 0.0352742374f, 0.0356574915f, 0.036040742f, 0.0364239849f,
+	0.0368072242f, 0.0371904559f, 0.037573684f, 0.0379569046f, 0.0383401215f, 0.0387233309f, 0.0391065367f, 0.0394897349f,
+	0.0398729257f, 0.0402561165f, 0.0406392962f, 0.0410224721f, 0.0414056405f, 0.0417888053f, 0.0421719626f, 0.0425551124f,
+	0.0429382585f, 0.0433213934f, 0.0437045284f, 0.0440876521f, 0.0444707721f, 0.0448538847f, 0.0452369899f, 0.0456200913f,
+	0.0460031815f, 0.046386268f, 0.046769347f, 0.0471524186f, 0.0475354828f, 0.0479185432f, 0.0483015925f, 0.048684638f,
+	0.0490676761f, 0.049450703f, 0.0498337261f, 0.0502167419f, 0.0505997501f, 0.050982751f, 0.0513657406f, 0.0517487265f,
+	0.052131705f, 0.052514676f, 0.0528976358f, 0.053280592f, 0.0536635369f, 0.0540464781f, 0.0544294082f, 0.0548123308f,
+	0.0551952459f, 0.0555781499f, 0.0559610501f, 0.0563439392f, 0.0567268208f, 0.0571096949f, 0.0574925579f, 0.0578754172f,
+	0.0582582653f, 0.0586411059f, 0.0590239353f, 0.0594067574f, 0.0597895719f, 0.0601723753f, 0.0605551712f, 0.0609379597f,
+	0.061320737f, 0.0617035069f, 0.0620862655f, 0.0624690168f, 0.0628517568f, 0.0632344931f, 0.0636172146f, 0.0639999285f,
+	0.0643826276f, 0.0647653267f, 0.0651480108f, 0.0655306876f, 0.0659133494f, 0.0662960112f, 0.0666786581f, 0.0670612901f,
+	0.0674439222f, 0.0678265393f, 0.0682091415f, 0.0685917437f, 0.068974331f, 0.0693569034f, 0.0697394684f, 0.0701220259f,
+	0.070504576f, 0.0708871111f, 0.0712696314f, 0.0716521516f, 0.0720346496f, 0.0724171475f, 0.0727996305f, 0.0731820986f,
+	0.0735645667f, 0.0739470124f, 0.0743294507f, 0.0747118816f, 0.0750942975f, 0.075476706f, 0.0758591071f, 0.0762414858f,
+	0.0766238645f, 0.0770062208f, 0.0773885772f, 0.0777709112f, 0.0781532452f, 0.0785355568f, 0.078917861f, 0.0793001577f,
+	0.0796824396f, 0.0800647065f, 0.080446966f, 0.0808292106f, 0.0812114477f, 0.08159367f, 0.0819758773f, 0.0823580772f,
+	0.0827402622f, 0.0831224397f, 0.0835046023f, 0.08388675f, 0.0842688903f, 0.0846510157f, 0.0850331262f, 0.0854152218f,
+	0.0857973099f, 0.0861793905f, 0.0865614489f, 0.0869434997f, 0.0873255357f, 0.0877075568f, 0.0880895704f, 0.0884715691f,
+	0.0888535529f, 0.0892355219f, 0.0896174833f, 0.0899994299f, 0.0903813615f, 0.0907632783f, 0.0911451876f, 0.0915270746f,
+	0.0919089541f, 0.0922908187f, 0.0926726758f, 0.0930545107f, 0.093436338f, 0.093818143f, 0.0941999406f, 0.0945817232f,
+	0.0949634984f, 0.0953452513f, 0.0957269892f, 0.0961087197f, 0.0964904279f, 0.0968721285f, 0.0972538143f, 0.0976354852f,
+	0.0980171412f, 0.0983987823f, 0.0987804085f, 0.0991620198f, 0.0995436162f, 0.0999252051f, 0.100306772f, 0.100688323f,
+	0.10106986f, 0.101451389f, 0.101832896f, 0.102214389f, 0.102595866f, 0.102977335f, 0.103358783f, 0.103740215f,
+	0.104121633f, 0.104503036f, 0.104884423f, 0.105265796f, 0.105647154f, 0.106028497f, 0.106409818f, 0.106791131f,
+	0.107172422f, 0.107553706f, 0.107934967f, 0.108316213f, 0.108697444f, 0.109078661f, 0.109459855f, 0.109841041f,
+	0.110222206f, 0.110603355f, 0.110984489f, 0.111365609f, 0.111746714f, 0.112127796f, 0.112508863f, 0.112889916f,
+	0.113270953f, 0.113651969f, 0.114032976f, 0.114413962f, 0.114794925f, 0.11517588f, 0.115556814f, 0.115937732f,
+	0.116318628f, 0.116699517f, 0.117080383f, 0.117461227f, 0.117842063f, 0.118222877f, 0.118603677f, 0.118984453f,
+	0.119365215f, 0.119745962f, 0.120126687f, 0.120507397f, 0.120888084f, 0.121268764f, 0.121649414f, 0.122030057f,
+	0.122410677f, 0.122791275f, 0.123171858f, 0.123552427f, 0.123932973f, 0.124313504f, 0.12469402f, 0.125074506f,
+	0.125454977f, 0.125835434f, 0.126215875f, 0.126596302f, 0.126976699f, 0.127357081f, 0.127737448f, 0.128117785f,
+	0.128498107f, 0.128878415f, 0.129258707f, 0.12963897f, 0.130019218f, 0.130399451f, 0.130779669f, 0.131159857f,
+	0.13154003f, 0.131920189f, 0.132300317f, 0.132680431f, 0.13306053f, 0.133440599f, 0.133820653f, 0.134200692f,
+	0.134580702f, 0.134960711f, 0.135340676f, 0.13572064f, 0.136100575f, 0.136480495f, 0.136860386f, 0.137240261f,
+	0.137620121f, 0.137999952f, 0.138379768f, 0.138759568f, 0.139139339f, 0.139519095f, 0.139898837f, 0.140278548f,
+	0.140658244f, 0.141037911f, 0.141417563f, 0.1417972f, 0.142176807f, 0.142556399f, 0.142935961f, 0.143315509f,
+	0.143695027f, 0.144074544f, 0.144454017f, 0.14483349f, 0.145212919f, 0.145592347f, 0.145971745f, 0.146351114f,
+	0.146730468f, 0.147109807f, 0.147489116f, 0.14786841f, 0.148247674f, 0.148626924f, 0.149006143f, 0.149385348f,
+	0.149764538f, 0.150143698f, 0.150522828f, 0.150901943f, 0.151281044f, 0.151660115f, 0.152039155f, 0.152418181f,
+	0.152797192f, 0.153176159f, 0.153555125f, 0.153934062f, 0.154312968f, 0.15469186f, 0.155070737f, 0.155449569f,
+	0.155828401f, 0.156207204f, 0.156585976f, 0.156964719f, 0.157343462f, 0.15772216f, 0.158100843f, 0.158479512f,
+	0.15885815f, 0.159236759f, 0.159615353f, 0.159993917f, 0.160372451f, 0.16075097f, 0.161129475f, 0.161507949f,
+	0.161886394f, 0.162264824f, 0.162643224f, 0.163021594f, 0.16339995f, 0.163778275f, 0.164156586f, 0.164534867f,
+	0.164913118f, 0.165291354f, 0.16566956f, 0.166047737f, 0.166425899f, 0.166804045f, 0.167182148f, 0.167560235f,
+	0.167938292f, 0.168316334f, 0.168694347f, 0.16907233f, 0.169450298f, 0.169828221f, 0.170206144f, 0.170584023f,
+	0.170961887f, 0.17133972f, 0.171717539f, 0.172095329f, 0.172473088f, 0.172850817f, 0.173228532f, 0.173606217f,
+	0.173983872f, 0.174361512f, 0.174739107f, 0.175116703f, 0.175494254f, 0.175871789f, 0.176249295f, 0.176626772f,
+	0.177004218f, 0.17738165f, 0.177759051f, 0.178136423f, 0.178513765f, 0.178891093f, 0.17926839f, 0.179645658f,
+	0.180022895f, 0.180400118f, 0.180777311f, 0.181154475f, 0.181531608f, 0.181908712f, 0.182285801f, 0.18266286f,
+	0.183039889f, 0.183416888f, 0.183793873f, 0.184170812f, 0.184547737f, 0.184924632f, 0.185301498f, 0.185678333f,
+	0.186055154f, 0.186431944f, 0.18680869f, 0.187185422f, 0.187562123f, 0.187938809f, 0.188315451f, 0.188692078f,
+	0.18906866f, 0.189445227f, 0.189821765f, 0.190198272f, 0.19057475f, 0.190951213f, 0.191327631f, 0.191704035f,
+	0.192080393f, 0.192456737f, 0.192833051f, 0.193209335f, 0.19358559f, 0.193961814f, 0.194338009f, 0.194714189f,
+	0.195090324f, 0.195466429f, 0.195842519f, 0.196218565f, 0.196594596f, 0.196970597f, 0.197346568f, 0.197722495f,
+	0.198098406f, 0.198474288f, 0.19885014f, 0.199225962f, 0.199601755f, 0.199977517f, 0.20035325f, 0.200728953f,
+	0.201104641f, 0.201480284f, 0.201855898f, 0.202231482f, 0.202607036f, 0.20298256f, 0.203358069f, 0.203733534f,
+	0.204108968f, 0.204484373f, 0.204859748f, 0.205235094f, 0.205610409f, 0.205985695f, 0.206360951f, 0.206736177f,
+	0.207111374f, 0.20748654f, 0.207861677f, 0.208236784f, 0.208611846f, 0.208986893f, 0.209361911f, 0.209736884f,
+	0.210111842f, 0.210486755f, 0.210861638f, 0.211236507f, 0.211611331f, 0.211986125f, 0.212360889f, 0.212735623f,
+	0.213110313f, 0.213484988f, 0.213859633f, 0.214234233f, 0.214608818f, 0.214983359f, 0.21535787f, 0.215732351f,
+	0.216106802f, 0.216481209f, 0.2168556f, 0.217229947f, 0.21760428f, 0.217978567f, 0.218352824f, 0.218727052f,
+	0.219101235f, 0.219475403f, 0.219849527f, 0.220223621f, 0.220597684f, 0.220971718f, 0.221345723f, 0.221719682f,
+	0.222093627f, 0.222467527f, 0.222841397f, 0.223215222f, 0.223589033f, 0.223962799f, 0.224336535f, 0.224710241f,
+	0.225083917f, 0.225457549f, 0.225831151f, 0.226204723f, 0.226578265f, 0.226951763f, 0.227325246f, 0.227698684f,
+	0.228072077f, 0.228445455f, 0.228818789f, 0.229192093f, 0.229565367f, 0.229938596f, 0.230311811f, 0.230684981f,
+	0.231058106f, 0.231431216f, 0.231804281f, 0.232177302f, 0.232550308f, 0.232923269f, 0.233296201f, 0.233669102f,
+	0.234041959f, 0.234414786f, 0.234787583f, 0.235160336f, 0.235533059f, 0.235905752f, 0.2362784f, 0.236651018f,
+	0.237023607f, 0.237396151f, 0.237768665f, 0.238141149f, 0.238513589f, 0.238885999f, 0.239258379f, 0.239630714f,
+	0.24000302f, 0.240375295f, 0.240747526f, 0.241119727f, 0.241491884f, 0.241864011f, 0.242236108f, 0.24260816f,
+	0.242980182f, 0.24335216f, 0.243724108f, 0.244096026f, 0.244467899f, 0.244839743f, 0.245211542f, 0.245583311f,
+	0.24595505f, 0.246326745f, 0.246698409f, 0.247070029f, 0.24744162f, 0.247813165f, 0.248184681f, 0.248556167f,
+	0.248927608f, 0.249299005f, 0.249670386f, 0.250041723f, 0.250413001f, 0.250784278f, 0.251155496f, 0.251526684f,
+	0.251897812f, 0.25226894f, 0.252640009f, 0.253011048f, 0.253382027f, 0.253753006f, 0.254123926f, 0.254494816f,
+	0.254865646f, 0.255236477f, 0.255607247f, 0.255977988f, 0.25634867f, 0.256719351f, 0.257089972f, 0.257460564f,
+	0.257831097f, 0.258201599f, 0.258572072f, 0.258942515f, 0.259312928f, 0.259683281f, 0.260053605f, 0.260423869f,
+	0.260794103f, 0.261164337f, 0.261534482f, 0.261904627f, 0.262274712f, 0.262644768f, 0.263014764f, 0.26338473f,
+	0.263754666f, 0.264124572f, 0.264494419f, 0.264864236f, 0.265234023f, 0.265603781f, 0.265973479f, 0.266343147f,
+	0.266712755f, 0.267082334f, 0.267451882f, 0.267821401f, 0.268190861f, 0.26856029f, 0.26892966f, 0.26929903f,
+	0.269668311f, 0.270037591f, 0.270406812f, 0.270776004f, 0.271145165f, 0.271514267f, 0.271883339f, 0.272252381f,
+	0.272621363f, 0.272990316f, 0.273359209f, 0.273728073f, 0.274096906f, 0.27446571f, 0.274834454f, 0.275203139f,
+	0.275571823f, 0.275940448f, 0.276309043f, 0.276677579f, 0.277046084f, 0.277414531f, 0.277782977f, 0.278151363f,
+	0.27851969f, 0.278887987f, 0.279256254f, 0.279624462f, 0.27999264f, 0.280360788f, 0.280728877f, 0.281096935f,
+	0.281464934f, 0.281832904f, 0.282200843f, 0.282568723f, 0.282936573f, 0.283304363f, 0.283672124f, 0.284039855f,
+	0.284407526f, 0.284775168f, 0.285142779f, 0.285510331f, 0.285877824f, 0.286245316f, 0.286612719f, 0.286980122f,
+	0.287347466f, 0.28771475f, 0.288082033f, 0.288449228f, 0.288816422f, 0.289183527f, 0.289550632f, 0.289917678f,
+	0.290284663f, 0.290651649f, 0.291018546f, 0.291385442f, 0.291752249f, 0.292119056f, 0.292485803f, 0.292852491f,
+	0.293219149f, 0.293585777f, 0.293952346f, 0.294318885f, 0.294685364f, 0.295051813f, 0.295418203f, 0.295784563f,
+	0.296150893f, 0.296517164f, 0.296883374f, 0.297249556f, 0.297615707f, 0.297981799f, 0.298347861f, 0.298713863f,
+	0.299079835f, 0.299445748f, 0.299811631f, 0.300177455f, 0.300543249f, 0.300908983f, 0.301274687f, 0.301640332f,
+	0.302005947f, 0.302371502f, 0.302737027f, 0.303102523f, 0.303467959f, 0.303833336f, 0.304198682f, 0.304563969f,
+	0.304929227f, 0.305294424f, 0.305659592f, 0.30602473f, 0.306389809f, 0.306754827f, 0.307119817f, 0.307484746f,
+	0.307849646f, 0.308214486f, 0.308579296f, 0.308944046f, 0.309308767f, 0.309673429f, 0.31003806f, 0.310402632f,
+	0.310767144f, 0.311131626f, 0.311496079f, 0.311860472f, 0.312224805f, 0.312589109f, 0.312953383f, 0.313317567f,
+	0.313681751f, 0.314045846f, 0.314409941f, 0.314773947f, 0.315137923f, 0.315501869f, 0.315865755f, 0.316229582f,
+	0.316593379f, 0.316957116f, 0.317320824f, 0.317684472f, 0.31804809f, 0.318411648f, 0.318775147f, 0.319138616f,
+	0.319502026f, 0.319865406f, 0.320228726f, 0.320592016f, 0.320955247f, 0.321318418f, 0.321681559f, 0.322044641f,
+	0.322407693f, 0.322770685f, 0.323133618f, 0.323496521f, 0.323859364f, 0.324222177f, 0.324584931f, 0.324947625f,
+	0.32531029f, 0.325672895f, 0.32603547f, 0.326397985f, 0.326760441f, 0.327122867f, 0.327485234f, 0.32784757f,
+	0.328209847f, 0.328572065f, 0.328934252f, 0.32929638f, 0.329658449f, 0.330020487f, 0.330382496f, 0.330744416f,
+	0.331106305f, 0.331468135f, 0.331829935f, 0.332191676f, 0.332553357f, 0.332915008f, 0.3332766f, 0.333638161f,
+	0.333999664f, 0.334361106f, 0.334722489f, 0.335083842f, 0.335445136f, 0.3358064f, 0.336167604f, 0.336528748f,
+	0.336889863f, 0.337250918f, 0.337611914f, 0.33797285f, 0.338333756f, 0.338694632f, 0.339055419f, 0.339416176f,
+	0.339776874f, 0.340137541f, 0.340498149f, 0.340858698f, 0.341219217f, 0.341579646f, 0.341940075f, 0.342300415f,
+	0.342660725f, 0.343020976f, 0.343381166f, 0.343741328f, 0.344101429f, 0.344461471f, 0.344821483f, 0.345181435f,
+	0.345541328f, 0.345901161f, 0.346260965f, 0.346620709f, 0.346980423f, 0.347340047f, 0.347699642f, 0.348059177f,
+	0.348418683f, 0.348778129f, 0.349137515f, 0.349496841f, 0.349856138f, 0.350215375f, 0.350574553f, 0.350933671f,
+	0.351292759f, 0.351651788f, 0.352010757f, 0.352369696f, 0.352728546f, 0.353087366f, 0.353446156f, 0.353804857f,
+	0.354163527f, 0.354522139f, 0.354880691f, 0.355239213f, 0.355597675f, 0.355956078f, 0.356314421f, 0.356672704f,
+	0.357030958f, 0.357389152f, 0.357747287f, 0.358105391f, 0.358463407f, 0.358821392f, 0.359179348f, 0.359537214f,
+	0.359895051f, 0.360252798f, 0.360610515f, 0.360968202f, 0.3613258f, 0.361683369f, 0.362040877f, 0.362398326f,
+	0.362755716f, 0.363113075f, 0.363470376f, 0.363827616f, 0.364184797f, 0.364541918f, 0.364899009f, 0.365256011f,
+	0.365612984f, 0.365969926f, 0.366326779f, 0.366683602f, 0.367040336f, 0.36739704f, 0.367753685f, 0.368110299f,
+	0.368466824f, 0.36882332f, 0.369179755f, 0.369536132f, 0.369892448f, 0.370248705f, 0.370604932f, 0.3709611f,
+	0.371317208f, 0.371673256f, 0.372029245f, 0.372385174f, 0.372741073f, 0.373096913f, 0.373452663f, 0.373808384f,
+	0.374164075f, 0.374519676f, 0.374875218f, 0.37523073f, 0.375586182f, 0.375941575f, 0.376296908f, 0.376652181f,
+	0.377007425f, 0.377362579f, 0.377717704f, 0.378072739f, 0.378427744f, 0.37878269f, 0.379137605f, 0.379492432f,
+	0.379847199f, 0.380201936f, 0.380556613f, 0.380911201f, 0.381265759f, 0.381620258f, 0.381974727f, 0.382329106f,
+	0.382683426f, 0.383037716f, 0.383391917f, 0.383746088f, 0.384100199f, 0.38445425f, 0.384808242f, 0.385162175f,
+	0.385516047f, 0.38586989f, 0.386223644f, 0.386577338f, 0.386931002f, 0.387284607f, 0.387638152f, 0.387991607f,
+	0.388345033f, 0.388698429f, 0.389051735f, 0.389404982f, 0.38975817f, 0.390111327f, 0.390464395f, 0.390817404f,
+	0.391170382f, 0.391523302f, 0.391876131f, 0.392228931f, 0.392581671f, 0.392934352f, 0.393286973f, 0.393639535f,
+	0.393992037f, 0.394344479f, 0.394696862f, 0.395049214f, 0.395401478f, 0.395753682f, 0.396105856f, 0.39645794f,
+	0.396809995f, 0.397161961f, 0.397513896f, 0.397865742f, 0.398217559f, 0.398569316f, 0.398921013f, 0.399272621f,
+	0.399624199f, 0.399975717f, 0.400327176f, 0.400678575f, 0.401029885f, 0.401381165f, 0.401732385f, 0.402083546f,
+	0.402434647f, 0.402785689f, 0.403136671f, 0.403487593f, 0.403838456f, 0.404189259f, 0.404540002f, 0.404890686f,
+	0.405241311f, 0.405591875f, 0.40594238f, 0.406292826f, 0.406643212f, 0.406993538f, 0.407343805f, 0.407694012f,
+	0.408044159f, 0.408394247f, 0.408744276f, 0.409094244f, 0.409444153f, 0.409794003f, 0.410143793f, 0.410493493f,
+	0.410843164f, 0.411192775f, 0.411542326f, 0.411891818f, 0.41224122f, 0.412590593f, 0.412939876f, 0.41328913f,
+	0.413638324f, 0.413987428f, 0.414336503f, 0.414685488f, 0.415034413f, 0.415383309f, 0.415732116f, 0.416080862f,
+	0.416429549f, 0.416778177f, 0.417126775f, 0.417475283f, 0.417823702f, 0.418172091f, 0.418520421f, 0.418868691f,
+	0.419216901f, 0.419565022f, 0.419913113f, 0.420261115f, 0.420609087f, 0.420956969f, 0.421304792f, 0.421652555f,
+	0.422000259f, 0.422347903f, 0.422695488f, 0.423043013f, 0.423390478f, 0.423737884f, 0.4240852f, 0.424432486f,
+	0.424779683f, 0.425126821f, 0.425473899f, 0.425820917f, 0.426167876f, 0.426514775f, 0.426861614f, 0.427208394f,
+	0.427555084f, 0.427901745f, 0.428248316f, 0.428594828f, 0.42894128f, 0.429287672f, 0.429634005f, 0.429980278f,
+	0.430326492f, 0.430672616f, 0.43101871f, 0.431364715f, 0.43171066f, 0.432056546f, 0.432402372f, 0.432748139f,
+	0.433093816f, 0.433439463f, 0.433785021f, 0.43413052f, 0.434475958f, 0.434821337f, 0.435166657f, 0.435511887f,
+	0.435857087f, 0.436202198f, 0.43654725f, 0.436892241f, 0.437237173f, 0.437582046f, 0.437926829f, 0.438271582f,
+	0.438616246f, 0.43896085f, 0.439305395f, 0.43964985f, 0.439994276f, 0.440338612f, 0.440682888f, 0.441027105f,
+	0.441371262f, 0.44171536f, 0.442059368f, 0.442403346f, 0.442747235f, 0.443091065f, 0.443434805f, 0.443778515f,
+	0.444122136f, 0.444465697f, 0.444809198f, 0.44515264f, 0.445496023f, 0.445839316f, 0.446182549f, 0.446525723f,
+	0.446868837f, 0.447211891f, 0.447554857f, 0.447897762f, 0.448240608f, 0.448583394f, 0.448926091f, 0.449268758f,
+	0.449611336f, 0.449953854f, 0.450296283f, 0.450638682f, 0.450980991f, 0.451323241f, 0.451665431f, 0.452007532f,
+	0.452349573f, 0.452691585f, 0.453033477f, 0.45337534f, 0.453717113f, 0.454058826f, 0.45440048f, 0.454742074f,
+	0.455083579f, 0.455425024f, 0.45576641f, 0.456107736f, 0.456448972f, 0.456790149f, 0.457131267f, 0.457472324f,
+	0.457813293f, 0.458154202f, 0.458495051f, 0.45883584f, 0.45917654f, 0.459517181f, 0.459857762f, 0.460198283f,
+	0.460538715f, 0.460879087f, 0.4612194f, 0.461559623f, 0.461899787f, 0.462239891f, 0.462579936f, 0.462919891f,
+	0.463259786f, 0.463599622f, 0.463939369f, 0.464279056f, 0.464618683f, 0.464958251f, 0.465297729f, 0.465637147f,
+	0.465976506f, 0.466315776f, 0.466654986f, 0.466994137f, 0.467333198f, 0.467672229f, 0.468011141f, 0.468350023f,
+	0.468688816f, 0.469027549f, 0.469366223f, 0.469704807f, 0.470043331f, 0.470381796f, 0.470720172f, 0.471058488f,
+	0.471396744f, 0.471734911f, 0.472073019f, 0.472411066f, 0.472749025f, 0.473086923f, 0.473424762f, 0.473762512f,
+	0.474100202f, 0.474437833f, 0.474775374f, 0.475112855f, 0.475450277f, 0.47578761f, 0.476124883f, 0.476462096f,
+	0.47679922f, 0.477136284f, 0.477473289f, 0.477810204f, 0.47814706f, 0.478483826f, 0.478820562f, 0.47915718f,
+	0.479493767f, 0.479830265f, 0.480166674f, 0.480503052f, 0.480839342f, 0.481175542f, 0.481511682f, 0.481847763f,
+	0.482183784f, 0.482519716f, 0.482855558f, 0.483191371f, 0.483527064f, 0.483862728f, 0.484198302f, 0.484533817f,
+	0.484869242f, 0.485204607f, 0.485539913f, 0.48587513f, 0.486210287f, 0.486545354f, 0.486880362f, 0.48721531f,
+	0.487550169f, 0.487884939f, 0.488219678f, 0.488554329f, 0.48888889f, 0.489223391f, 0.489557832f, 0.489892185f,
+	0.490226477f, 0.49056071f, 0.490894854f, 0.491228908f, 0.491562903f, 0.491896838f, 0.492230713f, 0.49256447f,
+	0.492898196f, 0.493231833f, 0.49356541f, 0.493898898f, 0.494232297f, 0.494565666f, 0.494898945f, 0.495232135f,
+	0.495565265f, 0.495898306f, 0.496231288f, 0.496564209f, 0.496897042f, 0.497229815f, 0.497562498f, 0.497895122f,
+	0.498227656f, 0.498560131f, 0.498892546f, 0.499224871f, 0.499557108f, 0.499889284f, 0.500221372f, 0.500553429f,
+	0.500885367f, 0.501217246f, 0.501549065f, 0.501880825f, 0.502212465f, 0.502544045f, 0.502875566f, 0.503207028f,
+	0.50353837f, 0.503869653f, 0.504200876f, 0.504532039f, 0.504863083f, 0.505194128f, 0.505525053f, 0.505855858f,
+	0.506186664f, 0.506517351f, 0.506847978f, 0.507178545f, 0.507508993f, 0.507839382f, 0.508169711f, 0.50849998f,
+	0.50883013f, 0.509160221f, 0.509490252f, 0.509820223f, 0.510150075f, 0.510479927f, 0.5108096f, 0.511139274f,
+	0.511468828f, 0.511798322f, 0.512127757f, 0.512457132f, 0.512786388f, 0.513115585f, 0.513444722f, 0.513773799f,
+	0.514102757f, 0.514431655f, 0.514760435f, 0.515089214f, 0.515417874f, 0.515746474f, 0.516075015f, 0.516403437f,
+	0.516731799f, 0.517060101f, 0.517388284f, 0.517716467f, 0.518044531f, 0.518372476f, 0.518700421f, 0.519028246f,
+	0.519356012f, 0.519683659f, 0.520011246f, 0.520338774f, 0.520666242f, 0.52099365f, 0.521320939f, 0.521648169f,
+	0.521975279f, 0.522302389f, 0.52262938f, 0.522956252f, 0.523283124f, 0.523609877f, 0.52393657f, 0.524263144f,
+	0.524589658f, 0.524916112f, 0.525242507f, 0.525568783f, 0.525895f, 0.526221156f, 0.526547253f, 0.526873231f,
+	0.527199149f, 0.527524948f, 0.527850747f, 0.528176427f, 0.528501987f, 0.528827548f, 0.529152989f, 0.529478312f,
+	0.529803634f, 0.530128837f, 0.53045398f, 0.530779004f, 0.531104028f, 0.531428874f, 0.531753719f, 0.532078445f,
+	0.532403111f, 0.532727718f, 0.533052206f, 0.533376634f, 0.533701003f, 0.534025252f, 0.534349442f, 0.534673572f,
+	0.534997642f, 0.535321593f, 0.535645485f, 0.535969257f, 0.53629297f, 0.536616623f, 0.536940157f, 0.537263691f,
+	0.537587047f, 0.537910402f, 0.538233638f, 0.538556814f, 0.538879931f, 0.539202929f, 0.539525867f, 0.539848685f,
+	0.540171444f, 0.540494144f, 0.540816784f, 0.541139305f, 0.541461766f, 0.541784167f, 0.54210645f, 0.542428672f,
+	0.542750776f, 0.54307282f, 0.543394804f, 0.543716729f, 0.544038534f, 0.54436028f, 0.544681907f, 0.545003474f,
+	0.545324981f, 0.545646429f, 0.545967758f, 0.546288967f, 0.546610177f, 0.546931267f, 0.547252297f, 0.547573209f,
+	0.547894061f, 0.548214853f, 0.548535526f, 0.548856139f, 0.549176633f, 0.549497128f, 0.549817502f, 0.550137758f,
+	0.550457954f, 0.550778091f, 0.551098168f, 0.551418126f, 0.551737964f, 0.552057803f, 0.552377522f, 0.552697122f,
+	0.553016722f, 0.553336203f, 0.553655565f, 0.553974867f, 0.554294109f, 0.554613292f, 0.554932356f, 0.5552513f,
+	0.555570245f, 0.55588907f, 0.556207776f, 0.556526482f, 0.556845009f, 0.557163537f, 0.557481945f, 0.557800293f,
+	0.558118522f, 0.558436692f, 0.558754802f, 0.559072793f, 0.559390724f, 0.559708536f, 0.560026288f, 0.560343981f,
+	0.560661554f, 0.560979068f, 0.561296523f, 0.561613858f, 0.561931133f, 0.56224829f, 0.562565386f, 0.562882423f,
+	0.563199341f, 0.5635162f, 0.563832939f, 0.564149618f, 0.564466238f, 0.564782739f, 0.56509918f, 0.565415561f,
+	0.565731823f, 0.566047966f, 0.56636411f, 0.566680133f, 0.566996038f, 0.567311883f, 0.567627668f, 0.567943335f,
+	0.568258941f, 0.568574488f, 0.568889916f, 0.569205225f, 0.569520533f, 0.569835722f, 0.570150793f, 0.570465803f,
+	0.570780754f, 0.571095586f, 0.571410358f, 0.571725011f, 0.572039604f, 0.572354138f, 0.572668552f, 0.572982907f,
+	0.573297143f, 0.573611319f, 0.573925436f, 0.574239433f, 0.57455337f, 0.574867189f, 0.575180948f, 0.575494587f,
+	0.575808167f, 0.576121688f, 0.576435089f, 0.576748431f, 0.577061653f, 0.577374816f, 0.577687919f, 0.578000903f,
+	0.578313768f, 0.578626633f, 0.578939319f, 0.579252005f, 0.579564571f, 0.579877019f, 0.580189407f, 0.580501735f,
+	0.580813944f, 0.581126094f, 0.581438124f, 0.581750095f, 0.582062006f, 0.582373798f, 0.582685471f, 0.582997143f,
+	0.583308637f, 0.583620131f, 0.583931446f, 0.584242761f, 0.584553957f, 0.584865034f, 0.585176051f, 0.585487008f,
+	0.585797846f, 0.586108625f, 0.586419284f, 0.586729884f, 0.587040365f, 0.587350786f, 0.587661147f, 0.587971389f,
+	0.588281572f, 0.588591635f, 0.588901579f, 0.589211524f, 0.589521289f, 0.589831054f, 0.5901407f, 0.590450227f,
+	0.590759695f, 0.591069102f, 0.591378391f, 0.59168756f, 0.59199667f, 0.59230572f, 0.592614651f, 0.592923522f,
+	0.593232274f, 0.593540967f, 0.593849599f, 0.594158053f, 0.594466507f, 0.594774842f, 0.595083058f, 0.595391214f,
+	0.59569931f, 0.596007288f, 0.596315205f, 0.596623003f, 0.596930683f, 0.597238362f, 0.597545862f, 0.597853363f,
+	0.598160684f, 0.598468006f, 0.598775208f, 0.599082291f, 0.599389315f, 0.599696219f, 0.600003064f, 0.600309789f,
+	0.600616455f, 0.600923061f, 0.601229548f, 0.601535916f, 0.601842225f, 0.602148473f, 0.602454603f, 0.602760673f,
+	0.603066623f, 0.603372455f, 0.603678226f, 0.603983939f, 0.604289532f, 0.604595065f, 0.604900479f, 0.605205774f,
+	0.605511069f, 0.605816185f, 0.606121242f, 0.606426239f, 0.606731117f, 0.607035935f, 0.607340634f, 0.607645273f,
+	0.607949793f, 0.608254254f, 0.608558595f, 0.608862817f, 0.609167039f, 0.609471083f, 0.609775066f, 0.61007899f,
+	0.610382795f, 0.610686541f, 0.610990167f, 0.611293733f, 0.61159718f, 0.611900508f, 0.612203777f, 0.612506986f,
+	0.612810075f, 0.613113105f, 0.613416016f, 0.613718808f, 0.61402154f, 0.614324212f, 0.614626765f, 0.614929199f,
+	0.615231574f, 0.615533888f, 0.615836084f, 0.61613816f, 0.616440177f, 0.616742074f, 0.617043912f, 0.617345631f,
+	0.61764729f, 0.61794889f, 0.61825031f, 0.618551731f, 0.618852973f, 0.619154155f, 0.619455278f, 0.619756281f,
+	0.620057225f, 0.62035805f, 0.620658755f, 0.620959401f, 0.621259987f, 0.621560454f, 0.621860802f, 0.62216109f,
+	0.622461259f, 0.622761369f, 0.623061359f, 0.62336129f, 0.623661101f, 0.623960853f, 0.624260485f, 0.624560058f,
+	0.624859512f, 0.625158846f, 0.625458121f, 0.625757277f, 0.626056373f, 0.62635541f, 0.626654267f, 0.626953125f,
+	0.627251804f, 0.627550423f, 0.627848983f, 0.628147423f, 0.628445745f, 0.628744006f, 0.629042208f, 0.629340231f,
+	0.629638255f, 0.629936099f, 0.630233943f, 0.630531609f, 0.630829215f, 0.631126761f, 0.631424189f, 0.631721497f,
+	0.632018745f, 0.632315874f, 0.632612944f, 0.632909894f, 0.633206785f, 0.633503556f, 0.633800209f, 0.634096801f,
+	0.634393275f, 0.634689689f, 0.634985983f, 0.635282218f, 0.635578334f, 0.635874331f, 0.636170268f, 0.636466146f,
+	0.636761844f, 0.637057483f, 0.637353063f, 0.637648523f, 0.637943923f, 0.638239205f, 0.638534367f, 0.63882947f,
+	0.639124453f, 0.639419317f, 0.639714181f, 0.640008867f, 0.640303493f, 0.640597999f, 0.640892446f, 0.641186774f,
+	0.641481042f, 0.641775131f, 0.642069221f, 0.642363191f, 0.642657042f, 0.642950833f, 0.643244505f, 0.643538058f,
+	0.643831551f, 0.644124925f, 0.64441824f, 0.644711435f, 0.645004511f, 0.645297527f, 0.645590484f, 0.645883262f,
+	0.64617604f, 0.646468639f, 0.646761179f, 0.647053599f, 0.64734596f, 0.647638202f, 0.647930384f, 0.648222446f,
+	0.64851439f, 0.648806274f, 0.649098039f, 0.649389744f, 0.64968133f, 0.649972796f, 0.650264204f, 0.650555491f,
+	0.65084666f, 0.651137769f, 0.651428819f, 0.651719689f, 0.65201056f, 0.652301252f, 0.652591884f, 0.652882397f,
+	0.653172851f, 0.653463185f, 0.6537534f, 0.654043555f, 0.654333591f, 0.654623568f, 0.654913425f, 0.655203164f,
+	0.655492842f, 0.655782402f, 0.656071901f, 0.656361282f, 0.656650543f, 0.656939745f, 0.657228827f, 0.657517791f,
+	0.657806695f, 0.658095479f, 0.658384204f, 0.65867281f, 0.658961296f, 0.659249723f, 0.659538031f, 0.659826219f,
+	0.660114348f, 0.660402358f, 0.660690308f, 0.660978138f, 0.66126585f, 0.661553442f, 0.661840975f, 0.662128448f,
+	0.662415802f, 0.662703037f, 0.662990153f, 0.663277209f, 0.663564146f, 0.663851023f, 0.664137781f, 0.664424419f,
+	0.664710999f, 0.664997458f, 0.665283799f, 0.66557008f, 0.665856242f, 0.666142285f, 0.666428268f, 0.666714132f,
+	0.666999936f, 0.667285621f, 0.667571187f, 0.667856634f, 0.668142021f, 0.668427348f, 0.668712497f, 0.668997586f,
+	0.669282615f, 0.669567466f, 0.669852257f, 0.670136988f, 0.670421541f, 0.670706034f, 0.670990467f, 0.671274781f,
+	0.671558976f, 0.671843052f, 0.672127068f, 0.672410965f, 0.672694743f, 0.672978461f, 0.67326206f, 0.673545599f,
+	0.673829019f, 0.67411232f, 0.674395502f, 0.674678624f, 0.674961627f, 0.67524457f, 0.675527394f, 0.675810099f,
+	0.676092684f, 0.67637521f, 0.676657617f, 0.676939964f, 0.677222192f, 0.677504301f, 0.677786291f, 0.678068221f,
+	0.678350031f, 0.678631783f, 0.678913355f, 0.679194927f, 0.679476321f, 0.679757655f, 0.680038869f, 0.680319965f,
+	0.680601001f, 0.680881917f, 0.681162715f, 0.681443453f, 0.681724072f, 0.682004571f, 0.682285011f, 0.682565331f,
+	0.682845533f, 0.683125675f, 0.683405697f, 0.683685601f, 0.683965385f, 0.68424511f, 0.684524715f, 0.684804261f,
+	0.685083687f, 0.685362995f, 0.685642183f, 0.685921311f, 0.686200321f, 0.686479211f, 0.686758041f, 0.687036753f,
+	0.687315345f, 0.687593818f, 0.687872231f, 0.688150525f, 0.68842876f, 0.688706875f, 0.688984871f, 0.689262748f,
+	0.689540565f, 0.689818263f, 0.690095842f, 0.690373302f, 0.690650702f, 0.690927982f, 0.691205204f, 0.691482246f,
+	0.691759229f, 0.692036152f, 0.692312896f, 0.692589581f, 0.692866147f, 0.693142653f, 0.693419039f, 0.693695307f,
+	0.693971455f, 0.694247544f, 0.694523513f, 0.694799364f, 0.695075095f, 0.695350766f, 0.695626318f, 0.695901752f,
+	0.696177125f, 0.696452379f, 0.696727514f, 0.69700259f, 0.697277486f, 0.697552323f, 0.697827101f, 0.698101699f,
+	0.698376238f, 0.698650658f, 0.698925018f, 0.6991992f, 0.699473321f, 0.699747384f, 0.700021267f, 0.700295091f,
+	0.700568795f, 0.700842381f, 0.701115906f, 0.701389313f, 0.7016626f, 0.701935768f, 0.702208877f, 0.702481866f,
+	0.702754736f, 0.703027546f, 0.703300178f, 0.70357275f, 0.703845263f, 0.704117596f, 0.70438987f, 0.704662025f,
+	0.704934061f, 0.705206037f, 0.705477893f, 0.705749631f, 0.706021249f, 0.706292808f, 0.706564248f, 0.706835568f,
+	0.707106769f, 0.707377911f, 0.707648933f, 0.707919836f, 0.70819062f, 0.708461344f, 0.708731949f, 0.709002435f,
+	0.709272802f, 0.709543109f, 0.709813297f, 0.710083365f, 0.710353374f, 0.710623205f, 0.710892975f, 0.711162627f,
+	0.711432219f, 0.711701632f, 0.711970985f, 0.712240219f, 0.712509394f, 0.712778389f, 0.713047326f, 0.713316143f,
+	0.71358484f, 0.713853478f, 0.714121997f, 0.714390397f, 0.714658678f, 0.714926898f, 0.715194941f, 0.715462923f,
+	0.715730846f, 0.71599859f, 0.716266274f, 0.71653384f, 0.716801286f, 0.717068613f, 0.71733588f, 0.717603028f,
+	0.717870057f, 0.718136966f, 0.718403816f, 0.718670487f, 0.718937099f, 0.719203651f, 0.719470024f, 0.719736338f,
+	0.720002532f, 0.720268607f, 0.720534563f, 0.720800459f, 0.721066177f, 0.721331835f, 0.721597433f, 0.721862853f,
+	0.722128212f, 0.722393453f, 0.722658575f, 0.722923577f, 0.72318846f, 0.723453283f, 0.723717988f, 0.723982573f,
+	0.724247098f, 0.724511445f, 0.724775732f, 0.725039899f, 0.725303948f, 0.725567937f, 0.725831807f, 0.726095498f,
+	0.726359129f, 0.726622701f, 0.726886094f, 0.727149427f, 0.727412641f, 0.727675736f, 0.727938712f, 0.728201628f,
+	0.728464365f, 0.728727043f, 0.728989601f, 0.7292521f, 0.72951442f, 0.72977668f, 0.730038822f, 0.730300844f,
+	0.730562747f, 0.73082459f, 0.731086314f, 0.731347919f, 0.731609404f, 0.73187077f, 0.732132018f, 0.732393205f,
+	0.732654274f, 0.732915223f, 0.733176053f, 0.733436823f, 0.733697414f, 0.733957946f, 0.734218359f, 0.734478652f,
+	0.734738886f, 0.734998941f, 0.735258937f, 0.735518813f, 0.73577857f, 0.736038268f, 0.736297786f, 0.736557245f,
+	0.736816585f, 0.737075806f, 0.737334907f, 0.737593889f, 0.737852812f, 0.738111615f, 0.738370299f, 0.738628864f,
+	0.73888731f, 0.739145696f, 0.739403903f, 0.739662051f, 0.73992008f, 0.740177989f, 0.740435839f, 0.74069351f,
+	0.740951121f, 0.741208613f, 0.741465986f, 0.741723239f, 0.741980433f, 0.742237449f, 0.742494404f, 0.742751241f,
+	0.743007958f, 0.743264556f, 0.743521094f, 0.743777454f, 0.744033754f, 0.744289935f, 0.744545996f, 0.744801939f,
+	0.745057762f, 0.745313525f, 0.74556917f, 0.745824695f, 0.746080101f, 0.746335387f, 0.746590555f, 0.746845663f,
+	0.747100592f, 0.747355461f, 0.747610211f, 0.747864842f, 0.748119354f, 0.748373806f, 0.74862808f, 0.748882294f,
+	0.749136388f, 0.749390364f, 0.74964422f, 0.749898016f, 0.750151634f, 0.750405192f, 0.750658631f, 0.750911951f,
+	0.751165152f, 0.751418233f, 0.751671195f, 0.751924098f, 0.752176821f, 0.752429485f, 0.75268203f, 0.752934456f,
+	0.753186822f, 0.753439009f, 0.753691137f, 0.753943086f, 0.754194975f, 0.754446745f, 0.754698396f, 0.754949927f,
+	0.755201399f, 0.755452693f, 0.755703926f, 0.75595504f, 0.756205976f, 0.756456852f, 0.756707668f, 0.756958306f,
+	0.757208824f, 0.757459283f, 0.757709622f, 0.757959783f, 0.758209884f, 0.758459926f, 0.758709788f, 0.758959532f,
+	0.759209216f, 0.759458721f, 0.759708166f, 0.759957492f, 0.760206699f, 0.760455787f, 0.760704756f, 0.760953605f,
+	0.761202395f, 0.761451006f, 0.761699557f, 0.761947989f, 0.762196302f, 0.762444496f, 0.762692571f, 0.762940526f,
+	0.763188422f, 0.763436139f, 0.763683796f, 0.763931334f, 0.764178753f, 0.764426053f, 0.764673233f, 0.764920294f,
+	0.765167236f, 0.765414119f, 0.765660882f, 0.765907466f, 0.766153991f, 0.766400397f, 0.766646683f, 0.76689285f,
+	0.767138898f, 0.767384887f, 0.767630696f, 0.767876446f, 0.768122017f, 0.768367529f, 0.768612921f, 0.768858194f,
+	0.769103348f, 0.769348383f, 0.769593298f, 0.769838154f, 0.770082831f, 0.770327449f, 0.770571887f, 0.770816267f,
+	0.771060526f, 0.771304667f, 0.771548688f, 0.771792591f, 0.772036374f, 0.772280097f, 0.772523642f, 0.772767127f,
+	0.773010433f, 0.773253679f, 0.773496807f, 0.773739815f, 0.773982704f, 0.774225473f, 0.774468124f, 0.774710655f,
+	0.774953127f, 0.77519542f, 0.775437653f, 0.775679708f, 0.775921702f, 0.776163578f, 0.776405334f, 0.776646972f,
+	0.77688849f, 0.777129889f, 0.777371168f, 0.777612329f, 0.777853429f, 0.778094351f, 0.778335214f, 0.778575897f,
+	0.778816521f, 0.779057026f, 0.779297352f, 0.779537618f, 0.779777765f, 0.780017793f, 0.780257761f, 0.780497551f,
+	0.780737221f, 0.780976772f, 0.781216264f, 0.781455576f, 0.781694829f, 0.781933963f, 0.782172918f, 0.782411814f,
+	0.78265059f, 0.782889247f, 0.783127785f, 0.783366203f, 0.783604503f, 0.783842683f, 0.784080803f, 0.784318745f,
+	0.784556568f, 0.784794331f, 0.785031915f, 0.785269439f, 0.785506845f, 0.785744071f, 0.785981238f, 0.786218286f,
+	0.786455214f, 0.786692023f, 0.786928713f, 0.787165284f, 0.787401736f, 0.787638068f, 0.787874341f, 0.788110435f,
+	0.78834641f, 0.788582325f, 0.788818061f, 0.789053738f, 0.789289236f, 0.789524674f, 0.789759994f, 0.789995134f,
+	0.790230215f, 0.790465176f, 0.790700018f, 0.790934741f, 0.791169345f, 0.79140383f, 0.791638196f, 0.791872442f,
+	0.792106569f, 0.792340577f, 0.792574525f, 0.792808294f, 0.793041945f, 0.793275535f, 0.793508947f, 0.793742299f,
+	0.793975472f, 0.794208586f, 0.794441521f, 0.794674397f, 0.794907153f, 0.79513973f, 0.795372248f, 0.795604646f,
+	0.795836926f, 0.796069086f, 0.796301067f, 0.796532989f, 0.796764791f, 0.796996474f, 0.797228038f, 0.797459483f,
+	0.797690868f, 0.797922075f, 0.798153162f, 0.79838413f, 0.798614979f, 0.798845768f, 0.799076378f, 0.79930687f,
+	0.799537241f, 0.799767554f, 0.799997687f, 0.800227761f, 0.800457656f, 0.800687492f, 0.800917149f, 0.801146746f,
+	0.801376164f, 0.801605523f, 0.801834702f, 0.802063823f, 0.802292824f, 0.802521646f, 0.802750409f, 0.802979052f,
+	0.803207517f, 0.803435922f, 0.803664207f, 0.803892314f, 0.804120362f, 0.80434829f, 0.804576099f, 0.804803789f,
+	0.805031359f, 0.805258751f, 0.805486083f, 0.805713296f, 0.80594039f, 0.806167364f, 0.806394219f, 0.806620955f,
+	0.806847572f, 0.80707407f, 0.807300448f, 0.807526708f, 0.807752848f, 0.807978809f, 0.80820471f, 0.808430493f,
+	0.808656156f, 0.8088817f, 0.809107125f, 0.80933243f, 0.809557617f, 0.809782684f, 0.810007632f, 0.81023246f,
+	0.81045717f, 0.81068176f, 0.810906231f, 0.811130643f, 0.811354876f, 0.811578989f, 0.811802983f, 0.812026858f,
+	0.812250614f, 0.812474251f, 0.812697768f, 0.812921166f, 0.813144386f, 0.813367546f, 0.813590586f, 0.813813508f,
+	0.81403631f, 0.814258993f, 0.814481556f, 0.814704001f, 0.814926326f, 0.815148532f, 0.815370619f, 0.815592587f,
+	0.815814435f, 0.816036105f, 0.816257715f, 0.816479206f, 0.816700578f, 0.81692183f, 0.817142904f, 0.817363918f,
+	0.817584813f, 0.817805588f, 0.818026185f, 0.818246722f, 0.81846714f, 0.818687379f, 0.818907559f, 0.819127619f,
+	0.819347501f, 0.819567323f, 0.819786966f, 0.820006549f, 0.820225954f, 0.820445299f, 0.820664465f, 0.820883572f,
+	0.8211025f, 0.821321368f, 0.821540058f, 0.821758628f, 0.821977139f, 0.82219547f, 0.822413683f, 0.822631776f,
+	0.82284981f, 0.823067665f, 0.823285401f, 0.823503017f, 0.823720515f, 0.823937893f, 0.824155152f, 0.824372292f,
+	0.824589312f, 0.824806213f, 0.825022995f, 0.825239599f, 0.825456142f, 0.825672567f, 0.825888872f, 0.826104999f,
+	0.826321065f, 0.826537013f, 0.826752782f, 0.826968491f, 0.827184021f, 0.827399492f, 0.827614784f, 0.827829957f,
+	0.82804507f, 0.828260005f, 0.82847482f, 0.828689516f, 0.828904092f, 0.82911855f, 0.829332948f, 0.829547107f,
+	0.829761207f, 0.829975188f, 0.830189049f, 0.830402792f, 0.830616415f, 0.830829859f, 0.831043243f, 0.831256509f,
+	0.831469595f, 0.831682622f, 0.831895471f, 0.832108259f, 0.832320869f, 0.83253336f, 0.83274579f, 0.832958043f,
+	0.833170176f, 0.833382189f, 0.833594084f, 0.833805859f, 0.834017515f, 0.834229052f, 0.83444041f, 0.834651709f,
+	0.834862888f, 0.835073888f, 0.835284829f, 0.835495591f, 0.835706294f, 0.835916817f, 0.836127281f, 0.836337566f,
+	0.836547732f, 0.836757779f, 0.836967707f, 0.837177515f, 0.837387204f, 0.837596774f, 0.837806225f, 0.838015497f,
+	0.838224709f, 0.838433802f, 0.838642716f, 0.838851511f, 0.839060247f, 0.839268804f, 0.839477241f, 0.839685619f,
+	0.839893818f, 0.840101898f, 0.840309858f, 0.84051764f, 0.840725362f, 0.840932965f, 0.841140449f, 0.841347754f,
+	0.841554999f, 0.841762066f, 0.841969013f, 0.842175901f, 0.84238261f, 0.8425892f, 0.84279567f, 0.843002021f,
+	0.843208253f, 0.843414366f, 0.8436203f, 0.843826175f, 0.84403187f, 0.844237506f, 0.844442964f, 0.844648361f,
+	0.84485358f, 0.84505868f, 0.84526366f, 0.845468521f, 0.845673263f, 0.845877886f, 0.84608233f, 0.846286714f,
+	0.84649092f, 0.846695065f, 0.846899033f, 0.84710288f, 0.847306609f, 0.847510278f, 0.847713768f, 0.84791708f,
+	0.848120332f, 0.848323464f, 0.848526478f, 0.848729312f, 0.848932028f, 0.849134684f, 0.849337161f, 0.849539518f,
+	0.849741757f, 0.849943876f, 0.850145876f, 0.850347757f, 0.850549459f, 0.850751102f, 0.850952566f, 0.85115397f,
+	0.851355195f, 0.851556301f, 0.851757288f, 0.851958156f, 0.852158904f, 0.852359533f, 0.852559984f, 0.852760375f,
+	0.852960587f, 0.853160739f, 0.853360713f, 0.853560567f, 0.853760302f, 0.853959918f, 0.854159415f, 0.854358733f,
+	0.854557991f, 0.854757071f, 0.85495609f, 0.855154932f, 0.855353653f, 0.855552256f, 0.85575074f, 0.855949104f,
+	0.856147349f, 0.856345415f, 0.856543422f, 0.85674125f, 0.856938958f, 0.857136548f, 0.857334018f, 0.857531369f,
+	0.857728601f, 0.857925713f, 0.858122647f, 0.858319521f, 0.858516216f, 0.858712792f, 0.858909249f, 0.859105587f,
+	0.859301805f, 0.859497905f, 0.859693885f, 0.859889686f, 0.860085368f, 0.860280991f, 0.860476434f, 0.860671759f,
+	0.860866964f, 0.86106199f, 0.861256957f, 0.861451745f, 0.861646473f, 0.861841023f, 0.862035453f, 0.862229764f,
+	0.862423956f, 0.862618029f, 0.862811923f, 0.863005757f, 0.863199413f, 0.863392949f, 0.863586366f, 0.863779664f,
+	0.863972843f, 0.864165902f, 0.864358783f, 0.864551604f, 0.864744246f, 0.864936769f, 0.865129173f, 0.865321457f,
+	0.865513623f, 0.865705669f, 0.865897536f, 0.866089284f, 0.866280973f, 0.866472483f, 0.866663873f, 0.866855085f,
+	0.867046237f, 0.86723727f, 0.867428124f, 0.867618859f, 0.867809474f, 0.867999971f, 0.868190348f, 0.868380606f,
+	0.868570685f, 0.868760705f, 0.868950546f, 0.869140267f, 0.86932987f, 0.869519353f, 0.869708657f, 0.869897902f,
+	0.870086968f, 0.870275974f, 0.870464802f, 0.87065351f, 0.87084204f, 0.871030509f, 0.87121886f, 0.871407032f,
+	0.871595085f, 0.871783018f, 0.871970832f, 0.872158527f, 0.872346044f, 0.8725335f, 0.872720778f, 0.872907937f,
+	0.873094976f, 0.873281896f, 0.873468697f, 0.873655319f, 0.873841822f, 0.874028265f, 0.87421453f, 0.874400616f,
+	0.874586642f, 0.874772549f, 0.874958277f, 0.875143886f, 0.875329375f, 0.875514746f, 0.875699997f, 0.875885129f,
+	0.876070082f, 0.876254916f, 0.876439691f, 0.876624286f, 0.876808703f, 0.87699306f, 0.877177238f, 0.877361357f,
+	0.877545297f, 0.877729118f, 0.877912819f, 0.878096342f, 0.878279805f, 0.878463089f, 0.878646255f, 0.8788293f,
+	0.879012227f, 0.879195035f, 0.879377663f, 0.879560173f, 0.879742622f, 0.879924834f, 0.880106986f, 0.880289018f,
+	0.880470872f, 0.880652666f, 0.880834281f, 0.881015778f, 0.881197095f, 0.881378353f, 0.881559432f, 0.881740451f,
+	0.881921291f, 0.882101953f, 0.882282555f, 0.882463038f, 0.882643342f, 0.882823527f, 0.883003592f, 0.883183539f,
+	0.883363366f, 0.883543015f, 0.883722544f, 0.883901954f, 0.884081244f, 0.884260416f, 0.884439468f, 0.884618342f,
+	0.884797096f, 0.884975731f, 0.885154247f, 0.885332584f, 0.885510862f, 0.885688961f, 0.88586694f, 0.8860448f,
+	0.886222541f, 0.886400104f, 0.886577606f, 0.88675493f, 0.886932135f, 0.88710916f, 0.887286127f, 0.887462914f,
+	0.887639642f, 0.887816191f, 0.887992561f, 0.888168871f, 0.888345063f, 0.888521075f, 0.888696969f, 0.888872743f,
+	0.889048338f, 0.889223874f, 0.88939923f, 0.889574468f, 0.889749587f, 0.889924586f, 0.890099406f, 0.890274107f,
+	0.890448749f, 0.890623152f, 0.890797496f, 0.89097172f, 0.891145766f, 0.891319692f, 0.891493499f, 0.891667187f,
+	0.891840696f, 0.892014146f, 0.892187417f, 0.892360568f, 0.892533541f, 0.892706454f, 0.892879188f, 0.893051803f,
+	0.893224299f, 0.893396676f, 0.893568873f, 0.893740952f, 0.893912971f, 0.894084752f, 0.894256473f, 0.894428074f,
+	0.894599497f, 0.894770801f, 0.894941986f, 0.895112991f, 0.895283937f, 0.895454705f, 0.895625353f, 0.895795882f,
+	0.895966232f, 0.896136522f, 0.896306634f, 0.896476626f, 0.8966465f, 0.896816194f, 0.896985769f, 0.897155225f,
+	0.897324562f, 0.89749378f, 0.897662818f, 0.897831798f, 0.898000598f, 0.898169279f, 0.898337781f, 0.898506165f,
+	0.898674488f, 0.898842633f, 0.899010599f, 0.899178505f, 0.899346232f, 0.899513841f, 0.89968133f, 0.8998487f,
+	0.900015891f, 0.900182962f, 0.900349915f, 0.900516748f, 0.900683403f, 0.900849998f, 0.901016414f, 0.901182711f,
+	0.901348829f, 0.901514888f, 0.901680768f, 0.901846528f, 0.902012169f, 0.902177632f, 0.902342975f, 0.902508199f,
+	0.902673304f, 0.90283829f, 0.903003097f, 0.903167784f, 0.903332353f, 0.903496802f, 0.903661072f, 0.903825283f,
+	0.903989315f, 0.904153168f, 0.904316962f, 0.904480577f, 0.904644072f, 0.904807448f, 0.904970706f, 0.905133784f,
+	0.905296743f, 0.905459583f, 0.905622303f, 0.905784845f, 0.905947268f, 0.906109571f, 0.906271756f, 0.906433821f,
+	0.906595707f, 0.906757474f, 0.906919122f, 0.907080591f, 0.907242f, 0.907403231f, 0.907564342f, 0.907725275f,
+	0.907886088f, 0.908046842f, 0.908207357f, 0.908367813f, 0.90852809f, 0.908688307f, 0.908848345f, 0.909008205f,
+	0.909168005f, 0.909327626f, 0.909487128f, 0.909646451f, 0.909805715f, 0.9099648f, 0.910123765f, 0.910282612f,
+	0.910441279f, 0.910599828f, 0.910758257f, 0.910916567f, 0.911074758f, 0.911232769f, 0.911390662f, 0.911548436f,
+	0.91170603f, 0.911863506f, 0.912020862f, 0.912178099f, 0.912335157f, 0.912492156f, 0.912648976f, 0.912805617f,
+	0.912962198f, 0.913118601f, 0.913274884f, 0.913431048f, 0.913587034f, 0.9137429f, 0.913898647f, 0.914054275f,
+	0.914209783f, 0.914365113f, 0.914520323f, 0.914675355f, 0.914830327f, 0.91498512f, 0.915139794f, 0.91529429f,
+	0.915448725f, 0.915602982f, 0.91575712f, 0.915911078f, 0.916064978f, 0.916218698f, 0.916372299f, 0.916525722f,
+	0.916679084f, 0.916832268f, 0.916985273f, 0.917138219f, 0.917290986f, 0.917443633f, 0.917596161f, 0.917748511f,
+	0.917900801f, 0.918052912f, 0.918204844f, 0.918356717f, 0.91850841f, 0.918659985f, 0.918811381f, 0.918962717f,
+	0.919113874f, 0.919264853f, 0.919415772f, 0.919566512f, 0.919717133f, 0.919867635f, 0.920017958f, 0.920168221f,
+	0.920318305f, 0.920468211f, 0.920618057f, 0.920767725f, 0.920917213f, 0.921066642f, 0.921215892f, 0.921365023f,
+	0.921514034f, 0.921662927f, 0.92181164f, 0.921960235f, 0.92210865f, 0.922257006f, 0.922405183f, 0.922553241f,
+	0.92270112f, 0.92284888f, 0.922996521f, 0.923144042f, 0.923291445f, 0.923438668f, 0.923585773f, 0.923732698f,
+	0.923879504f, 0.924026251f, 0.924172759f, 0.924319208f, 0.924465477f, 0.924611628f, 0.9247576f, 0.924903512f,
+	0.925049245f, 0.92519486f, 0.925340295f, 0.925485611f, 0.925630808f, 0.925775886f, 0.925920784f, 0.926065564f,
+	0.926210225f, 0.926354766f, 0.926499128f, 0.926643372f, 0.926787496f, 0.926931441f, 0.927075267f, 0.927218974f,
+	0.927362502f, 0.92750597f, 0.92764926f, 0.92779237f, 0.927935421f, 0.928078294f, 0.928220987f, 0.928363621f,
+	0.928506076f, 0.928648412f, 0.928790629f, 0.928932667f, 0.929074585f, 0.929216385f, 0.929358006f, 0.929499507f,
+	0.929640889f, 0.929782152f, 0.929923236f, 0.930064201f, 0.930205047f, 0.930345714f, 0.930486262f, 0.93062669f,
+	0.93076694f, 0.93090713f, 0.931047082f, 0.931186974f, 0.931326687f, 0.931466281f, 0.931605756f, 0.931745052f,
+	0.931884289f, 0.932023287f, 0.932162225f, 0.932300985f, 0.932439625f, 0.932578146f, 0.932716489f, 0.932854712f,
+	0.932992816f, 0.933130741f, 0.933268547f, 0.933406234f, 0.933543801f, 0.93368119f, 0.93381846f, 0.93395555f,
+	0.934092522f, 0.934229374f, 0.934366107f, 0.934502721f, 0.934639156f, 0.934775412f, 0.934911609f, 0.935047626f,
+	0.935183525f, 0.935319245f, 0.935454845f, 0.935590327f, 0.935725689f, 0.935860872f, 0.935995936f, 0.936130881f,
+	0.936265647f, 0.936400294f, 0.936534822f, 0.93666923f, 0.93680346f, 0.936937571f, 0.937071502f, 0.937205315f,
+	0.937339008f, 0.937472582f, 0.937605977f, 0.937739253f, 0.93787235f, 0.938005388f, 0.938138247f, 0.938270926f,
+	0.938403547f, 0.938535988f, 0.938668311f, 0.938800454f, 0.938932478f, 0.939064384f, 0.93919611f, 0.939327717f,
+	0.939459205f, 0.939590573f, 0.939721763f, 0.939852834f, 0.939983726f, 0.940114558f, 0.940245211f, 0.940375686f,
+	0.940506041f, 0.940636277f, 0.940766394f, 0.940896332f, 0.941026151f, 0.941155851f, 0.941285372f, 0.941414773f,
+	0.941544056f, 0.941673219f, 0.941802204f, 0.941931009f, 0.942059755f, 0.942188323f, 0.942316771f, 0.94244504f,
+	0.94257319f, 0.942701221f, 0.942829072f, 0.942956865f, 0.943084419f, 0.943211913f, 0.943339229f, 0.943466425f,
+	0.943593442f, 0.943720341f, 0.94384712f, 0.94397378f, 0.944100261f, 0.944226623f, 0.944352806f, 0.944478929f,
+	0.944604814f, 0.944730639f, 0.944856286f, 0.944981813f, 0.945107222f, 0.945232451f, 0.945357561f, 0.945482492f,
+	0.945607305f, 0.945731997f, 0.945856571f, 0.945980966f, 0.946105242f, 0.946229339f, 0.946353376f, 0.946477175f,
+	0.946600914f, 0.946724474f, 0.946847916f, 0.946971238f, 0.947094381f, 0.947217405f, 0.94734025f, 0.947462976f,
+	0.947585583f, 0.94770807f, 0.947830379f, 0.947952569f, 0.948074579f, 0.948196471f, 0.948318243f, 0.948439896f,
+	0.94856137f, 0.948682666f, 0.948803902f, 0.948924959f, 0.949045897f, 0.949166656f, 0.949287295f, 0.949407816f,
+	0.949528158f, 0.94964838f, 0.949768484f, 0.949888468f, 0.950008273f, 0.9501279f, 0.950247467f, 0.950366855f,
+	0.950486064f, 0.950605154f, 0.950724125f, 0.950842977f, 0.950961649f, 0.951080203f, 0.951198637f, 0.951316893f,
+	0.95143503f, 0.951552987f, 0.951670885f, 0.951788545f, 0.951906145f, 0.952023566f, 0.952140868f, 0.952257991f,
+	0.952374995f, 0.952491879f, 0.952608585f, 0.952725172f, 0.95284164f, 0.952957928f, 0.953074098f, 0.953190148f,
+	0.953306019f, 0.953421772f, 0.953537405f, 0.953652859f, 0.953768194f, 0.95388335f, 0.953998446f, 0.954113305f,
+	0.954228103f, 0.954342723f, 0.954457223f, 0.954571545f, 0.954685748f, 0.954799831f, 0.954913735f, 0.955027521f,
+	0.955141187f, 0.955254674f, 0.955368042f, 0.955481231f, 0.955594361f, 0.955707252f, 0.955820084f, 0.955932736f,
+	0.95604527f, 0.956157625f, 0.95626986f, 0.956381977f, 0.956493914f, 0.956605732f, 0.956717432f, 0.956828952f,
+	0.956940353f, 0.957051575f, 0.957162678f, 0.957273662f, 0.957384527f, 0.957495213f, 0.95760572f, 0.957716167f,
+	0.957826436f, 0.957936525f, 0.958046496f, 0.958156347f, 0.958266079f, 0.958375633f, 0.958485067f, 0.958594322f,
+	0.958703458f, 0.958812475f, 0.958921313f, 0.959030032f, 0.959138632f, 0.959247053f, 0.959355354f, 0.959463477f,
+	0.95957154f, 0.959679365f, 0.95978713f, 0.959894717f, 0.960002124f, 0.960109472f, 0.960216641f, 0.960323632f,
+	0.960430503f, 0.960537255f, 0.960643888f, 0.960750341f, 0.960856616f, 0.960962832f, 0.961068869f, 0.961174726f,
+	0.961280465f, 0.961386085f, 0.961491585f, 0.961596906f, 0.961702049f, 0.961807132f, 0.961912036f, 0.962016761f,
+	0.962121427f, 0.962225854f, 0.962330222f, 0.962434411f, 0.962538481f, 0.962642372f, 0.962746143f, 0.962849796f,
+	0.962953269f, 0.963056624f, 0.9631598f, 0.963262856f, 0.963365793f, 0.963468552f, 0.963571191f, 0.963673711f,
+	0.963776052f, 0.963878274f, 0.963980377f, 0.964082301f, 0.964184046f, 0.964285731f, 0.964387238f, 0.964488566f,
+	0.964589775f, 0.964690864f, 0.964791834f, 0.964892626f, 0.964993238f, 0.965093791f, 0.965194106f, 0.965294361f,
+	0.965394437f, 0.965494394f, 0.965594172f, 0.965693831f, 0.965793371f, 0.965892732f, 0.965991974f, 0.966091037f,
+	0.966189981f, 0.966288805f, 0.966387451f, 0.966485977f, 0.966584384f, 0.966682613f, 0.966780722f, 0.966878653f,
+	0.966976464f, 0.967074156f, 0.967171669f, 0.967269063f, 0.967366278f, 0.967463374f, 0.967560351f, 0.967657149f,
+	0.967753828f, 0.967850387f, 0.967946768f, 0.968043029f, 0.968139112f, 0.968235075f, 0.96833086f, 0.968426585f,
+	0.968522072f, 0.968617499f, 0.968712747f, 0.968807817f, 0.968902826f, 0.968997598f, 0.969092309f, 0.969186842f,
+	0.969281256f, 0.969375491f, 0.969469607f, 0.969563544f, 0.969657362f, 0.96975106f, 0.96984458f, 0.96993798f,
+	0.970031261f, 0.970124364f, 0.970217347f, 0.970310152f, 0.970402837f, 0.970495403f, 0.97058779f, 0.970680058f,
+	0.970772147f, 0.970864117f, 0.970955908f, 0.97104764f, 0.971139133f, 0.971230567f, 0.971321821f, 0.971412897f,
+	0.971503913f, 0.971594691f, 0.97168541f, 0.971775949f, 0.97186631f, 0.971956611f, 0.972046733f, 0.972136676f,
+	0.972226501f, 0.972316206f, 0.972405732f, 0.972495139f, 0.972584367f, 0.972673476f, 0.972762465f, 0.972851276f,
+	0.972939968f, 0.973028481f, 0.973116875f, 0.973205149f, 0.973293245f, 0.973381221f, 0.973469019f, 0.973556697f,
+	0.973644257f, 0.973731637f, 0.973818898f, 0.973905981f, 0.973992944f, 0.974079788f, 0.974166453f, 0.974252999f,
+	0.974339366f, 0.974425614f, 0.974511743f, 0.974597692f, 0.974683523f, 0.974769175f, 0.974854708f, 0.974940121f,
+	0.975025356f, 0.975110471f, 0.975195408f, 0.975280225f, 0.975364864f, 0.975449383f, 0.975533783f, 0.975618005f,
+	0.975702107f, 0.97578609f, 0.975869894f, 0.975953579f, 0.976037085f, 0.976120472f, 0.97620368f, 0.976286769f,
+	0.976369739f, 0.976452529f, 0.976535201f, 0.976617694f, 0.976700068f, 0.976782322f, 0.976864398f, 0.976946354f,
+	0.977028131f, 0.97710979f, 0.977191329f, 0.977272689f, 0.977353871f, 0.977434993f, 0.977515936f, 0.9775967f,
+	0.977677345f, 0.977757871f, 0.977838218f, 0.977918446f, 0.977998495f, 0.978078425f, 0.978158236f, 0.978237867f,
+	0.97831738f, 0.978396714f, 0.978475928f, 0.978555024f, 0.97863394f, 0.978712678f, 0.978791356f, 0.978869855f,
+	0.978948176f, 0.979026377f, 0.979104459f, 0.979182363f, 0.979260147f, 0.979337752f, 0.979415238f, 0.979492545f,
+	0.979569793f, 0.979646802f, 0.979723752f, 0.979800463f, 0.979877114f, 0.979953587f, 0.980029881f, 0.980106115f,
+	0.980182111f, 0.980258048f, 0.980333805f, 0.980409384f, 0.980484843f, 0.980560184f, 0.980635345f, 0.980710387f,
+	0.980785251f, 0.980859995f, 0.98093462f, 0.981009066f, 0.981083393f, 0.981157541f, 0.98123157f, 0.98130548f,
+	0.981379211f, 0.981452763f, 0.981526256f, 0.98159951f, 0.981672704f, 0.98174572f, 0.981818557f, 0.981891274f,
+	0.981963873f, 0.982036293f, 0.982108593f, 0.982180715f, 0.982252717f, 0.9823246f, 0.982396305f, 0.98246789f,
+	0.982539296f, 0.982610583f, 0.982681692f, 0.982752681f, 0.982823551f, 0.982894242f, 0.982964814f, 0.983035207f,
+	0.983105481f, 0.983175635f, 0.983245611f, 0.983315408f, 0.983385086f, 0.983454645f, 0.983524024f, 0.983593285f,
+	0.983662426f, 0.983731389f, 0.983800232f, 0.983868897f, 0.983937442f, 0.984005809f, 0.984074056f, 0.984142125f,
+	0.984210074f, 0.984277904f, 0.984345555f, 0.984413087f, 0.984480441f, 0.984547675f, 0.984614789f, 0.984681726f,
+	0.984748483f, 0.98481518f, 0.984881639f, 0.984948039f, 0.98501426f, 0.985080302f, 0.985146224f, 0.985212028f,
+	0.985277653f, 0.985343158f, 0.985408485f, 0.985473692f, 0.985538721f, 0.985603631f, 0.985668421f, 0.985733032f,
+	0.985797524f, 0.985861838f, 0.985926032f, 0.985990047f, 0.986053944f, 0.986117721f, 0.986181319f, 0.986244798f,
+	0.986308098f, 0.986371279f, 0.986434281f, 0.986497164f, 0.986559927f, 0.986622512f, 0.986684918f, 0.986747265f,
+	0.986809373f, 0.986871421f, 0.986933291f, 0.986994982f, 0.987056553f, 0.987118006f, 0.987179279f, 0.987240434f,
+	0.987301409f, 0.987362266f, 0.987422943f, 0.987483501f, 0.987543941f, 0.987604201f, 0.987664342f, 0.987724304f,
+	0.987784147f, 0.987843812f, 0.987903357f, 0.987962782f, 0.988022029f, 0.988081098f, 0.988140106f, 0.988198876f,
+	0.988257587f, 0.988316119f, 0.988374472f, 0.988432705f, 0.98849082f, 0.988548756f, 0.988606513f, 0.98866421f,
+	0.988721669f, 0.988779068f, 0.988836288f, 0.98889333f, 0.988950253f, 0.989007056f, 0.98906368f, 0.989120185f,
+	0.989176512f, 0.989232719f, 0.989288747f, 0.989344656f, 0.989400446f, 0.989456058f, 0.98951149f, 0.989566863f,
+	0.989621997f, 0.989677072f, 0.989731967f, 0.989786685f, 0.989841282f, 0.989895701f, 0.989950061f, 0.990004182f,
+	0.990058184f, 0.990112066f, 0.99016583f, 0.990219355f, 0.99027282f, 0.990326107f, 0.990379214f, 0.990432262f,
+	0.990485072f, 0.990537763f, 0.990590334f, 0.990642786f, 0.990695f, 0.990747154f, 0.990799129f, 0.990850925f,
+	0.990902662f, 0.990954161f, 0.99100554f, 0.9910568f, 0.991107941f, 0.991158843f, 0.991209686f, 0.99126035f,
+	0.991310835f, 0.99136126f, 0.991411448f, 0.991461515f, 0.991511464f, 0.991561234f, 0.991610885f, 0.991660416f,
+	0.991709769f, 0.991758943f, 0.991807997f, 0.991856933f, 0.991905689f, 0.991954327f, 0.992002785f, 0.992051125f,
+	0.992099285f, 0.992147326f, 0.992195249f, 0.992242992f, 0.992290616f, 0.992338061f, 0.992385328f, 0.992432535f,
+	0.992479563f, 0.992526412f, 0.992573142f, 0.992619693f, 0.992666125f, 0.992712438f, 0.992758572f, 0.992804587f,
+	0.992850423f, 0.99289614f, 0.992941678f, 0.992987096f, 0.993032336f, 0.993077457f, 0.993122458f, 0.993167281f,
+	0.993211925f, 0.993256509f, 0.993300855f, 0.993345141f, 0.993389189f, 0.993433177f, 0.993476987f, 0.993520617f,
+	0.993564129f, 0.993607521f, 0.993650734f, 0.993693769f, 0.993736744f, 0.99377948f, 0.993822157f, 0.993864655f,
+	0.993906975f, 0.993949175f, 0.993991196f, 0.994033098f, 0.994074881f, 0.994116485f, 0.99415797f, 0.994199276f,
+	0.994240463f, 0.994281471f, 0.99432236f, 0.99436307f, 0.99440366f, 0.994444132f, 0.994484425f, 0.994524539f,
+	0.994564593f, 0.994604409f, 0.994644165f, 0.994683683f, 0.994723141f, 0.994762421f, 0.994801521f, 0.994840503f,
+	0.994879305f, 0.994917989f, 0.994956553f, 0.994994938f, 0.995033205f, 0.995071292f, 0.99510926f, 0.995147049f,
+	0.99518472f, 0.99522227f, 0.995259583f, 0.995296836f, 0.99533391f, 0.995370865f, 0.995407641f, 0.995444238f,
+	0.995480776f, 0.995517075f, 0.995553315f, 0.995589375f, 0.995625257f, 0.99566102f, 0.995696604f, 0.995732069f,
+	0.995767415f, 0.995802581f, 0.995837629f, 0.995872498f, 0.995907247f, 0.995941818f, 0.995976269f, 0.996010542f,
+	0.996044695f, 0.99607873f, 0.996112585f, 0.996146262f, 0.996179819f, 0.996213257f, 0.996246517f, 0.996279657f,
+	0.996312618f, 0.99634546f, 0.996378124f, 0.996410668f, 0.996443033f, 0.996475279f, 0.996507406f, 0.996539354f,
+	0.996571124f, 0.996602774f, 0.996634305f, 0.996665657f, 0.996696889f, 0.996727943f, 0.996758878f, 0.996789694f,
+	0.996820271f, 0.996850789f, 0.996881127f, 0.996911287f, 0.996941328f, 0.99697125f, 0.997000992f, 0.997030616f,
+	0.997060061f, 0.997089386f, 0.997118533f, 0.99714756f, 0.997176409f, 0.997205138f, 0.997233748f, 0.99726218f,
+	0.997290432f, 0.997318566f, 0.99734658f, 0.997374415f, 0.997402132f, 0.997429669f, 0.997457087f, 0.997484326f,
+	0.997511446f, 0.997538447f, 0.99756521f, 0.997591913f, 0.997618437f, 0.997644842f, 0.997671068f, 0.997697115f,
+	0.997723043f, 0.997748852f, 0.997774482f, 0.997799993f, 0.997825325f, 0.997850537f, 0.997875631f, 0.997900546f,
+	0.997925282f, 0.997949898f, 0.997974396f, 0.997998714f, 0.998022854f, 0.998046875f, 0.998070776f, 0.998094499f,
+	0.998118103f, 0.998141527f, 0.998164833f, 0.998188019f, 0.998211026f, 0.998233855f, 0.998256564f, 0.998279154f,
+	0.998301566f, 0.998323798f, 0.998345912f, 0.998367906f, 0.998389721f, 0.998411417f, 0.998432934f, 0.998454332f,
+	0.998475552f, 0.998496652f, 0.998517632f, 0.998538435f, 0.998559058f, 0.998579562f, 0.998599946f, 0.998620152f,
+	0.998640239f, 0.998660147f, 0.998679936f, 0.998699546f, 0.998719037f, 0.998738348f, 0.998757541f, 0.998776555f,
+	0.99879545f, 0.998814225f, 0.998832822f, 0.99885124f, 0.998869538f, 0.998887718f, 0.998905718f, 0.9989236f,
+	0.998941302f, 0.998958886f, 0.99897629f, 0.998993576f, 0.999010682f, 0.999027669f, 0.999044478f, 0.999061167f,
+	0.999077737f, 0.999094129f, 0.999110341f, 0.999126494f, 0.999142408f, 0.999158204f, 0.99917388f, 0.999189377f,
+	0.999204755f, 0.999219954f, 0.999235034f, 0.999249995f, 0.999264777f, 0.99927938f, 0.999293864f, 0.999308169f,
+	0.999322355f, 0.999336421f, 0.999350309f, 0.999364078f, 0.999377668f, 0.999391139f, 0.99940443f, 0.999417603f,
+	0.999430597f, 0.999443471f, 0.999456167f, 0.999468744f, 0.999481201f, 0.99949348f, 0.999505579f, 0.99951756f,
+	0.999529421f, 0.999541104f, 0.999552667f, 0.999564052f, 0.999575317f, 0.999586403f, 0.999597371f, 0.999608159f,
+	0.999618828f, 0.999629319f, 0.99963969f, 0.999649942f, 0.999660015f, 0.999669909f, 0.999679685f, 0.999689341f,
+	0.999698818f, 0.999708176f, 0.999717355f, 0.999726415f, 0.999735296f, 0.999744058f, 0.999752641f, 0.999761105f,
+	0.99976939f, 0.999777555f, 0.999785602f, 0.99979347f, 0.999801159f, 0.999808729f, 0.999816179f, 0.999823451f,
+	0.999830604f, 0.999837577f, 0.999844432f, 0.999851108f, 0.999857664f, 0.999864042f, 0.9998703f, 0.99987638f,
+	0.99988234f, 0.999888182f, 0.999893844f, 0.999899328f, 0.999904692f, 0.999909937f, 0.999915004f, 0.999919951f,
+	0.999924719f, 0.999929309f, 0.999933839f, 0.99993813f, 0.999942362f, 0.999946415f, 0.99995029f, 0.999954045f,
+	0.999957621f, 0.999961078f, 0.999964416f, 0.999967575f, 0.999970615f, 0.999973476f, 0.999976158f, 0.999978721f,
+	0.999981165f, 0.99998343f, 0.999985576f, 0.999987602f, 0.99998939f, 0.999991119f, 0.999992669f, 0.99999404f,
+	0.999995291f, 0.999996424f, 0.999997377f, 0.999998152f, 0.999998808f, 0.999999344f, 0.999999702f, 0.99999994f,
+	1.0f,
+#else
+#error "no generated quarter-wave sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c"
+#endif
+#else
+#if FMATH_TABLE_BITS == 4
+	0.0f, 0.382683426f, 0.707106769f, 0.923879504f, 1.0f, 0.923879504f, 0.707106769f, 0.382683426f,
+	0.0f, -0.382683426f, -0.707106769f, -0.923879504f, -1.0f, -0.923879504f, -0.707106769f, -0.382683426f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 5
+	0.0f, 0.195090324f, 0.382683426f, 0.555570245f, 0.707106769f, 0.831469595f, 0.923879504f, 0.980785251f,
+	1.0f, 0.980785251f, 0.923879504f, 0.831469595f, 0.707106769f, 0.555570245f, 0.382683426f, 0.195090324f,
+	0.0f, -0.195090324f, -0.382683426f, -0.555570245f, -0.707106769f, -0.831469595f, -0.923879504f, -0.980785251f,
+	-1.0f, -0.980785251f, -0.923879504f, -0.831469595f, -0.707106769f, -0.555570245f, -0.382683426f, -0.195090324f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 6
+	0.0f, 0.0980171412f, 0.195090324f, 0.290284663f, 0.382683426f, 0.471396744f, 0.555570245f, 0.634393275f,
+	0.707106769f, 0.773010433f, 0.831469595f, 0.881921291f, 0.923879504f, 0.956940353f, 0.980785251f, 0.99518472f,
+	1.0f, 0.99518472f, 0.980785251f, 0.956940353f, 0.923879504f, 0.881921291f, 0.831469595f, 0.773010433f,
+	0.707106769f, 0.634393275f, 0.555570245f, 0.471396744f, 0.382683426f, 0.290284663f, 0.195090324f, 0.0980171412f,
+	0.0f, -0.0980171412f, -0.195090324f, -0.290284663f, -0.382683426f, -0.471396744f, -0.555570245f, -0.634393275f,
+	-0.707106769f, -0.773010433f, -0.831469595f, -0.881921291f, -0.923879504f, -0.956940353f, -0.980785251f, -0.99518472f,
+	-1.0f, -0.99518472f, -0.980785251f, -0.956940353f, -0.923879504f, -0.881921291f, -0.831469595f, -0.773010433f,
+	-0.707106769f, -0.634393275f, -0.555570245f, -0.471396744f, -0.382683426f, -0.290284663f, -0.195090324f, -0.0980171412f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 7
+	0.0f, 0.0490676761f, 0.0980171412f, 0.146730468f, 0.195090324f, 0.242980182f, 0.290284663f, 0.336889863f,
+	0.382683426f, 0.427555084f, 0.471396744f, 0.514102757f, 0.555570245f, 0.59569931f, 0.634393275f, 0.671558976f,
+	0.707106769f, 0.740951121f, 0.773010433f, 0.803207517f, 0.831469595f, 0.857728601f, 0.881921291f, 0.903989315f,
+	0.923879504f, 0.941544056f, 0.956940353f, 0.970031261f, 0.980785251f, 0.989176512f, 0.99518472f, 0.99879545f,
+	1.0f, 0.99879545f, 0.99518472f, 0.989176512f, 0.980785251f, 0.970031261f, 0.956940353f, 0.941544056f,
+	0.923879504f, 0.903989315f, 0.881921291f, 0.857728601f, 0.831469595f, 0.803207517f, 0.773010433f, 0.740951121f,
+	0.707106769f, 0.671558976f, 0.634393275f, 0.59569931f, 0.555570245f, 0.514102757f, 0.471396744f, 0.427555084f,
+	0.382683426f, 0.336889863f, 0.290284663f, 0.242980182f, 0.195090324f, 0.146730468f, 0.0980171412f, 0.0490676761f,
+	0.0f, -0.0490676761f, -0.0980171412f, -0.146730468f, -0.195090324f, -0.242980182f, -0.290284663f, -0.336889863f,
+	-0.382683426f, -0.427555084f, -0.471396744f, -0.514102757f, -0.555570245f, -0.59569931f, -0.634393275f, -0.671558976f,
+	-0.707106769f, -0.740951121f, -0.773010433f, -0.803207517f, -0.831469595f, -0.857728601f, -0.881921291f, -0.903989315f,
+	-0.923879504f, -0.941544056f, -0.956940353f, -0.970031261f, -0.980785251f, -0.989176512f, -0.99518472f, -0.99879545f,
+	-1.0f, -0.99879545f, -0.99518472f, -0.989176512f, -0.980785251f, -0.970031261f, -0.956940353f, -0.941544056f,
+	-0.923879504f, -0.903989315f, -0.881921291f, -0.857728601f, -0.831469595f, -0.803207517f, -0.773010433f, -0.740951121f,
+	-0.707106769f, -0.671558976f, -0.634393275f, -0.59569931f, -0.555570245f, -0.514102757f, -0.471396744f, -0.427555084f,
+	-0.382683426f, -0.336889863f, -0.290284663f, -0.242980182f, -0.195090324f, -0.146730468f, -0.0980171412f, -0.0490676761f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 8
+	0.0f, 0.024541229f, 0.0490676761f, 0.0735645667f, 0.0980171412f, 0.122410677f, 0.146730468f, 0.170961887f,
+	0.195090324f, 0.219101235f, 0.242980182f, 0.266712755f, 0.290284663f, 0.313681751f, 0.336889863f, 0.359895051f,
+	0.382683426f, 0.405241311f, 0.427555084f, 0.449611336f, 0.471396744f, 0.492898196f, 0.514102757f, 0.534997642f,
+	0.555570245f, 0.575808167f, 0.59569931f, 0.615231574f, 0.634393275f, 0.653172851f, 0.671558976f, 0.689540565f,
+	0.707106769f, 0.724247098f, 0.740951121f, 0.757208824f, 0.773010433f, 0.78834641f, 0.803207517f, 0.817584813f,
+	0.831469595f, 0.84485358f, 0.857728601f, 0.870086968f, 0.881921291f, 0.893224299f, 0.903989315f, 0.914209783f,
+	0.923879504f, 0.932992816f, 0.941544056f, 0.949528158f, 0.956940353f, 0.963776052f, 0.970031261f, 0.975702107f,
+	0.980785251f, 0.985277653f, 0.989176512f, 0.992479563f, 0.99518472f, 0.997290432f, 0.99879545f, 0.999698818f,
+	1.0f, 0.999698818f, 0.99879545f, 0.997290432f, 0.99518472f, 0.992479563f, 0.989176512f, 0.985277653f,
+	0.980785251f, 0.975702107f, 0.970031261f, 0.963776052f, 0.956940353f, 0.949528158f, 0.941544056f, 0.932992816f,
+	0.923879504f, 0.914209783f, 0.903989315f, 0.893224299f, 0.881921291f, 0.870086968f, 0.857728601f, 0.84485358f,
+	0.831469595f, 0.817584813f, 0.803207517f, 0.78834641f, 0.773010433f, 0.757208824f, 0.740951121f, 0.724247098f,
+	0.707106769f, 0.689540565f, 0.671558976f, 0.653172851f, 0.634393275f, 0.615231574f, 0.59569931f, 0.575808167f,
+	0.555570245f, 0.534997642f, 0.514102757f, 0.492898196f, 0.471396744f, 0.449611336f, 0.427555084f, 0.405241311f,
+	0.382683426f, 0.359895051f, 0.336889863f, 0.313681751f, 0.290284663f, 0.266712755f, 0.242980182f, 0.219101235f,
+	0.195090324f, 0.170961887f, 0.146730468f, 0.122410677f, 0.0980171412f, 0.0735645667f, 0.0490676761f, 0.024541229f,
+	0.0f, -0.024541229f, -0.0490676761f, -0.0735645667f, -0.0980171412f, -0.122410677f, -0.146730468f, -0.170961887f,
+	-0.195090324f, -0.219101235f, -0.242980182f, -0.266712755f, -0.290284663f, -0.313681751f, -0.336889863f, -0.359895051f,
+	-0.382683426f, -0.405241311f, -0.427555084f, -0.449611336f, -0.471396744f, -0.492898196f, -0.514102757f, -0.534997642f,
+	-0.555570245f, -0.575808167f, -0.59569931f, -0.615231574f, -0.634393275f, -0.653172851f, -0.671558976f, -0.689540565f,
+	-0.707106769f, -0.724247098f, -0.740951121f, -0.757208824f, -0.773010433f, -0.78834641f, -0.803207517f, -0.817584813f,
+	-0.831469595f, -0.84485358f, -0.857728601f, -0.870086968f, -0.881921291f, -0.893224299f, -0.903989315f, -0.914209783f,
+	-0.923879504f, -0.932992816f, -0.941544056f, -0.949528158f, -0.956940353f, -0.963776052f, -0.970031261f, -0.975702107f,
+	-0.980785251f, -0.985277653f, -0.989176512f, -0.992479563f, -0.99518472f, -0.997290432f, -0.99879545f, -0.999698818f,
+	-1.0f, -0.999698818f, -0.99879545f, -0.997290432f, -0.99518472f, -0.992479563f, -0.989176512f, -0.985277653f,
+	-0.980785251f, -0.975702107f, -0.970031261f, -0.963776052f, -0.956940353f, -0.949528158f, -0.941544056f, -0.932992816f,
+	-0.923879504f, -0.914209783f, -0.903989315f, -0.893224299f, -0.881921291f, -0.870086968f, -0.857728601f, -0.84485358f,
+	-0.831469595f, -0.817584813f, -0.803207517f, -0.78834641f, -0.773010433f, -0.757208824f, -0.740951121f, -0.724247098f,
+	-0.707106769f, -0.689540565f, -0.671558976f, -0.653172851f, -0.634393275f, -0.615231574f, -0.59569931f, -0.575808167f,
+	-0.555570245f, -0.534997642f, -0.514102757f, -0.492898196f, -0.471396744f, -0.449611336f, -0.427555084f, -0.405241311f,
+	-0.382683426f, -0.359895051f, -0.336889863f, -0.313681751f, -0.290284663f, -0.266712755f, -0.242980182f, -0.219101235f,
+	-0.195090324f, -0.170961887f, -0.146730468f, -0.122410677f, -0.0980171412f, -0.0735645667f, -0.0490676761f, -0.024541229f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 9
+	0.0f, 0.0122715384f, 0.024541229f, 0.0368072242f, 0.0490676761f, 0.061320737f, 0.0735645667f, 0.0857973099f,
+	0.0980171412f, 0.110222206f, 0.122410677f, 0.134580702f, 0.146730468f, 0.15885815f, 0.170961887f, 0.183039889f,
+	0.195090324f, 0.207111374f, 0.219101235f, 0.231058106f, 0.242980182f, 0.254865646f, 0.266712755f, 0.27851969f,
+	0.290284663f, 0.302005947f, 0.313681751f, 0.32531029f, 0.336889863f, 0.348418683f, 0.359895051f, 0.371317208f,
+	0.382683426f, 0.393992037f, 0.405241311f, 0.416429549f, 0.427555084f, 0.438616246f, 0.449611336f, 0.460538715f,
+	0.471396744f, 0.482183784f, 0.492898196f, 0.50353837f, 0.514102757f, 0.524589658f, 0.534997642f, 0.545324981f,
+	0.555570245f, 0.565731823f, 0.575808167f, 0.585797846f, 0.59569931f, 0.605511069f, 0.615231574f, 0.624859512f,
+	0.634393275f, 0.643831551f, 0.653172851f, 0.662415802f, 0.671558976f, 0.680601001f, 0.689540565f, 0.698376238f,
+	0.707106769f, 0.715730846f, 0.724247098f, 0.732654274f, 0.740951121f, 0.749136388f, 0.757208824f, 0.765167236f,
+	0.773010433f, 0.780737221f, 0.78834641f, 0.795836926f, 0.803207517f, 0.81045717f, 0.817584813f, 0.824589312f,
+	0.831469595f, 0.838224709f, 0.84485358f, 0.851355195f, 0.857728601f, 0.863972843f, 0.870086968f, 0.876070082f,
+	0.881921291f, 0.887639642f, 0.893224299f, 0.898674488f, 0.903989315f, 0.909168005f, 0.914209783f, 0.919113874f,
+	0.923879504f, 0.928506076f, 0.932992816f, 0.937339008f, 0.941544056f, 0.945607305f, 0.949528158f, 0.953306019f,
+	0.956940353f, 0.960430503f, 0.963776052f, 0.966976464f, 0.970031261f, 0.972939968f, 0.975702107f, 0.97831738f,
+	0.980785251f, 0.983105481f, 0.985277653f, 0.987301409f, 0.989176512f, 0.990902662f, 0.992479563f, 0.993906975f,
+	0.99518472f, 0.996312618f, 0.997290432f, 0.998118103f, 0.99879545f, 0.999322355f, 0.999698818f, 0.999924719f,
+	1.0f, 0.999924719f, 0.999698818f, 0.999322355f, 0.99879545f, 0.998118103f, 0.997290432f, 0.996312618f,
+	0.99518472f, 0.993906975f, 0.992479563f, 0.990902662f, 0.989176512f, 0.987301409f, 0.985277653f, 0.983105481f,
+	0.980785251f, 0.97831738f, 0.975702107f, 0.972939968f, 0.970031261f, 0.966976464f, 0.963776052f, 0.960430503f,
+	0.956940353f, 0.953306019f, 0.949528158f, 0.945607305f, 0.941544056f, 0.937339008f, 0.932992816f, 0.928506076f,
+	0.923879504f, 0.919113874f, 0.914209783f, 0.909168005f, 0.903989315f, 0.898674488f, 0.893224299f, 0.887639642f,
+	0.881921291f, 0.876070082f, 0.870086968f, 0.863972843f, 0.857728601f, 0.851355195f, 0.84485358f, 0.838224709f,
+	0.831469595f, 0.824589312f, 0.817584813f, 0.81045717f, 0.803207517f, 0.795836926f, 0.78834641f, 0.780737221f,
+	0.773010433f, 0.765167236f, 0.757208824f, 0.749136388f, 0.740951121f, 0.732654274f, 0.724247098f, 0.715730846f,
+	0.707106769f, 0.698376238f, 0.689540565f, 0.680601001f, 0.671558976f, 0.662415802f, 0.653172851f, 0.643831551f,
+	0.634393275f, 0.624859512f, 0.615231574f, 0.605511069f, 0.59569931f, 0.585797846f, 0.575808167f, 0.565731823f,
+	0.555570245f, 0.545324981f, 0.534997642f, 0.524589658f, 0.514102757f, 0.50353837f, 0.492898196f, 0.482183784f,
+	0.471396744f, 0.460538715f, 0.449611336f, 0.438616246f, 0.427555084f, 0.416429549f, 0.405241311f, 0.393992037f,
+	0.382683426f, 0.371317208f, 0.359895051f, 0.348418683f, 0.336889863f, 0.32531029f, 0.313681751f, 0.302005947f,
+	0.290284663f, 0.27851969f, 0.266712755f, 0.254865646f, 0.242980182f, 0.231058106f, 0.219101235f, 0.207111374f,
+	0.195090324f, 0.183039889f, 0.170961887f, 0.15885815f, 0.146730468f, 0.134580702f, 0.122410677f, 0.110222206f,
+	0.0980171412f, 0.0857973099f, 0.0735645667f, 0.061320737f, 0.0490676761f, 0.0368072242f, 0.024541229f, 0.0122715384f,
+	0.0f, -0.0122715384f, -0.024541229f, -0.0368072242f, -0.0490676761f, -0.061320737f, -0.0735645667f, -0.0857973099f,
+	-0.0980171412f, -0.110222206f, -0.122410677f, -0.134580702f, -0.146730468f, -0.15885815f, -0.170961887f, -0.183039889f,
+	-0.195090324f, -0.207111374f, -0.219101235f, -0.231058106f, -0.242980182f, -0.254865646f, -0.266712755f, -0.27851969f,
+	-0.290284663f, -0.302005947f, -0.313681751f, -0.32531029f, -0.336889863f, -0.348418683f, -0.359895051f, -0.371317208f,
+	-0.382683426f, -0.393992037f, -0.405241311f, -0.416429549f, -0.427555084f, -0.438616246f, -0.449611336f, -0.460538715f,
+	-0.471396744f, -0.482183784f, -0.492898196f, -0.50353837f, -0.514102757f, -0.524589658f, -0.534997642f, -0.545324981f,
+	-0.555570245f, -0.565731823f, -0.575808167f, -0.585797846f, -0.59569931f, -0.605511069f, -0.615231574f, -0.624859512f,
+	-0.634393275f, -0.643831551f, -0.653172851f, -0.662415802f, -0.671558976f, -0.680601001f, -0.689540565f, -0.698376238f,
+	-0.707106769f, -0.715730846f, -0.724247098f, -0.732654274f, -0.740951121f, -0.749136388f, -0.757208824f, -0.765167236f,
+	-0.773010433f, -0.780737221f, -0.78834641f, -0.795836926f, -0.803207517f, -0.81045717f, -0.817584813f, -0.824589312f,
+	-0.831469595f, -0.838224709f, -0.84485358f, -0.851355195f, -0.857728601f, -0.863972843f, -0.870086968f, -0.876070082f,
+	-0.881921291f, -0.887639642f, -0.893224299f, -0.898674488f, -0.903989315f, -0.909168005f, -0.914209783f, -0.919113874f,
+	-0.923879504f, -0.928506076f, -0.932992816f, -0.937339008f, -0.941544056f, -0.945607305f, -0.949528158f, -0.953306019f,
+	-0.956940353f, -0.960430503f, -0.963776052f, -0.966976464f, -0.970031261f, -0.972939968f, -0.975702107f, -0.97831738f,
+	-0.980785251f, -0.983105481f, -0.985277653f, -0.987301409f, -0.989176512f, -0.990902662f, -0.992479563f, -0.993906975f,
+	-0.99518472f, -0.996312618f, -0.997290432f, -0.998118103f, -0.99879545f, -0.999322355f, -0.999698818f, -0.999924719f,
+	-1.0f, -0.999924719f, -0.999698818f, -0.999322355f, -0.99879545f, -0.998118103f, -0.997290432f, -0.996312618f,
+	-0.99518472f, -0.993906975f, -0.992479563f, -0.990902662f, -0.989176512f, -0.987301409f, -0.985277653f, -0.983105481f,
+	-0.980785251f, -0.97831738f, -0.975702107f, -0.972939968f, -0.970031261f, -0.966976464f, -0.963776052f, -0.960430503f,
+	-0.956940353f, -0.953306019f, -0.949528158f, -0.945607305f, -0.941544056f, -0.937339008f, -0.932992816f, -0.928506076f,
+	-0.923879504f, -0.919113874f, -0.914209783f, -0.909168005f, -0.903989315f, -0.898674488f, -0.893224299f, -0.887639642f,
+	-0.881921291f, -0.876070082f, -0.870086968f, -0.863972843f, -0.857728601f, -0.851355195f, -0.84485358f, -0.838224709f,
+	-0.831469595f, -0.824589312f, -0.817584813f, -0.81045717f, -0.803207517f, -0.795836926f, -0.78834641f, -0.780737221f,
+	-0.773010433f, -0.765167236f, -0.757208824f, -0.749136388f, -0.740951121f, -0.732654274f, -0.724247098f, -0.715730846f,
+	-0.707106769f, -0.698376238f, -0.689540565f, -0.680601001f, -0.671558976f, -0.662415802f, -0.653172851f, -0.643831551f,
+	-0.634393275f, -0.624859512f, -0.615231574f, -0.605511069f, -0.59569931f, -0.585797846f, -0.575808167f, -0.565731823f,
+	-0.555570245f, -0.545324981f, -0.534997642f, -0.524589658f, -0.514102757f, -0.50353837f, -0.492898196f, -0.482183784f,
+	-0.471396744f, -0.460538715f, -0.449611336f, -0.438616246f, -0.427555084f, -0.416429549f, -0.405241311f, -0.393992037f,
+	-0.382683426f, -0.371317208f, -0.359895051f, -0.348418683f, -0.336889863f, -0.32531029f, -0.313681751f, -0.302005947f,
+	-0.290284663f, -0.27851969f, -0.266712755f, -0.254865646f, -0.242980182f, -0.231058106f, -0.219101235f, -0.207111374f,
+	-0.195090324f, -0.183039889f, -0.170961887f, -0.15885815f, -0.146730468f, -0.134580702f, -0.122410677f, -0.110222206f,
+	-0.0980171412f, -0.0857973099f, -0.0735645667f, -0.061320737f, -0.0490676761f, -0.0368072242f, -0.024541229f, -0.0122715384f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 10
+	0.0f, 0.00613588467f, 0.0122715384f, 0.0184067301f, 0.024541229f, 0.030674804f, 0.0368072242f, 0.0429382585f,
+	0.0490676761f, 0.0551952459f, 0.061320737f, 0.0674439222f, 0.0735645667f, 0.0796824396f, 0.0857973099f, 0.0919089541f,
+	0.0980171412f, 0.104121633f, 0.110222206f, 0.116318628f, 0.122410677f, 0.128498107f, 0.134580702f, 0.140658244f,
+	0.146730468f, 0.152797192f, 0.15885815f, 0.164913118f, 0.170961887f, 0.177004218f, 0.183039889f, 0.18906866f,
+	0.195090324f, 0.201104641f, 0.207111374f, 0.213110313f, 0.219101235f, 0.225083917f, 0.231058106f, 0.237023607f,
+	0.242980182f, 0.248927608f, 0.254865646f, 0.260794103f, 0.266712755f, 0.272621363f, 0.27851969f, 0.284407526f,
+	0.290284663f, 0.296150893f, 0.302005947f, 0.307849646f, 0.313681751f, 0.319502026f, 0.32531029f, 0.331106305f,
+	0.336889863f, 0.342660725f, 0.348418683f, 0.354163527f, 0.359895051f, 0.365612984f, 0.371317208f, 0.377007425f,
+	0.382683426f, 0.388345033f, 0.393992037f, 0.399624199f, 0.405241311f, 0.410843164f, 0.416429549f, 0.422000259f,
+	0.427555084f, 0.433093816f, 0.438616246f, 0.444122136f, 0.449611336f, 0.455083579f, 0.460538715f, 0.465976506f,
+	0.471396744f, 0.47679922f, 0.482183784f, 0.487550169f, 0.492898196f, 0.498227656f, 0.50353837f, 0.50883013f,
+	0.514102757f, 0.519356012f, 0.524589658f, 0.529803634f, 0.534997642f, 0.540171444f, 0.545324981f, 0.550457954f,
+	0.555570245f, 0.560661554f, 0.565731823f, 0.570780754f, 0.575808167f, 0.580813944f, 0.585797846f, 0.590759695f,
+	0.59569931f, 0.600616455f, 0.605511069f, 0.610382795f, 0.615231574f, 0.620057225f, 0.624859512f, 0.629638255f,
+	0.634393275f, 0.639124453f, 0.643831551f, 0.64851439f, 0.653172851f, 0.657806695f, 0.662415802f, 0.666999936f,
+	0.671558976f, 0.676092684f, 0.680601001f, 0.685083687f, 0.689540565f, 0.693971455f, 0.698376238f, 0.702754736f,
+	0.707106769f, 0.711432219f, 0.715730846f, 0.720002532f, 0.724247098f, 0.728464365f, 0.732654274f, 0.736816585f,
+	0.740951121f, 0.745057762f, 0.749136388f, 0.753186822f, 0.757208824f, 0.761202395f, 0.765167236f, 0.769103348f,
+	0.773010433f, 0.77688849f, 0.780737221f, 0.784556568f, 0.78834641f, 0.792106569f, 0.795836926f, 0.799537241f,
+	0.803207517f, 0.806847572f, 0.81045717f, 0.81403631f, 0.817584813f, 0.8211025f, 0.824589312f, 0.82804507f,
+	0.831469595f, 0.834862888f, 0.838224709f, 0.841554999f, 0.84485358f, 0.848120332f, 0.851355195f, 0.854557991f,
+	0.857728601f, 0.860866964f, 0.863972843f, 0.867046237f, 0.870086968f, 0.873094976f, 0.876070082f, 0.879012227f,
+	0.881921291f, 0.884797096f, 0.887639642f, 0.890448749f, 0.893224299f, 0.895966232f, 0.898674488f, 0.901348829f,
+	0.903989315f, 0.906595707f, 0.909168005f, 0.91170603f, 0.914209783f, 0.916679084f, 0.919113874f, 0.921514034f,
+	0.923879504f, 0.926210225f, 0.928506076f, 0.93076694f, 0.932992816f, 0.935183525f, 0.937339008f, 0.939459205f,
+	0.941544056f, 0.943593442f, 0.945607305f, 0.947585583f, 0.949528158f, 0.95143503f, 0.953306019f, 0.955141187f,
+	0.956940353f, 0.958703458f, 0.960430503f, 0.962121427f, 0.963776052f, 0.965394437f, 0.966976464f, 0.968522072f,
+	0.970031261f, 0.971503913f, 0.972939968f, 0.974339366f, 0.975702107f, 0.977028131f, 0.97831738f, 0.979569793f,
+	0.980785251f, 0.981963873f, 0.983105481f, 0.984210074f, 0.985277653f, 0.986308098f, 0.987301409f, 0.988257587f,
+	0.989176512f, 0.990058184f, 0.990902662f, 0.991709769f, 0.992479563f, 0.993211925f, 0.993906975f, 0.994564593f,
+	0.99518472f, 0.995767415f, 0.996312618f, 0.996820271f, 0.997290432f, 0.997723043f, 0.998118103f, 0.998475552f,
+	0.99879545f, 0.999077737f, 0.999322355f, 0.999529421f, 0.999698818f, 0.999830604f, 0.999924719f, 0.999981165f,
+	1.0f, 0.999981165f, 0.999924719f, 0.999830604f, 0.999698818f, 0.999529421f, 0.999322355f, 0.999077737f,
+	0.99879545f, 0.998475552f, 0.998118103f, 0.997723043f, 0.997290432f, 0.996820271f, 0.996312618f, 0.995767415f,
+	0.99518472f, 0.994564593f, 0.993906975f, 0.993211925f, 0.992479563f, 0.991709769f, 0.990902662f, 0.990058184f,
+	0.989176512f, 0.988257587f, 0.987301409f, 0.986308098f, 0.985277653f, 0.984210074f, 0.983105481f, 0.981963873f,
+	0.980785251f, 0.979569793f, 0.97831738f, 0.977028131f, 0.975702107f, 0.974339366f, 0.972939968f, 0.971503913f,
+	0.970031261f, 0.968522072f, 0.966976464f, 0.965394437f, 0.963776052f, 0.962121427f, 0.960430503f, 0.958703458f,
+	0.956940353f, 0.955141187f, 0.953306019f, 0.95143503f, 0.949528158f, 0.947585583f, 0.945607305f, 0.943593442f,
+	0.941544056f, 0.939459205f, 0.937339008f, 0.935183525f, 0.932992816f, 0.93076694f, 0.928506076f, 0.926210225f,
+	0.923879504f, 0.921514034f, 0.919113874f, 0.916679084f, 0.914209783f, 0.91170603f, 0.909168005f, 0.906595707f,
+	0.903989315f, 0.901348829f, 0.898674488f, 0.895966232f, 0.893224299f, 0.890448749f, 0.887639642f, 0.884797096f,
+	0.881921291f, 0.879012227f, 0.876070082f, 0.873094976f, 0.870086968f, 0.867046237f, 0.863972843f, 0.860866964f,
+	0.857728601f, 0.854557991f, 0.851355195f, 0.848120332f, 0.84485358f, 0.841554999f, 0.838224709f, 0.834862888f,
+	0.831469595f, 0.82804507f, 0.824589312f, 0.8211025f, 0.817584813f, 0.81403631f, 0.81045717f, 0.806847572f,
+	0.803207517f, 0.799537241f, 0.795836926f, 0.792106569f, 0.78834641f, 0.784556568f, 0.780737221f, 0.77688849f,
+	0.773010433f, 0.769103348f, 0.765167236f, 0.761202395f, 0.757208824f, 0.753186822f, 0.749136388f, 0.745057762f,
+	0.740951121f, 0.736816585f, 0.732654274f, 0.728464365f, 0.724247098f, 0.720002532f, 0.715730846f, 0.711432219f,
+	0.707106769f, 0.702754736f, 0.698376238f, 0.693971455f, 0.689540565f, 0.685083687f, 0.680601001f, 0.676092684f,
+	0.671558976f, 0.666999936f, 0.662415802f, 0.657806695f, 0.653172851f, 0.64851439f, 0.643831551f, 0.639124453f,
+	0.634393275f, 0.629638255f, 0.624859512f, 0.620057225f, 0.615231574f, 0.610382795f, 0.605511069f, 0.600616455f,
+	0.59569931f, 0.590759695f, 0.585797846f, 0.580813944f, 0.575808167f, 0.570780754f, 0.565731823f, 0.560661554f,
+	0.555570245f, 0.550457954f, 0.545324981f, 0.540171444f, 0.534997642f, 0.529803634f, 0.524589658f, 0.519356012f,
+	0.514102757f, 0.50883013f, 0.50353837f, 0.498227656f, 0.492898196f, 0.487550169f, 0.482183784f, 0.47679922f,
+	0.471396744f, 0.465976506f, 0.460538715f, 0.455083579f, 0.449611336f, 0.444122136f, 0.438616246f, 0.433093816f,
+	0.427555084f, 0.422000259f, 0.416429549f, 0.410843164f, 0.405241311f, 0.399624199f, 0.393992037f, 0.388345033f,
+	0.382683426f, 0.377007425f, 0.371317208f, 0.365612984f, 0.359895051f, 0.354163527f, 0.348418683f, 0.342660725f,
+	0.336889863f, 0.331106305f, 0.32531029f, 0.319502026f, 0.313681751f, 0.307849646f, 0.302005947f, 0.296150893f,
+	0.290284663f, 0.284407526f, 0.27851969f, 0.272621363f, 0.266712755f, 0.260794103f, 0.254865646f, 0.248927608f,
+	0.242980182f, 0.237023607f, 0.231058106f, 0.225083917f, 0.219101235f, 0.213110313f, 0.207111374f, 0.201104641f,
+	0.195090324f, 0.18906866f, 0.183039889f, 0.177004218f, 0.170961887f, 0.164913118f, 0.15885815f, 0.152797192f,
+	0.146730468f, 0.140658244f, 0.134580702f, 0.128498107f, 0.122410677f, 0.116318628f, 0.110222206f, 0.104121633f,
+	0.0980171412f, 0.0919089541f, 0.0857973099f, 0.0796824396f, 0.0735645667f, 0.0674439222f, 0.061320737f, 0.0551952459f,
+	0.0490676761f, 0.0429382585f, 0.0368072242f, 0.030674804f, 0.024541229f, 0.0184067301f, 0.0122715384f, 0.00613588467f,
+	0.0f, -0.00613588467f, -0.0122715384f, -0.0184067301f, -0.024541229f, -0.030674804f, -0.0368072242f, -0.0429382585f,
+	-0.0490676761f, -0.0551952459f, -0.061320737f, -0.0674439222f, -0.0735645667f, -0.0796824396f, -0.0857973099f, -0.0919089541f,
+	-0.0980171412f, -0.104121633f, -0.110222206f, -0.116318628f, -0.122410677f, -0.128498107f, -0.134580702f, -0.140658244f,
+	-0.146730468f, -0.152797192f, -0.15885815f, -0.164913118f, -0.170961887f, -0.177004218f, -0.183039889f, -0.18906866f,
+	-0.195090324f, -0.201104641f, -0.207111374f, -0.213110313f, -0.219101235f, -0.225083917f, -0.231058106f, -0.237023607f,
+	-0.242980182f, -0.248927608f, -0.254865646f, -0.260794103f, -0.266712755f, -0.272621363f, -0.27851969f, -0.284407526f,
+	-0.290284663f, -0.296150893f, -0.302005947f, -0.307849646f, -0.313681751f, -0.319502026f, -0.32531029f, -0.331106305f,
+	-0.336889863f, -0.342660725f, -0.348418683f, -0.354163527f, -0.359895051f, -0.365612984f, -0.371317208f, -0.377007425f,
+	-0.382683426f, -0.388345033f, -0.393992037f, -0.399624199f, -0.405241311f, -0.410843164f, -0.416429549f, -0.422000259f,
+	-0.427555084f, -0.433093816f, -0.438616246f, -0.444122136f, -0.449611336f, -0.455083579f, -0.460538715f, -0.465976506f,
+	-0.471396744f, -0.47679922f, -0.482183784f, -0.487550169f, -0.492898196f, -0.498227656f, -0.50353837f, -0.50883013f,
+	-0.514102757f, -0.519356012f, -0.524589658f, -0.529803634f, -0.534997642f, -0.540171444f, -0.545324981f, -0.550457954f,
+	-0.555570245f, -0.560661554f, -0.565731823f, -0.570780754f, -0.575808167f, -0.580813944f, -0.585797846f, -0.590759695f,
+	-0.59569931f, -0.600616455f, -0.605511069f, -0.610382795f, -0.615231574f, -0.620057225f, -0.624859512f, -0.629638255f,
+	-0.634393275f, -0.639124453f, -0.643831551f, -0.64851439f, -0.653172851f, -0.657806695f, -0.662415802f, -0.666999936f,
+	-0.671558976f, -0.676092684f, -0.680601001f, -0.685083687f, -0.689540565f, -0.693971455f, -0.698376238f, -0.702754736f,
+	-0.707106769f, -0.711432219f, -0.715730846f, -0.720002532f, -0.724247098f, -0.728464365f, -0.732654274f, -0.736816585f,
+	-0.740951121f, -0.745057762f, -0.749136388f, -0.753186822f, -0.757208824f, -0.761202395f, -0.765167236f, -0.769103348f,
+	-0.773010433f, -0.77688849f, -0.780737221f, -0.784556568f, -0.78834641f, -0.792106569f, -0.795836926f, -0.799537241f,
+	-0.803207517f, -0.806847572f, -0.81045717f, -0.81403631f, -0.817584813f, -0.8211025f, -0.824589312f, -0.82804507f,
+	-0.831469595f, -0.834862888f, -0.838224709f, -0.841554999f, -0.84485358f, -0.848120332f, -0.851355195f, -0.854557991f,
+	-0.857728601f, -0.860866964f, -0.863972843f, -0.867046237f, -0.870086968f, -0.873094976f, -0.876070082f, -0.879012227f,
+	-0.881921291f, -0.884797096f, -0.887639642f, -0.890448749f, -0.893224299f, -0.895966232f, -0.898674488f, -0.901348829f,
+	-0.903989315f, -0.906595707f, -0.909168005f, -0.91170603f, -0.914209783f, -0.916679084f, -0.919113874f, -0.921514034f,
+	-0.923879504f, -0.926210225f, -0.928506076f, -0.93076694f, -0.932992816f, -0.935183525f, -0.937339008f, -0.939459205f,
+	-0.941544056f, -0.943593442f, -0.945607305f, -0.947585583f, -0.949528158f, -0.95143503f, -0.953306019f, -0.955141187f,
+	-0.956940353f, -0.958703458f, -0.960430503f, -0.962121427f, -0.963776052f, -0.965394437f, -0.966976464f, -0.968522072f,
+	-0.970031261f, -0.971503913f, -0.972939968f, -0.974339366f, -0.975702107f, -0.977028131f, -0.97831738f, -0.979569793f,
+	-0.980785251f, -0.981963873f, -0.983105481f, -0.984210074f, -0.985277653f, -0.986308098f, -0.987301409f, -0.988257587f,
+	-0.989176512f, -0.990058184f, -0.990902662f, -0.991709769f, -0.992479563f, -0.993211925f, -0.993906975f, -0.994564593f,
+	-0.99518472f, -0.995767415f, -0.996312618f, -0.996820271f, -0.997290432f, -0.997723043f, -0.998118103f, -0.998475552f,
+	-0.99879545f, -0.999077737f, -0.999322355f, -0.999529421f, -0.999698818f, -0.999830604f, -0.999924719f, -0.999981165f,
+	-1.0f, -0.999981165f, -0.999924719f, -0.999830604f, -0.999698818f, -0.999529421f, -0.999322355f, -0.999077737f,
+	-0.99879545f, -0.998475552f, -0.998118103f, -0.997723043f, -0.997290432f, -0.996820271f, -0.996312618f, -0.995767415f,
+	-0.99518472f, -0.994564593f, -0.993906975f, -0.993211925f, -0.992479563f, -0.991709769f, -0.990902662f, -0.990058184f,
+	-0.989176512f, -0.988257587f, -0.987301409f, -0.986308098f, -0.985277653f, -0.984210074f, -0.983105481f, -0.981963873f,
+	-0.980785251f, -0.979569793f, -0.97831738f, -0.977028131f, -0.975702107f, -0.974339366f, -0.972939968f, -0.971503913f,
+	-0.970031261f, -0.968522072f, -0.966976464f, -0.965394437f, -0.963776052f, -0.962121427f, -0.960430503f, -0.958703458f,
+	-0.956940353f, -0.955141187f, -0.953306019f, -0.95143503f, -0.949528158f, -0.947585583f, -0.945607305f, -0.943593442f,
+	-0.941544056f, -0.939459205f, -0.937339008f, -0.935183525f, -0.932992816f, -0.93076694f, -0.928506076f, -0.926210225f,
+	-0.923879504f, -0.921514034f, -0.919113874f, -0.916679084f, -0.914209783f, -0.91170603f, -0.909168005f, -0.906595707f,
+	-0.903989315f, -0.901348829f, -0.898674488f, -0.895966232f, -0.893224299f, -0.890448749f, -0.887639642f, -0.884797096f,
+	-0.881921291f, -0.879012227f, -0.876070082f, -0.873094976f, -0.870086968f, -0.867046237f, -0.863972843f, -0.860866964f,
+	-0.857728601f, -0.854557991f, -0.851355195f, -0.848120332f, -0.84485358f, -0.841554999f, -0.838224709f, -0.834862888f,
+	-0.831469595f, -0.82804507f, -0.824589312f, -0.8211025f, -0.817584813f, -0.81403631f, -0.81045717f, -0.806847572f,
+	-0.803207517f, -0.799537241f, -0.795836926f, -0.792106569f, -0.78834641f, -0.784556568f, -0.780737221f, -0.77688849f,
+	-0.773010433f, -0.769103348f, -0.765167236f, -0.761202395f, -0.757208824f, -0.753186822f, -0.749136388f, -0.745057762f,
+	-0.740951121f, -0.736816585f, -0.732654274f, -0.728464365f, -0.724247098f, -0.720002532f, -0.715730846f, -0.711432219f,
+	-0.707106769f, -0.702754736f, -0.698376238f, -0.693971455f, -0.689540565f, -0.685083687f, -0.680601001f, -0.676092684f,
+	-0.671558976f, -0.666999936f, -0.662415802f, -0.657806695f, -0.653172851f, -0.64851439f, -0.643831551f, -0.639124453f,
+	-0.634393275f, -0.629638255f, -0.624859512f, -0.620057225f, -0.615231574f, -0.610382795f, -0.605511069f, -0.600616455f,
+	-0.59569931f, -0.590759695f, -0.585797846f, -0.580813944f, -0.575808167f, -0.570780754f, -0.565731823f, -0.560661554f,
+	-0.555570245f, -0.550457954f, -0.545324981f, -0.540171444f, -0.534997642f, -0.529803634f, -0.524589658f, -0.519356012f,
+	-0.514102757f, -0.50883013f, -0.50353837f, -0.498227656f, -0.492898196f, -0.487550169f, -0.482183784f, -0.47679922f,
+	-0.471396744f, -0.465976506f, -0.460538715f, -0.455083579f, -0.449611336f, -0.444122136f, -0.438616246f, -0.433093816f,
+	-0.427555084f, -0.422000259f, -0.416429549f, -0.410843164f, -0.405241311f, -0.399624199f, -0.393992037f, -0.388345033f,
+	-0.382683426f, -0.377007425f, -0.371317208f, -0.365612984f, -0.359895051f, -0.354163527f, -0.348418683f, -0.342660725f,
+	-0.336889863f, -0.331106305f, -0.32531029f, -0.319502026f, -0.313681751f, -0.307849646f, -0.302005947f, -0.296150893f,
+	-0.290284663f, -0.284407526f, -0.27851969f, -0.272621363f, -0.266712755f, -0.260794103f, -0.254865646f, -0.248927608f,
+	-0.242980182f, -0.237023607f, -0.231058106f, -0.225083917f, -0.219101235f, -0.213110313f, -0.207111374f, -0.201104641f,
+	-0.195090324f, -0.18906866f, -0.183039889f, -0.177004218f, -0.170961887f, -0.164913118f, -0.15885815f, -0.152797192f,
+	-0.146730468f, -0.140658244f, -0.134580702f, -0.128498107f, -0.122410677f, -0.116318628f, -0.110222206f, -0.104121633f,
+	-0.0980171412f, -0.0919089541f, -0.0857973099f, -0.0796824396f, -0.0735645667f, -0.0674439222f, -0.061320737f, -0.0551952459f,
+	-0.0490676761f, -0.0429382585f, -0.0368072242f, -0.030674804f, -0.024541229f, -0.0184067301f, -0.0122715384f, -0.00613588467f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 11
+	0.0f, 0.00306795677f, 0.00613588467f, 0.00920375437f, 0.0122715384f, 0.015339206f, 0.0184067301f, 0.0214740802f,
+	0.024541229f, 0.027608145f, 0.030674804f, 0.0337411724f, 0.0368072242f, 0.0398729257f, 0.0429382585f, 0.0460031815f,
+	0.0490676761f, 0.052131705f, 0.0551952459f, 0.0582582653f, 0.061320737f, 0.0643826276f, 0.0674439222f, 0.070504576f,
+	0.0735645667f, 0.0766238645f, 0.0796824396f, 0.0827402622f, 0.0857973099f, 0.0888535529f, 0.0919089541f, 0.0949634984f,
+	0.0980171412f, 0.10106986f, 0.104121633f, 0.107172422f, 0.110222206f, 0.113270953f, 0.116318628f, 0.119365215f,
+	0.122410677f, 0.125454977f, 0.128498107f, 0.13154003f, 0.134580702f, 0.137620121f, 0.140658244f, 0.143695027f,
+	0.146730468f, 0.149764538f, 0.152797192f, 0.155828401f, 0.15885815f, 0.161886394f, 0.164913118f, 0.167938292f,
+	0.170961887f, 0.173983872f, 0.177004218f, 0.180022895f, 0.183039889f, 0.186055154f, 0.18906866f, 0.192080393f,
+	0.195090324f, 0.198098406f, 0.201104641f, 0.204108968f, 0.207111374f, 0.210111842f, 0.213110313f, 0.216106802f,
+	0.219101235f, 0.222093627f, 0.225083917f, 0.228072077f, 0.231058106f, 0.234041959f, 0.237023607f, 0.24000302f,
+	0.242980182f, 0.24595505f, 0.248927608f, 0.251897812f, 0.254865646f, 0.257831097f, 0.260794103f, 0.263754666f,
+	0.266712755f, 0.269668311f, 0.272621363f, 0.275571823f, 0.27851969f, 0.281464934f, 0.284407526f, 0.287347466f,
+	0.290284663f, 0.293219149f, 0.296150893f, 0.299079835f, 0.302005947f, 0.304929227f, 0.307849646f, 0.310767144f,
+	0.313681751f, 0.316593379f, 0.319502026f, 0.322407693f, 0.32531029f, 0.328209847f, 0.331106305f, 0.333999664f,
+	0.336889863f, 0.339776874f, 0.342660725f, 0.345541328f, 0.348418683f, 0.351292759f, 0.354163527f, 0.357030958f,
+	0.359895051f, 0.362755716f, 0.365612984f, 0.368466824f, 0.371317208f, 0.374164075f, 0.377007425f, 0.379847199f,
+	0.382683426f, 0.385516047f, 0.388345033f, 0.391170382f, 0.393992037f, 0.396809995f, 0.399624199f, 0.402434647f,
+	0.405241311f, 0.408044159f, 0.410843164f, 0.413638324f, 0.416429549f, 0.419216901f, 0.422000259f, 0.424779683f,
+	0.427555084f, 0.430326492f, 0.433093816f, 0.435857087f, 0.438616246f, 0.441371262f, 0.444122136f, 0.446868837f,
+	0.449611336f, 0.452349573f, 0.455083579f, 0.457813293f, 0.460538715f, 0.463259786f, 0.465976506f, 0.468688816f,
+	0.471396744f, 0.474100202f, 0.47679922f, 0.479493767f, 0.482183784f, 0.484869242f, 0.487550169f, 0.490226477f,
+	0.492898196f, 0.495565265f, 0.498227656f, 0.500885367f, 0.50353837f, 0.506186664f, 0.50883013f, 0.511468828f,
+	0.514102757f, 0.516731799f, 0.519356012f, 0.521975279f, 0.524589658f, 0.527199149f, 0.529803634f, 0.532403111f,
+	0.534997642f, 0.537587047f, 0.540171444f, 0.542750776f, 0.545324981f, 0.547894061f, 0.550457954f, 0.553016722f,
+	0.555570245f, 0.558118522f, 0.560661554f, 0.563199341f, 0.565731823f, 0.568258941f, 0.570780754f, 0.573297143f,
+	0.575808167f, 0.578313768f, 0.580813944f, 0.583308637f, 0.585797846f, 0.588281572f, 0.590759695f, 0.593232274f,
+	0.59569931f, 0.598160684f, 0.600616455f, 0.603066623f, 0.605511069f, 0.607949793f, 0.610382795f, 0.612810075f,
+	0.615231574f, 0.61764729f, 0.620057225f, 0.622461259f, 0.624859512f, 0.627251804f, 0.629638255f, 0.632018745f,
+	0.634393275f, 0.636761844f, 0.639124453f, 0.641481042f, 0.643831551f, 0.64617604f, 0.64851439f, 0.65084666f,
+	0.653172851f, 0.655492842f, 0.657806695f, 0.660114348f, 0.662415802f, 0.664710999f, 0.666999936f, 0.669282615f,
+	0.671558976f, 0.673829019f, 0.676092684f, 0.678350031f, 0.680601001f, 0.682845533f, 0.685083687f, 0.687315345f,
+	0.689540565f, 0.691759229f, 0.693971455f, 0.696177125f, 0.698376238f, 0.700568795f, 0.702754736f, 0.704934061f,
+	0.707106769f, 0.709272802f, 0.711432219f, 0.71358484f, 0.715730846f, 0.717870057f, 0.720002532f, 0.722128212f,
+	0.724247098f, 0.726359129f, 0.728464365f, 0.730562747f, 0.732654274f, 0.734738886f, 0.736816585f, 0.73888731f,
+	0.740951121f, 0.743007958f, 0.745057762f, 0.747100592f, 0.749136388f, 0.751165152f, 0.753186822f, 0.755201399f,
+	0.757208824f, 0.759209216f, 0.761202395f, 0.763188422f, 0.765167236f, 0.767138898f, 0.769103348f, 0.771060526f,
+	0.773010433f, 0.774953127f, 0.77688849f, 0.778816521f, 0.780737221f, 0.78265059f, 0.784556568f, 0.786455214f,
+	0.78834641f, 0.790230215f, 0.792106569f, 0.793975472f, 0.795836926f, 0.797690868f, 0.799537241f, 0.801376164f,
+	0.803207517f, 0.805031359f, 0.806847572f, 0.808656156f, 0.81045717f, 0.812250614f, 0.81403631f, 0.815814435f,
+	0.817584813f, 0.819347501f, 0.8211025f, 0.82284981f, 0.824589312f, 0.826321065f, 0.82804507f, 0.829761207f,
+	0.831469595f, 0.833170176f, 0.834862888f, 0.836547732f, 0.838224709f, 0.839893818f, 0.841554999f, 0.843208253f,
+	0.84485358f, 0.84649092f, 0.848120332f, 0.849741757f, 0.851355195f, 0.852960587f, 0.854557991f, 0.856147349f,
+	0.857728601f, 0.859301805f, 0.860866964f, 0.862423956f, 0.863972843f, 0.865513623f, 0.867046237f, 0.868570685f,
+	0.870086968f, 0.871595085f, 0.873094976f, 0.874586642f, 0.876070082f, 0.877545297f, 0.879012227f, 0.880470872f,
+	0.881921291f, 0.883363366f, 0.884797096f, 0.886222541f, 0.887639642f, 0.889048338f, 0.890448749f, 0.891840696f,
+	0.893224299f, 0.894599497f, 0.895966232f, 0.897324562f, 0.898674488f, 0.900015891f, 0.901348829f, 0.902673304f,
+	0.903989315f, 0.905296743f, 0.906595707f, 0.907886088f, 0.909168005f, 0.910441279f, 0.91170603f, 0.912962198f,
+	0.914209783f, 0.915448725f, 0.916679084f, 0.917900801f, 0.919113874f, 0.920318305f, 0.921514034f, 0.92270112f,
+	0.923879504f, 0.925049245f, 0.926210225f, 0.927362502f, 0.928506076f, 0.929640889f, 0.93076694f, 0.931884289f,
+	0.932992816f, 0.934092522f, 0.935183525f, 0.936265647f, 0.937339008f, 0.938403547f, 0.939459205f, 0.940506041f,
+	0.941544056f, 0.94257319f, 0.943593442f, 0.944604814f, 0.945607305f, 0.946600914f, 0.947585583f, 0.94856137f,
+	0.949528158f, 0.950486064f, 0.95143503f, 0.952374995f, 0.953306019f, 0.954228103f, 0.955141187f, 0.95604527f,
+	0.956940353f, 0.957826436f, 0.958703458f, 0.95957154f, 0.960430503f, 0.961280465f, 0.962121427f, 0.962953269f,
+	0.963776052f, 0.964589775f, 0.965394437f, 0.966189981f, 0.966976464f, 0.967753828f, 0.968522072f, 0.969281256f,
+	0.970031261f, 0.970772147f, 0.971503913f, 0.972226501f, 0.972939968f, 0.973644257f, 0.974339366f, 0.975025356f,
+	0.975702107f, 0.976369739f, 0.977028131f, 0.977677345f, 0.97831738f, 0.978948176f, 0.979569793f, 0.980182111f,
+	0.980785251f, 0.981379211f, 0.981963873f, 0.982539296f, 0.983105481f, 0.983662426f, 0.984210074f, 0.984748483f,
+	0.985277653f, 0.985797524f, 0.986308098f, 0.986809373f, 0.987301409f, 0.987784147f, 0.988257587f, 0.988721669f,
+	0.989176512f, 0.989621997f, 0.990058184f, 0.990485072f, 0.990902662f, 0.991310835f, 0.991709769f, 0.992099285f,
+	0.992479563f, 0.992850423f, 0.993211925f, 0.993564129f, 0.993906975f, 0.994240463f, 0.994564593f, 0.994879305f,
+	0.99518472f, 0.995480776f, 0.995767415f, 0.996044695f, 0.996312618f, 0.996571124f, 0.996820271f, 0.997060061f,
+	0.997290432f, 0.997511446f, 0.997723043f, 0.997925282f, 0.998118103f, 0.998301566f, 0.998475552f, 0.998640239f,
+	0.99879545f, 0.998941302f, 0.999077737f, 0.999204755f, 0.999322355f, 0.999430597f, 0.999529421f, 0.999618828f,
+	0.999698818f, 0.99976939f, 0.999830604f, 0.99988234f, 0.999924719f, 0.999957621f, 0.999981165f, 0.999995291f,
+	1.0f, 0.999995291f, 0.999981165f, 0.999957621f, 0.999924719f, 0.99988234f, 0.999830604f, 0.99976939f,
+	0.999698818f, 0.999618828f, 0.999529421f, 0.999430597f, 0.999322355f, 0.999204755f, 0.999077737f, 0.998941302f,
+	0.99879545f, 0.998640239f, 0.998475552f, 0.998301566f, 0.998118103f, 0.997925282f, 0.997723043f, 0.997511446f,
+	0.997290432f, 0.997060061f, 0.996820271f, 0.996571124f, 0.996312618f, 0.996044695f, 0.995767415f, 0.995480776f,
+	0.99518472f, 0.994879305f, 0.994564593f, 0.994240463f, 0.993906975f, 0.993564129f, 0.993211925f, 0.992850423f,
+	0.992479563f, 0.992099285f, 0.991709769f, 0.991310835f, 0.990902662f, 0.990485072f, 0.990058184f, 0.989621997f,
+	0.989176512f, 0.988721669f, 0.988257587f, 0.987784147f, 0.987301409f, 0.986809373f, 0.986308098f, 0.985797524f,
+	0.985277653f, 0.984748483f, 0.984210074f, 0.983662426f, 0.983105481f, 0.982539296f, 0.981963873f, 0.981379211f,
+	0.980785251f, 0.980182111f, 0.979569793f, 0.978948176f, 0.97831738f, 0.977677345f, 0.977028131f, 0.976369739f,
+	0.975702107f, 0.975025356f, 0.974339366f, 0.973644257f, 0.972939968f, 0.972226501f, 0.971503913f, 0.970772147f,
+	0.970031261f, 0.969281256f, 0.968522072f, 0.967753828f, 0.966976464f, 0.966189981f, 0.965394437f, 0.964589775f,
+	0.963776052f, 0.962953269f, 0.962121427f, 0.961280465f, 0.960430503f, 0.95957154f, 0.958703458f, 0.957826436f,
+	0.956940353f, 0.95604527f, 0.955141187f, 0.954228103f, 0.953306019f, 0.952374995f, 0.95143503f, 0.950486064f,
+	0.949528158f, 0.94856137f, 0.947585583f, 0.946600914f, 0.945607305f, 0.944604814f, 0.943593442f, 0.94257319f,
+	0.941544056f, 0.940506041f, 0.939459205f, 0.938403547f, 0.937339008f, 0.936265647f, 0.935183525f, 0.934092522f,
+	0.932992816f, 0.931884289f, 0.93076694f, 0.929640889f, 0.928506076f, 0.927362502f, 0.926210225f, 0.925049245f,
+	0.923879504f, 0.92270112f, 0.921514034f, 0.920318305f, 0.919113874f, 0.917900801f, 0.916679084f, 0.915448725f,
+	0.914209783f, 0.912962198f, 0.91170603f, 0.910441279f, 0.909168005f, 0.907886088f, 0.906595707f, 0.905296743f,
+	0.903989315f, 0.902673304f, 0.901348829f, 0.900015891f, 0.898674488f, 0.897324562f, 0.895966232f, 0.894599497f,
+	0.893224299f, 0.891840696f, 0.890448749f, 0.889048338f, 0.887639642f, 0.886222541f, 0.884797096f, 0.883363366f,
+	0.881921291f, 0.880470872f, 0.879012227f, 0.877545297f, 0.876070082f, 0.874586642f, 0.873094976f, 0.871595085f,
+	0.870086968f, 0.868570685f, 0.867046237f, 0.865513623f, 0.863972843f, 0.862423956f, 0.860866964f, 0.859301805f,
+	0.857728601f, 0.856147349f, 0.854557991f, 0.852960587f, 0.851355195f, 0.849741757f, 0.848120332f, 0.84649092f,
+	0.84485358f, 0.843208253f, 0.841554999f, 0.839893818f, 0.838224709f, 0.836547732f, 0.834862888f, 0.833170176f,
+	0.831469595f, 0.829761207f, 0.82804507f, 0.826321065f, 0.824589312f, 0.82284981f, 0.8211025f, 0.819347501f,
+	0.817584813f, 0.815814435f, 0.81403631f, 0.812250614f, 0.81045717f, 0.808656156f, 0.806847572f, 0.805031359f,
+	0.803207517f, 0.801376164f, 0.799537241f, 0.797690868f, 0.795836926f, 0.793975472f, 0.792106569f, 0.790230215f,
+	0.78834641f, 0.786455214f, 0.784556568f, 0.78265059f, 0.780737221f, 0.778816521f, 0.77688849f, 0.774953127f,
+	0.773010433f, 0.771060526f, 0.769103348f, 0.767138898f, 0.765167236f, 0.763188422f, 0.761202395f, 0.759209216f,
+	0.757208824f, 0.755201399f, 0.753186822f, 0.751165152f, 0.749136388f, 0.747100592f, 0.745057762f, 0.743007958f,
+	0.740951121f, 0.73888731f, 0.736816585f, 0.734738886f, 0.732654274f, 0.730562747f, 0.728464365f, 0.726359129f,
+	0.724247098f, 0.722128212f, 0.720002532f, 0.717870057f, 0.715730846f, 0.71358484f, 0.711432219f, 0.709272802f,
+	0.707106769f, 0.704934061f, 0.702754736f, 0.700568795f, 0.698376238f, 0.696177125f, 0.693971455f, 0.691759229f,
+	0.689540565f, 0.687315345f, 0.685083687f, 0.682845533f, 0.680601001f, 0.678350031f, 0.676092684f, 0.673829019f,
+	0.671558976f, 0.669282615f, 0.666999936f, 0.664710999f, 0.662415802f, 0.660114348f, 0.657806695f, 0.655492842f,
+	0.653172851f, 0.65084666f, 0.64851439f, 0.64617604f, 0.643831551f, 0.641481042f, 0.639124453f, 0.636761844f,
+	0.634393275f, 0.632018745f, 0.629638255f, 0.627251804f, 0.624859512f, 0.622461259f, 0.620057225f, 0.61764729f,
+	0.615231574f, 0.612810075f, 0.610382795f, 0.607949793f, 0.605511069f, 0.603066623f, 0.600616455f, 0.598160684f,
+	0.59569931f, 0.593232274f, 0.590759695f, 0.588281572f, 0.585797846f, 0.583308637f, 0.580813944f, 0.578313768f,
+	0.575808167f, 0.573297143f, 0.570780754f, 0.568258941f, 0.565731823f, 0.563199341f, 0.560661554f, 0.558118522f,
+	0.555570245f, 0.553016722f, 0.550457954f, 0.547894061f, 0.545324981f, 0.542750776f, 0.540171444f, 0.537587047f,
+	0.534997642f, 0.532403111f, 0.529803634f, 0.527199149f, 0.524589658f, 0.521975279f, 0.519356012f, 0.516731799f,
+	0.514102757f, 0.511468828f, 0.50883013f, 0.506186664f, 0.50353837f, 0.500885367f, 0.498227656f, 0.495565265f,
+	0.492898196f, 0.490226477f, 0.487550169f, 0.484869242f, 0.482183784f, 0.479493767f, 0.47679922f, 0.474100202f,
+	0.471396744f, 0.468688816f, 0.465976506f, 0.463259786f, 0.460538715f, 0.457813293f, 0.455083579f, 0.452349573f,
+	0.449611336f, 0.446868837f, 0.444122136f, 0.441371262f, 0.438616246f, 0.435857087f, 0.433093816f, 0.430326492f,
+	0.427555084f, 0.424779683f, 0.422000259f, 0.419216901f, 0.416429549f, 0.413638324f, 0.410843164f, 0.408044159f,
+	0.405241311f, 0.402434647f, 0.399624199f, 0.396809995f, 0.393992037f, 0.391170382f, 0.388345033f, 0.385516047f,
+	0.382683426f, 0.379847199f, 0.377007425f, 0.374164075f, 0.371317208f, 0.368466824f, 0.365612984f, 0.362755716f,
+	0.359895051f, 0.357030958f, 0.354163527f, 0.351292759f, 0.348418683f, 0.345541328f, 0.342660725f, 0.339776874f,
+	0.336889863f, 0.333999664f, 0.331106305f, 0.328209847f, 0.32531029f, 0.322407693f, 0.319502026f, 0.316593379f,
+	0.313681751f, 0.310767144f, 0.307849646f, 0.304929227f, 0.302005947f, 0.299079835f, 0.296150893f, 0.293219149f,
+	0.290284663f, 0.287347466f, 0.284407526f, 0.281464934f, 0.27851969f, 0.275571823f, 0.272621363f, 0.269668311f,
+	0.266712755f, 0.263754666f, 0.260794103f, 0.257831097f, 0.254865646f, 0.251897812f, 0.248927608f, 0.24595505f,
+	0.242980182f, 0.24000302f, 0.237023607f, 0.234041959f, 0.231058106f, 0.228072077f, 0.225083917f, 0.222093627f,
+	0.219101235f, 0.216106802f, 0.213110313f, 0.210111842f, 0.207111374f, 0.204108968f, 0.201104641f, 0.198098406f,
+	0.195090324f, 0.192080393f, 0.18906866f, 0.186055154f, 0.183039889f, 0.180022895f, 0.177004218f, 0.173983872f,
+	0.170961887f, 0.167938292f, 0.164913118f, 0.161886394f, 0.15885815f, 0.155828401f, 0.152797192f, 0.149764538f,
+	0.146730468f, 0.143695027f, 0.140658244f, 0.137620121f, 0.134580702f, 0.13154003f, 0.128498107f, 0.125454977f,
+	0.122410677f, 0.119365215f, 0.116318628f, 0.113270953f, 0.110222206f, 0.107172422f, 0.104121633f, 0.10106986f,
+	0.0980171412f, 0.0949634984f, 0.0919089541f, 0.0888535529f, 0.0857973099f, 0.0827402622f, 0.0796824396f, 0.0766238645f,
+	0.0735645667f, 0.070504576f, 0.0674439222f, 0.0643826276f, 0.061320737f, 0.0582582653f, 0.0551952459f, 0.052131705f,
+	0.0490676761f, 0.0460031815f, 0.0429382585f, 0.0398729257f, 0.0368072242f, 0.0337411724f, 0.030674804f, 0.027608145f,
+	0.024541229f, 0.0214740802f, 0.0184067301f, 0.015339206f, 0.0122715384f, 0.00920375437f, 0.00613588467f, 0.00306795677f,
+	0.0f, -0.00306795677f, -0.00613588467f, -0.00920375437f, -0.0122715384f, -0.015339206f, -0.0184067301f, -0.0214740802f,
+	-0.024541229f, -0.027608145f, -0.030674804f, -0.0337411724f, -0.0368072242f, -0.0398729257f, -0.0429382585f, -0.0460031815f,
+	-0.0490676761f, -0.052131705f, -0.0551952459f, -0.0582582653f, -0.061320737f, -0.0643826276f, -0.0674439222f, -0.070504576f,
+	-0.0735645667f, -0.0766238645f, -0.0796824396f, -0.0827402622f, -0.0857973099f, -0.0888535529f, -0.0919089541f, -0.0949634984f,
+	-0.0980171412f, -0.10106986f, -0.104121633f, -0.107172422f, -0.110222206f, -0.113270953f, -0.116318628f, -0.119365215f,
+	-0.122410677f, -0.125454977f, -0.128498107f, -0.13154003f, -0.134580702f, -0.137620121f, -0.140658244f, -0.143695027f,
+	-0.146730468f, -0.149764538f, -0.152797192f, -0.155828401f, -0.15885815f, -0.161886394f, -0.164913118f, -0.167938292f,
+	-0.170961887f, -0.173983872f, -0.177004218f, -0.180022895f, -0.183039889f, -0.186055154f, -0.18906866f, -0.192080393f,
+	-0.195090324f, -0.198098406f, -0.201104641f, -0.204108968f, -0.207111374f, -0.210111842f, -0.213110313f, -0.216106802f,
+	-0.219101235f, -0.222093627f, -0.225083917f, -0.228072077f, -0.231058106f, -0.234041959f, -0.237023607f, -0.24000302f,
+	-0.242980182f, -0.24595505f, -0.248927608f, -0.251897812f, -0.254865646f, -0.257831097f, -0.260794103f, -0.263754666f,
+	-0.266712755f, -0.269668311f, -0.272621363f, -0.275571823f, -0.27851969f, -0.281464934f, -0.284407526f, -0.287347466f,
+	-0.290284663f, -0.293219149f, -0.296150893f, -0.299079835f, -0.302005947f, -0.304929227f, -0.307849646f, -0.310767144f,
+	-0.313681751f, -0.316593379f, -0.319502026f, -0.322407693f, -0.32531029f, -0.328209847f, -0.331106305f, -0.333999664f,
+	-0.336889863f, -0.339776874f, -0.342660725f, -0.345541328f, -0.348418683f, -0.351292759f, -0.354163527f, -0.357030958f,
+	-0.359895051f, -0.362755716f, -0.365612984f, -0.368466824f, -0.371317208f, -0.374164075f, -0.377007425f, -0.379847199f,
+	-0.382683426f, -0.385516047f, -0.388345033f, -0.391170382f, -0.393992037f, -0.396809995f, -0.399624199f, -0.402434647f,
+	-0.405241311f, -0.408044159f, -0.410843164f, -0.413638324f, -0.416429549f, -0.419216901f, -0.422000259f, -0.424779683f,
+	-0.427555084f, -0.430326492f, -0.433093816f, -0.435857087f, -0.438616246f, -0.441371262f, -0.444122136f, -0.446868837f,
+	-0.449611336f, -0.452349573f, -0.455083579f, -0.457813293f, -0.460538715f, -0.463259786f, -0.465976506f, -0.468688816f,
+	-0.471396744f, -0.474100202f, -0.47679922f, -0.479493767f, -0.482183784f, -0.484869242f, -0.487550169f, -0.490226477f,
+	-0.492898196f, -0.495565265f, -0.498227656f, -0.500885367f, -0.50353837f, -0.506186664f, -0.50883013f, -0.511468828f,
+	-0.514102757f, -0.516731799f, -0.519356012f, -0.521975279f, -0.524589658f, -0.527199149f, -0.529803634f, -0.532403111f,
+	-0.534997642f, -0.537587047f, -0.540171444f, -0.542750776f, -0.545324981f, -0.547894061f, -0.550457954f, -0.553016722f,
+	-0.555570245f, -0.558118522f, -0.560661554f, -0.563199341f, -0.565731823f, -0.568258941f, -0.570780754f, -0.573297143f,
+	-0.575808167f, -0.578313768f, -0.580813944f, -0.583308637f, -0.585797846f, -0.588281572f, -0.590759695f, -0.593232274f,
+	-0.59569931f, -0.598160684f, -0.600616455f, -0.603066623f, -0.605511069f, -0.607949793f, -0.610382795f, -0.612810075f,
+	-0.615231574f, -0.61764729f, -0.620057225f, -0.622461259f, -0.624859512f, -0.627251804f, -0.629638255f, -0.632018745f,
+	-0.634393275f, -0.636761844f, -0.639124453f, -0.641481042f, -0.643831551f, -0.64617604f, -0.64851439f, -0.65084666f,
+	-0.653172851f, -0.655492842f, -0.657806695f, -0.660114348f, -0.662415802f, -0.664710999f, -0.666999936f, -0.669282615f,
+	-0.671558976f, -0.673829019f, -0.676092684f, -0.678350031f, -0.680601001f, -0.682845533f, -0.685083687f, -0.687315345f,
+	-0.689540565f, -0.691759229f, -0.693971455f, -0.696177125f, -0.698376238f, -0.700568795f, -0.702754736f, -0.704934061f,
+	-0.707106769f, -0.709272802f, -0.711432219f, -0.71358484f, -0.715730846f, -0.717870057f, -0.720002532f, -0.722128212f,
+	-0.724247098f, -0.726359129f, -0.728464365f, -0.730562747f, -0.732654274f, -0.734738886f, -0.736816585f, -0.73888731f,
+	-0.740951121f, -0.743007958f, -0.745057762f, -0.747100592f, -0.749136388f, -0.751165152f, -0.753186822f, -0.755201399f,
+	-0.757208824f, -0.759209216f, -0.761202395f, -0.763188422f, -0.765167236f, -0.767138898f, -0.769103348f, -0.771060526f,
+	-0.773010433f, -0.774953127f, -0.77688849f, -0.778816521f, -0.780737221f, -0.78265059f, -0.784556568f, -0.786455214f,
+	-0.78834641f, -0.790230215f, -0.792106569f, -0.793975472f, -0.795836926f, -0.797690868f, -0.799537241f, -0.801376164f,
+	-0.803207517f, -0.805031359f, -0.806847572f, -0.808656156f, -0.81045717f, -0.812250614f, -0.81403631f, -0.815814435f,
+	-0.817584813f, -0.819347501f, -0.8211025f, -0.82284981f, -0.824589312f, -0.826321065f, -0.82804507f, -0.829761207f,
+	-0.831469595f, -0.833170176f, -0.834862888f, -0.836547732f, -0.838224709f, -0.839893818f, -0.841554999f, -0.843208253f,
+	-0.84485358f, -0.84649092f, -0.848120332f, -0.849741757f, -0.851355195f, -0.852960587f, -0.854557991f, -0.856147349f,
+	-0.857728601f, -0.859301805f, -0.860866964f, -0.862423956f, -0.863972843f, -0.865513623f, -0.867046237f, -0.868570685f,
+	-0.870086968f, -0.871595085f, -0.873094976f, -0.874586642f, -0.876070082f, -0.877545297f, -0.879012227f, -0.880470872f,
+	-0.881921291f, -0.883363366f, -0.884797096f, -0.886222541f, -0.887639642f, -0.889048338f, -0.890448749f, -0.891840696f,
+	-0.893224299f, -0.894599497f, -0.895966232f, -0.897324562f, -0.898674488f, -0.900015891f, -0.901348829f, -0.902673304f,
+	-0.903989315f, -0.905296743f, -0.906595707f, -0.907886088f, -0.909168005f, -0.910441279f, -0.91170603f, -0.912962198f,
+	-0.914209783f, -0.915448725f, -0.916679084f, -0.917900801f, -0.919113874f, -0.920318305f, -0.921514034f, -0.92270112f,
+	-0.923879504f, -0.925049245f, -0.926210225f, -0.927362502f, -0.928506076f, -0.929640889f, -0.93076694f, -0.931884289f,
+	-0.932992816f, -0.934092522f, -0.935183525f, -0.936265647f, -0.937339008f, -0.938403547f, -0.939459205f, -0.940506041f,
+	-0.941544056f, -0.94257319f, -0.943593442f, -0.944604814f, -0.945607305f, -0.946600914f, -0.947585583f, -0.94856137f,
+	-0.949528158f, -0.950486064f, -0.95143503f, -0.952374995f, -0.953306019f, -0.954228103f, -0.955141187f, -0.95604527f,
+	-0.956940353f, -0.957826436f, -0.958703458f, -0.95957154f, -0.960430503f, -0.961280465f, -0.962121427f, -0.962953269f,
+	-0.963776052f, -0.964589775f, -0.965394437f, -0.966189981f, -0.966976464f, -0.967753828f, -0.968522072f, -0.969281256f,
+	-0.970031261f, -0.970772147f, -0.971503913f, -0.972226501f, -0.972939968f, -0.973644257f, -0.974339366f, -0.975025356f,
+	-0.975702107f, -0.976369739f, -0.977028131f, -0.977677345f, -0.97831738f, -0.978948176f, -0.979569793f, -0.980182111f,
+	-0.980785251f, -0.981379211f, -0.981963873f, -0.982539296f, -0.983105481f, -0.983662426f, -0.984210074f, -0.984748483f,
+	-0.985277653f, -0.985797524f, -0.986308098f, -0.986809373f, -0.987301409f, -0.987784147f, -0.988257587f, -0.988721669f,
+	-0.989176512f, -0.989621997f, -0.990058184f, -0.990485072f, -0.990902662f, -0.991310835f, -0.991709769f, -0.992099285f,
+	-0.992479563f, -0.992850423f, -0.993211925f, -0.993564129f, -0.993906975f, -0.994240463f, -0.994564593f, -0.994879305f,
+	-0.99518472f, -0.995480776f, -0.995767415f, -0.996044695f, -0.996312618f, -0.996571124f, -0.996820271f, -0.997060061f,
+	-0.997290432f, -0.997511446f, -0.997723043f, -0.997925282f, -0.998118103f, -0.998301566f, -0.998475552f, -0.998640239f,
+	-0.99879545f, -0.998941302f, -0.999077737f, -0.999204755f, -0.999322355f, -0.999430597f, -0.999529421f, -0.999618828f,
+	-0.999698818f, -0.99976939f, -0.999830604f, -0.99988234f, -0.999924719f, -0.999957621f, -0.999981165f, -0.999995291f,
+	-1.0f, -0.999995291f, -0.999981165f, -0.999957621f, -0.999924719f, -0.99988234f, -0.999830604f, -0.99976939f,
+	-0.999698818f, -0.999618828f, -0.999529421f, -0.999430597f, -0.999322355f, -0.999204755f, -0.999077737f, -0.998941302f,
+	-0.99879545f, -0.998640239f, -0.998475552f, -0.998301566f, -0.998118103f, -0.997925282f, -0.997723043f, -0.997511446f,
+	-0.997290432f, -0.997060061f, -0.996820271f, -0.996571124f, -0.996312618f, -0.996044695f, -0.995767415f, -0.995480776f,
+	-0.99518472f, -0.994879305f, -0.994564593f, -0.994240463f, -0.993906975f, -0.993564129f, -0.993211925f, -0.992850423f,
+	-0.992479563f, -0.992099285f, -0.991709769f, -0.991310835f, -0.990902662f, -0.990485072f, -0.990058184f, -0.989621997f,
+	-0.989176512f, -0.988721669f, -0.988257587f, -0.987784147f, -0.987301409f, -0.986809373f, -0.986308098f, -0.985797524f,
+	-0.985277653f, -0.984748483f, -0.984210074f, -0.983662426f, -0.983105481f, -0.982539296f, -0.981963873f, -0.981379211f,
+	-0.980785251f, -0.980182111f, -0.979569793f, -0.978948176f, -0.97831738f, -0.977677345f, -0.977028131f, -0.976369739f,
+	-0.975702107f, -0.975025356f, -0.974339366f, -0.973644257f, -0.972939968f, -0.972226501f, -0.971503913f, -0.970772147f,
+	-0.970031261f, -0.969281256f, -0.968522072f, -0.967753828f, -0.966976464f, -0.966189981f, -0.965394437f, -0.964589775f,
+	-0.963776052f, -0.962953269f, -0.962121427f, -0.961280465f, -0.960430503f, -0.95957154f, -0.958703458f, -0.957826436f,
+	-0.956940353f, -0.95604527f, -0.955141187f, -0.954228103f, -0.953306019f, -0.952374995f, -0.95143503f, -0.950486064f,
+	-0.949528158f, -0.94856137f, -0.947585583f, -0.946600914f, -0.945607305f, -0.944604814f, -0.943593442f, -0.94257319f,
+	-0.941544056f, -0.940506041f, -0.939459205f, -0.938403547f, -0.937339008f, -0.936265647f, -0.935183525f, -0.934092522f,
+	-0.932992816f, -0.931884289f, -0.93076694f, -0.929640889f, -0.928506076f, -0.927362502f, -0.926210225f, -0.925049245f,
+	-0.923879504f, -0.92270112f, -0.921514034f, -0.920318305f, -0.919113874f, -0.917900801f, -0.916679084f, -0.915448725f,
+	-0.914209783f, -0.912962198f, -0.91170603f, -0.910441279f, -0.909168005f, -0.907886088f, -0.906595707f, -0.905296743f,
+	-0.903989315f, -0.902673304f, -0.901348829f, -0.900015891f, -0.898674488f, -0.897324562f, -0.895966232f, -0.894599497f,
+	-0.893224299f, -0.891840696f, -0.890448749f, -0.889048338f, -0.887639642f, -0.886222541f, -0.884797096f, -0.883363366f,
+	-0.881921291f, -0.880470872f, -0.879012227f, -0.877545297f, -0.876070082f, -0.874586642f, -0.873094976f, -0.871595085f,
+	-0.870086968f, -0.868570685f, -0.867046237f, -0.865513623f, -0.863972843f, -0.862423956f, -0.860866964f, -0.859301805f,
+	-0.857728601f, -0.856147349f, -0.854557991f, -0.852960587f, -0.851355195f, -0.849741757f, -0.848120332f, -0.84649092f,
+	-0.84485358f, -0.843208253f, -0.841554999f, -0.839893818f, -0.838224709f, -0.836547732f, -0.834862888f, -0.833170176f,
+	-0.831469595f, -0.829761207f, -0.82804507f, -0.826321065f, -0.824589312f, -0.82284981f, -0.8211025f, -0.819347501f,
+	-0.817584813f, -0.815814435f, -0.81403631f, -0.812250614f, -0.81045717f, -0.808656156f, -0.806847572f, -0.805031359f,
+	-0.803207517f, -0.801376164f, -0.799537241f, -0.797690868f, -0.795836926f, -0.793975472f, -0.792106569f, -0.790230215f,
+	-0.78834641f, -0.786455214f, -0.784556568f, -0.78265059f, -0.780737221f, -0.778816521f, -0.77688849f, -0.774953127f,
+	-0.773010433f, -0.771060526f, -0.769103348f, -0.767138898f, -0.765167236f, -0.763188422f, -0.761202395f, -0.759209216f,
+	-0.757208824f, -0.755201399f, -0.753186822f, -0.751165152f, -0.749136388f, -0.747100592f, -0.745057762f, -0.743007958f,
+	-0.740951121f, -0.73888731f, -0.736816585f, -0.734738886f, -0.732654274f, -0.730562747f, -0.728464365f, -0.726359129f,
+	-0.724247098f, -0.722128212f, -0.720002532f, -0.717870057f, -0.715730846f, -0.71358484f, -0.711432219f, -0.709272802f,
+	-0.707106769f, -0.704934061f, -0.702754736f, -0.700568795f, -0.698376238f, -0.696177125f, -0.693971455f, -0.691759229f,
+	-0.689540565f, -0.687315345f, -0.685083687f, -0.682845533f, -0.680601001f, -0.678350031f, -0.676092684f, -0.673829019f,
+	-0.671558976f, -0.669282615f, -0.666999936f, -0.664710999f, -0.662415802f, -0.660114348f, -0.657806695f, -0.655492842f,
+	-0.653172851f, -0.65084666f, -0.64851439f, -0.64617604f, -0.643831551f, -0.641481042f, -0.639124453f, -0.636761844f,
+	-0.634393275f, -0.632018745f, -0.629638255f, -0.627251804f, -0.624859512f, -0.622461259f, -0.620057225f, -0.61764729f,
+	-0.615231574f, -0.612810075f, -0.610382795f, -0.607949793f, -0.605511069f, -0.603066623f, -0.600616455f, -0.598160684f,
+	-0.59569931f, -0.593232274f, -0.590759695f, -0.588281572f, -0.585797846f, -0.583308637f, -0.580813944f, -0.578313768f,
+	-0.575808167f, -0.573297143f, -0.570780754f, -0.568258941f, -0.565731823f, -0.563199341f, -0.560661554f, -0.558118522f,
+	-0.555570245f, -0.553016722f, -0.550457954f, -0.547894061f, -0.545324981f, -0.542750776f, -0.540171444f, -0.537587047f,
+	-0.534997642f, -0.532403111f, -0.529803634f, -0.527199149f, -0.524589658f, -0.521975279f, -0.519356012f, -0.516731799f,
+	-0.514102757f, -0.511468828f, -0.50883013f, -0.506186664f, -0.50353837f, -0.500885367f, -0.498227656f, -0.495565265f,
+	-0.492898196f, -0.490226477f, -0.487550169f, -0.484869242f, -0.482183784f, -0.479493767f, -0.47679922f, -0.474100202f,
+	-0.471396744f, -0.468688816f, -0.465976506f, -0.463259786f, -0.460538715f, -0.457813293f, -0.455083579f, -0.452349573f,
+	-0.449611336f, -0.446868837f, -0.444122136f, -0.441371262f, -0.438616246f, -0.435857087f, -0.433093816f, -0.430326492f,
+	-0.427555084f, -0.424779683f, -0.422000259f, -0.419216901f, -0.416429549f, -0.413638324f, -0.410843164f, -0.408044159f,
+	-0.405241311f, -0.402434647f, -0.399624199f, -0.396809995f, -0.393992037f, -0.391170382f, -0.388345033f, -0.385516047f,
+	-0.382683426f, -0.379847199f, -0.377007425f, -0.374164075f, -0.371317208f, -0.368466824f, -0.365612984f, -0.362755716f,
+	-0.359895051f, -0.357030958f, -0.354163527f, -0.351292759f, -0.348418683f, -0.345541328f, -0.342660725f, -0.339776874f,
+	-0.336889863f, -0.333999664f, -0.331106305f, -0.328209847f, -0.32531029f, -0.322407693f, -0.319502026f, -0.316593379f,
+	-0.313681751f, -0.310767144f, -0.307849646f, -0.304929227f, -0.302005947f, -0.299079835f, -0.296150893f, -0.293219149f,
+	-0.290284663f, -0.287347466f, -0.284407526f, -0.281464934f, -0.27851969f, -0.275571823f, -0.272621363f, -0.269668311f,
+	-0.266712755f, -0.263754666f, -0.260794103f, -0.257831097f, -0.254865646f, -0.251897812f, -0.248927608f, -0.24595505f,
+	-0.242980182f, -0.24000302f, -0.237023607f, -0.234041959f, -0.231058106f, -0.228072077f, -0.225083917f, -0.222093627f,
+	-0.219101235f, -0.216106802f, -0.213110313f, -0.210111842f, -0.207111374f, -0.204108968f, -0.201104641f, -0.198098406f,
+	-0.195090324f, -0.192080393f, -0.18906866f, -0.186055154f, -0.183039889f, -0.180022895f, -0.177004218f, -0.173983872f,
+	-0.170961887f, -0.167938292f, -0.164913118f, -0.161886394f, -0.15885815f, -0.155828401f, -0.152797192f, -0.149764538f,
+	-0.146730468f, -0.143695027f, -0.140658244f, -0.137620121f, -0.134580702f, -0.13154003f, -0.128498107f, -0.125454977f,
+	-0.122410677f, -0.119365215f, -0.116318628f, -0.113270953f, -0.110222206f, -0.107172422f, -0.104121633f, -0.10106986f,
+	-0.0980171412f, -0.0949634984f, -0.0919089541f, -0.0888535529f, -0.0857973099f, -0.0827402622f, -0.0796824396f, -0.0766238645f,
+	-0.0735645667f, -0.070504576f, -0.0674439222f, -0.0643826276f, -0.061320737f, -0.0582582653f, -0.0551952459f, -0.052131705f,
+	-0.0490676761f, -0.0460031815f, -0.0429382585f, -0.0398729257f, -0.0368072242f, -0.0337411724f, -0.030674804f, -0.027608145f,
+	-0.024541229f, -0.0214740802f, -0.0184067301f, -0.015339206f, -0.0122715384f, -0.00920375437f, -0.00613588467f, -0.00306795677f,
+	0.0f,
+#elif FMATH_TABLE_BITS == 12
+	0.0f, 0.00153398013f, 0.00306795677f, 0.00460192608f, 0.00613588467f, 0.00766982883f, 0.00920375437f, 0.0107376594f,
+	0.0122715384f, 0.0138053885f, 0.015339206f, 0.0168729872f, 0.0184067301f, 0.0199404284f, 0.0214740802f, 0.0230076816f,
+	0.024541229f, 0.0260747187f, 0.027608145f, 0.029141508f, 0.030674804f, 0.0322080255f, 0.0337411724f, 0.0352742374f,
+	0.0368072242f, 0.0383401215f, 0.0398729257f, 0.0414056405f, 0.0429382585f, 0.0444707721f, 0.0460031815f, 0.0475354828f,
+	0.0490676761f, 0.0505997501f, 0.052131705f, 0.0536635369f, 0.0551952459f, 0.0567268208f, 0.0582582653f, 0.0597895719f,
+	0.061320737f, 0.0628517568f, 0.0643826276f, 0.0659133494f, 0.0674439222f, 0.068974331f, 0.070504576f, 0.0720346496f,
+	0.0735645667f, 0.0750942975f, 0.0766238645f, 0.0781532452f, 0.0796824396f, 0.0812114477f, 0.0827402622f, 0.0842688903f,
+	0.0857973099f, 0.0873255357f, 0.0888535529f, 0.0903813615f, 0.0919089541f, 0.093436338f, 0.0949634984f, 0.0964904279f,
+	0.0980171412f, 0.0995436162f, 0.10106986f, 0.102595866f, 0.104121633f, 0.105647154f, 0.107172422f, 0.108697444f,
+	0.110222206f, 0.111746714f, 0.113270953f, 0.114794925f, 0.116318628f, 0.117842063f, 0.119365215f, 0.120888084f,
+	0.122410677f, 0.123932973f, 0.125454977f, 0.126976699f, 0.128498107f, 0.130019218f, 0.13154003f, 0.13306053f,
+	0.134580702f, 0.136100575f, 0.137620121f, 0.139139339f, 0.140658244f, 0.142176807f, 0.143695027f, 0.145212919f,
+	0.146730468f, 0.148247674f, 0.149764538f, 0.151281044f, 0.152797192f, 0.154312968f, 0.155828401f, 0.157343462f,
+	0.15885815f, 0.160372451f, 0.161886394f, 0.16339995f, 0.164913118f, 0.166425899f, 0.167938292f, 0.169450298f,
+	0.170961887f, 0.172473088f, 0.173983872f, 0.175494254f, 0.177004218f, 0.178513765f, 0.180022895f, 0.181531608f,
+	0.183039889f, 0.184547737f, 0.186055154f, 0.187562123f, 0.18906866f, 0.19057475f, 0.192080393f, 0.19358559f,
+	0.195090324f, 0.196594596f, 0.198098406f, 0.199601755f, 0.201104641f, 0.202607036f, 0.204108968f, 0.205610409f,
+	0.207111374f, 0.208611846f, 0.210111842f, 0.211611331f, 0.213110313f, 0.214608818f, 0.216106802f, 0.21760428f,
+	0.219101235f, 0.220597684f, 0.222093627f, 0.223589033f, 0.225083917f, 0.226578265f, 0.228072077f, 0.229565367f,
+	0.231058106f, 0.232550308f, 0.234041959f, 0.235533059f, 0.237023607f, 0.238513589f, 0.24000302f, 0.241491884f,
+	0.242980182f, 0.244467899f, 0.24595505f, 0.24744162f, 0.248927608f, 0.250413001f, 0.251897812f, 0.253382027f,
+	0.254865646f, 0.25634867f, 0.257831097f, 0.259312928f, 0.260794103f, 0.262274712f, 0.263754666f, 0.265234023f,
+	0.266712755f, 0.268190861f, 0.269668311f, 0.271145165f, 0.272621363f, 0.274096906f, 0.275571823f, 0.277046084f,
+	0.27851969f, 0.27999264f, 0.281464934f, 0.282936573f, 0.284407526f, 0.285877824f, 0.287347466f, 0.288816422f,
+	0.290284663f, 0.291752249f, 0.293219149f, 0.294685364f, 0.296150893f, 0.297615707f, 0.299079835f, 0.300543249f,
+	0.302005947f, 0.303467959f, 0.304929227f, 0.306389809f, 0.307849646f, 0.309308767f, 0.310767144f, 0.312224805f,
+	0.313681751f, 0.315137923f, 0.316593379f, 0.31804809f, 0.319502026f, 0.320955247f, 0.322407693f, 0.323859364f,
+	0.32531029f, 0.326760441f, 0.328209847f, 0.329658449f, 0.331106305f, 0.332553357f, 0.333999664f, 0.335445136f,
+	0.336889863f, 0.338333756f, 0.339776874f, 0.341219217f, 0.342660725f, 0.344101429f, 0.345541328f, 0.346980423f,
+	0.348418683f, 0.349856138f, 0.351292759f, 0.352728546f, 0.354163527f, 0.355597675f, 0.357030958f, 0.358463407f,
+	0.359895051f, 0.3613258f, 0.362755716f, 0.364184797f, 0.365612984f, 0.367040336f, 0.368466824f, 0.369892448f,
+	0.371317208f, 0.372741073f, 0.374164075f, 0.375586182f, 0.377007425f, 0.378427744f, 0.379847199f, 0.381265759f,
+	0.382683426f, 0.384100199f, 0.385516047f, 0.386931002f, 0.388345033f, 0.38975817f, 0.391170382f, 0.392581671f,
+	0.393992037f, 0.395401478f, 0.396809995f, 0.398217559f, 0.399624199f, 0.401029885f, 0.402434647f, 0.403838456f,
+	0.405241311f, 0.406643212f, 0.408044159f, 0.409444153f, 0.410843164f, 0.41224122f, 0.413638324f, 0.415034413f,
+	0.416429549f, 0.417823702f, 0.419216901f, 0.420609087f, 0.422000259f, 0.423390478f, 0.424779683f, 0.426167876f,
+	0.427555084f, 0.42894128f, 0.430326492f, 0.43171066f, 0.433093816f, 0.434475958f, 0.435857087f, 0.437237173f,
+	0.438616246f, 0.439994276f, 0.441371262f, 0.442747235f, 0.444122136f, 0.445496023f, 0.446868837f, 0.448240608f,
+	0.449611336f, 0.450980991f, 0.452349573f, 0.453717113f, 0.455083579f, 0.456448972f, 0.457813293f, 0.45917654f,
+	0.460538715f, 0.461899787f, 0.463259786f, 0.464618683f, 0.465976506f, 0.467333198f, 0.468688816f, 0.470043331f,
+	0.471396744f, 0.472749025f, 0.474100202f, 0.475450277f, 0.47679922f, 0.47814706f, 0.479493767f, 0.480839342f,
+	0.482183784f, 0.483527064f, 0.484869242f, 0.486210287f, 0.487550169f, 0.48888889f, 0.490226477f, 0.491562903f,
+	0.492898196f, 0.494232297f, 0.495565265f, 0.496897042f, 0.498227656f, 0.499557108f, 0.500885367f, 0.502212465f,
+	0.50353837f, 0.504863083f, 0.506186664f, 0.507508993f, 0.50883013f, 0.510150075f, 0.511468828f, 0.512786388f,
+	0.514102757f, 0.515417874f, 0.516731799f, 0.518044531f, 0.519356012f, 0.520666242f, 0.521975279f, 0.523283124f,
+	0.524589658f, 0.525895f, 0.527199149f, 0.528501987f, 0.529803634f, 0.531104028f, 0.532403111f, 0.533701003f,
+	0.534997642f, 0.53629297f, 0.537587047f, 0.538879931f, 0.540171444f, 0.541461766f, 0.542750776f, 0.544038534f,
+	0.545324981f, 0.546610177f, 0.547894061f, 0.549176633f, 0.550457954f, 0.551737964f, 0.553016722f, 0.554294109f,
+	0.555570245f, 0.556845009f, 0.558118522f, 0.559390724f, 0.560661554f, 0.561931133f, 0.563199341f, 0.564466238f,
+	0.565731823f, 0.566996038f, 0.568258941f, 0.569520533f, 0.570780754f, 0.572039604f, 0.573297143f, 0.57455337f,
+	0.575808167f, 0.577061653f, 0.578313768f, 0.579564571f, 0.580813944f, 0.582062006f, 0.583308637f, 0.584553957f,
+	0.585797846f, 0.587040365f, 0.588281572f, 0.589521289f, 0.590759695f, 0.59199667f, 0.593232274f, 0.594466507f,
+	0.59569931f, 0.596930683f, 0.598160684f, 0.599389315f, 0.600616455f, 0.601842225f, 0.603066623f, 0.604289532f,
+	0.605511069f, 0.606731117f, 0.607949793f, 0.609167039f, 0.610382795f, 0.61159718f, 0.612810075f, 0.61402154f,
+	0.615231574f, 0.616440177f, 0.61764729f, 0.618852973f, 0.620057225f, 0.621259987f, 0.622461259f, 0.623661101f,
+	0.624859512f, 0.626056373f, 0.627251804f, 0.628445745f, 0.629638255f, 0.630829215f, 0.632018745f, 0.633206785f,
+	0.634393275f, 0.635578334f, 0.636761844f, 0.637943923f, 0.639124453f, 0.640303493f, 0.641481042f, 0.642657042f,
+	0.643831551f, 0.645004511f, 0.64617604f, 0.64734596f, 0.64851439f, 0.64968133f, 0.65084666f, 0.65201056f,
+	0.653172851f, 0.654333591f, 0.655492842f, 0.656650543f, 0.657806695f, 0.658961296f, 0.660114348f, 0.66126585f,
+	0.662415802f, 0.663564146f, 0.664710999f, 0.665856242f, 0.666999936f, 0.668142021f, 0.669282615f, 0.670421541f,
+	0.671558976f, 0.672694743f, 0.673829019f, 0.674961627f, 0.676092684f, 0.677222192f, 0.678350031f, 0.679476321f,
+	0.680601001f, 0.681724072f, 0.682845533f, 0.683965385f, 0.685083687f, 0.686200321f, 0.687315345f, 0.68842876f,
+	0.689540565f, 0.690650702f, 0.691759229f, 0.692866147f, 0.693971455f, 0.695075095f, 0.696177125f, 0.697277486f,
+	0.698376238f, 0.699473321f, 0.700568795f, 0.7016626f, 0.702754736f, 0.703845263f, 0.704934061f, 0.706021249f,
+	0.707106769f, 0.70819062f, 0.709272802f, 0.710353374f, 0.711432219f, 0.712509394f, 0.71358484f, 0.714658678f,
+	0.715730846f, 0.716801286f, 0.717870057f, 0.718937099f, 0.720002532f, 0.721066177f, 0.722128212f, 0.72318846f,
+	0.724247098f, 0.725303948f, 0.726359129f, 0.727412641f, 0.728464365f, 0.72951442f, 0.730562747f, 0.731609404f,
+	0.732654274f, 0.733697414f, 0.734738886f, 0.73577857f, 0.736816585f, 0.737852812f, 0.73888731f, 0.73992008f,
+	0.740951121f, 0.741980433f, 0.743007958f, 0.744033754f, 0.745057762f, 0.746080101f, 0.747100592f, 0.748119354f,
+	0.749136388f, 0.750151634f, 0.751165152f, 0.752176821f, 0.753186822f, 0.754194975f, 0.755201399f, 0.756205976f,
+	0.757208824f, 0.758209884f, 0.759209216f, 0.760206699f, 0.761202395f, 0.762196302f, 0.763188422f, 0.764178753f,
+	0.765167236f, 0.766153991f, 0.767138898f, 0.768122017f, 0.769103348f, 0.770082831f, 0.771060526f, 0.772036374f,
+	0.773010433f, 0.773982704f, 0.774953127f, 0.775921702f, 0.77688849f, 0.777853429f, 0.778816521f, 0.779777765f,
+	0.780737221f, 0.781694829f, 0.78265059f, 0.783604503f, 0.784556568f, 0.785506845f, 0.786455214f, 0.787401736f,
+	0.78834641f, 0.789289236f, 0.790230215f, 0.791169345f, 0.792106569f, 0.793041945f, 0.793975472f, 0.794907153f,
+	0.795836926f, 0.796764791f, 0.797690868f, 0.798614979f, 0.799537241f, 0.800457656f, 0.801376164f, 0.802292824f,
+	0.803207517f, 0.804120362f, 0.805031359f, 0.80594039f, 0.806847572f, 0.807752848f, 0.808656156f, 0.809557617f,
+	0.81045717f, 0.811354876f, 0.812250614f, 0.813144386f, 0.81403631f, 0.814926326f, 0.815814435f, 0.816700578f,
+	0.817584813f, 0.81846714f, 0.819347501f, 0.820225954f, 0.8211025f, 0.821977139f, 0.82284981f, 0.823720515f,
+	0.824589312f, 0.825456142f, 0.826321065f, 0.827184021f, 0.82804507f, 0.828904092f, 0.829761207f, 0.830616415f,
+	0.831469595f, 0.832320869f, 0.833170176f, 0.834017515f, 0.834862888f, 0.835706294f, 0.836547732f, 0.837387204f,
+	0.838224709f, 0.839060247f, 0.839893818f, 0.840725362f, 0.841554999f, 0.84238261f, 0.843208253f, 0.84403187f,
+	0.84485358f, 0.845673263f, 0.84649092f, 0.847306609f, 0.848120332f, 0.848932028f, 0.849741757f, 0.850549459f,
+	0.851355195f, 0.852158904f, 0.852960587f, 0.853760302f, 0.854557991f, 0.855353653f, 0.856147349f, 0.856938958f,
+	0.857728601f, 0.858516216f, 0.859301805f, 0.860085368f, 0.860866964f, 0.861646473f, 0.862423956f, 0.863199413f,
+	0.863972843f, 0.864744246f, 0.865513623f, 0.866280973f, 0.867046237f, 0.867809474f, 0.868570685f, 0.86932987f,
+	0.870086968f, 0.87084204f, 0.871595085f, 0.872346044f, 0.873094976f, 0.873841822f, 0.874586642f, 0.875329375f,
+	0.876070082f, 0.876808703f, 0.877545297f, 0.878279805f, 0.879012227f, 0.879742622f, 0.880470872f, 0.881197095f,
+	0.881921291f, 0.882643342f, 0.883363366f, 0.884081244f, 0.884797096f, 0.885510862f, 0.886222541f, 0.886932135f,
+	0.887639642f, 0.888345063f, 0.889048338f, 0.889749587f, 0.890448749f, 0.891145766f, 0.891840696f, 0.892533541f,
+	0.893224299f, 0.893912971f, 0.894599497f, 0.895283937f, 0.895966232f, 0.8966465f, 0.897324562f, 0.898000598f,
+	0.898674488f, 0.899346232f, 0.900015891f, 0.900683403f, 0.901348829f, 0.902012169f, 0.902673304f, 0.903332353f,
+	0.903989315f, 0.904644072f, 0.905296743f, 0.905947268f, 0.906595707f, 0.907242f, 0.907886088f, 0.90852809f,
+	0.909168005f, 0.909805715f, 0.910441279f, 0.911074758f, 0.91170603f, 0.912335157f, 0.912962198f, 0.913587034f,
+	0.914209783f, 0.914830327f, 0.915448725f, 0.916064978f, 0.916679084f, 0.917290986f, 0.917900801f, 0.91850841f,
+	0.919113874f, 0.919717133f, 0.920318305f, 0.920917213f, 0.921514034f, 0.92210865f, 0.92270112f, 0.923291445f,
+	0.923879504f, 0.924465477f, 0.925049245f, 0.925630808f, 0.926210225f, 0.926787496f, 0.927362502f, 0.927935421f,
+	0.928506076f, 0.929074585f, 0.929640889f, 0.930205047f, 0.93076694f, 0.931326687f, 0.931884289f, 0.932439625f,
+	0.932992816f, 0.933543801f, 0.934092522f, 0.934639156f, 0.935183525f, 0.935725689f, 0.936265647f, 0.93680346f,
+	0.937339008f, 0.93787235f, 0.938403547f, 0.938932478f, 0.939459205f, 0.939983726f, 0.940506041f, 0.941026151f,
+	0.941544056f, 0.942059755f, 0.94257319f, 0.943084419f, 0.943593442f, 0.944100261f, 0.944604814f, 0.945107222f,
+	0.945607305f, 0.946105242f, 0.946600914f, 0.947094381f, 0.947585583f, 0.948074579f, 0.94856137f, 0.949045897f,
+	0.949528158f, 0.950008273f, 0.950486064f, 0.950961649f, 0.95143503f, 0.951906145f, 0.952374995f, 0.95284164f,
+	0.953306019f, 0.953768194f, 0.954228103f, 0.954685748f, 0.955141187f, 0.955594361f, 0.95604527f, 0.956493914f,
+	0.956940353f, 0.957384527f, 0.957826436f, 0.958266079f, 0.958703458f, 0.959138632f, 0.95957154f, 0.960002124f,
+	0.960430503f, 0.960856616f, 0.961280465f, 0.961702049f, 0.962121427f, 0.962538481f, 0.962953269f, 0.963365793f,
+	0.963776052f, 0.964184046f, 0.964589775f, 0.964993238f, 0.965394437f, 0.965793371f, 0.966189981f, 0.966584384f,
+	0.966976464f, 0.967366278f, 0.967753828f, 0.968139112f, 0.968522072f, 0.968902826f, 0.969281256f, 0.969657362f,
+	0.970031261f, 0.970402837f, 0.970772147f, 0.971139133f, 0.971503913f, 0.97186631f, 0.972226501f, 0.972584367f,
+	0.972939968f, 0.973293245f, 0.973644257f, 0.973992944f, 0.974339366f, 0.974683523f, 0.975025356f, 0.975364864f,
+	0.975702107f, 0.976037085f, 0.976369739f, 0.976700068f, 0.977028131f, 0.977353871f, 0.977677345f, 0.977998495f,
+	0.97831738f, 0.97863394f, 0.978948176f, 0.979260147f, 0.979569793f, 0.979877114f, 0.980182111f, 0.980484843f,
+	0.980785251f, 0.981083393f, 0.981379211f, 0.981672704f, 0.981963873f, 0.982252717f, 0.982539296f, 0.982823551f,
+	0.983105481f, 0.983385086f, 0.983662426f, 0.983937442f, 0.984210074f, 0.984480441f, 0.984748483f, 0.98501426f,
+	0.985277653f, 0.985538721f, 0.985797524f, 0.986053944f, 0.986308098f, 0.986559927f, 0.986809373f, 0.987056553f,
+	0.987301409f, 0.987543941f, 0.987784147f, 0.988022029f, 0.988257587f, 0.98849082f, 0.988721669f, 0.988950253f,
+	0.989176512f, 0.989400446f, 0.989621997f, 0.989841282f, 0.990058184f, 0.99027282f, 0.990485072f, 0.990695f,
+	0.990902662f, 0.991107941f, 0.991310835f, 0.991511464f, 0.991709769f, 0.991905689f, 0.992099285f, 0.992290616f,
+	0.992479563f, 0.992666125f, 0.992850423f, 0.993032336f, 0.993211925f, 0.993389189f, 0.993564129f, 0.993736744f,
+	0.993906975f, 0.994074881f, 0.994240463f, 0.99440366f, 0.994564593f, 0.994723141f, 0.994879305f, 0.995033205f,
+	0.99518472f, 0.99533391f, 0.995480776f, 0.995625257f, 0.995767415f, 0.995907247f, 0.996044695f, 0.996179819f,
+	0.996312618f, 0.996443033f, 0.996571124f, 0.996696889f, 0.996820271f, 0.996941328f, 0.997060061f, 0.997176409f,
+	0.997290432f, 0.997402132f, 0.997511446f, 0.997618437f, 0.997723043f, 0.997825325f, 0.997925282f, 0.998022854f,
+	0.998118103f, 0.998211026f, 0.998301566f, 0.998389721f, 0.998475552f, 0.998559058f, 0.998640239f, 0.998719037f,
+	0.99879545f, 0.998869538f, 0.998941302f, 0.999010682f, 0.999077737f, 0.999142408f, 0.999204755f, 0.999264777f,
+	0.999322355f, 0.999377668f, 0.999430597f, 0.999481201f, 0.999529421f, 0.999575317f, 0.999618828f, 0.999660015f,
+	0.999698818f, 0.999735296f, 0.99976939f, 0.999801159f, 0.999830604f, 0.999857664f, 0.99988234f, 0.999904692f,
+	0.999924719f, 0.999942362f, 0.999957621f, 0.999970615f, 0.999981165f, 0.99998939f, 0.999995291f, 0.999998808f,
+	1.0f, 0.999998808f, 0.999995291f, 0.99998939f, 0.999981165f, 0.999970615f, 0.999957621f, 0.999942362f,
+	0.999924719f, 0.999904692f, 0.99988234f, 0.999857664f, 0.999830604f, 0.999801159f, 0.99976939f, 0.999735296f,
+	0.999698818f, 0.999660015f, 0.999618828f, 0.999575317f, 0.999529421f, 0.999481201f, 0.999430597f, 0.999377668f,
+	0.999322355f, 0.999264777f, 0.999204755f, 0.999142408f, 0.999077737f, 0.999010682f, 0.998941302f, 0.998869538f,
+	0.99879545f, 0.998719037f, 0.998640239f, 0.998559058f, 0.998475552f, 0.998389721f, 0.998301566f, 0.998211026f,
+	0.998118103f, 0.998022854f, 0.997925282f, 0.997825325f, 0.997723043f, 0.997618437f, 0.997511446f, 0.997402132f,
+	0.997290432f, 0.997176409f, 0.997060061f, 0.996941328f, 0.996820271f, 0.996696889f, 0.996571124f, 0.996443033f,
+	0.996312618f, 0.996179819f, 0.996044695f, 0.995907247f, 0.995767415f, 0.995625257f, 0.995480776f, 0.99533391f,
+	0.99518472f, 0.995033205f, 0.994879305f, 0.994723141f, 0.994564593f, 0.99440366f, 0.994240463f, 0.994074881f,
+	0.993906975f, 0.993736744f, 0.993564129f, 0.993389189f, 0.993211925f, 0.993032336f, 0.992850423f, 0.992666125f,
+	0.992479563f, 0.992290616f, 0.992099285f, 0.991905689f, 0.991709769f, 0.991511464f, 0.991310835f, 0.991107941f,
+	0.990902662f, 0.990695f, 0.990485072f, 0.99027282f, 0.990058184f, 0.989841282f, 0.989621997f, 0.989400446f,
+	0.989176512f, 0.988950253f, 0.988721669f, 0.98849082f, 0.988257587f, 0.988022029f, 0.987784147f, 0.987543941f,
+	0.987301409f, 0.987056553f, 0.986809373f, 0.986559927f, 0.986308098f, 0.986053944f, 0.985797524f, 0.985538721f,
+	0.985277653f, 0.98501426f, 0.984748483f, 0.984480441f, 0.984210074f, 0.983937442f, 0.983662426f, 0.983385086f,
+	0.983105481f, 0.982823551f, 0.982539296f, 0.982252717f, 0.981963873f, 0.981672704f, 0.981379211f, 0.981083393f,
+	0.980785251f, 0.980484843f, 0.980182111f, 0.979877114f, 0.979569793f, 0.979260147f, 0.978948176f, 0.97863394f,
+	0.97831738f, 0.977998495f, 0.977677345f, 0.977353871f, 0.977028131f, 0.976700068f, 0.976369739f, 0.976037085f,
+	0.975702107f, 0.975364864f, 0.975025356f, 0.974683523f, 0.974339366f, 0.973992944f, 0.973644257f, 0.973293245f,
+	0.972939968f, 0.972584367f, 0.972226501f, 0.97186631f, 0.971503913f, 0.971139133f, 0.970772147f, 0.970402837f,
+	0.970031261f, 0.969657362f, 0.969281256f, 0.968902826f, 0.968522072f, 0.968139112f, 0.967753828f, 0.967366278f,
+	0.966976464f, 0.966584384f, 0.966189981f, 0.965793371f, 0.965394437f, 0.964993238f, 0.964589775f, 0.964184046f,
+	0.963776052f, 0.963365793f, 0.962953269f, 0.962538481f, 0.962121427f, 0.961702049f, 0.961280465f, 0.960856616f,
+	0.960430503f, 0.960002124f, 0.95957154f, 0.959138632f, 0.958703458f, 0.958266079f, 0.957826436f, 0.957384527f,
+	0.956940353f, 0.956493914f, 0.95604527f, 0.955594361f, 0.955141187f, 0.954685748f, 0.954228103f, 0.953768194f,
+	0.953306019f, 0.95284164f, 0.952374995f, 0.951906145f, 0.95143503f, 0.950961649f, 0.950486064f, 0.950008273f,
+	0.949528158f, 0.949045897f, 0.94856137f, 0.948074579f, 0.947585583f, 0.947094381f, 0.946600914f, 0.946105242f,
+	0.945607305f, 0.945107222f, 0.944604814f, 0.944100261f, 0.943593442f, 0.943084419f, 0.94257319f, 0.942059755f,
+	0.941544056f, 0.941026151f, 0.940506041f, 0.939983726f, 0.939459205f, 0.938932478f, 0.938403547f, 0.93787235f,
+	0.937339008f, 0.93680346f, 0.936265647f, 0.935725689f, 0.935183525f, 0.934639156f, 0.934092522f, 0.933543801f,
+	0.932992816f, 0.932439625f, 0.931884289f, 0.931326687f, 0.93076694f, 0.930205047f, 0.929640889f, 0.929074585f,
+	0.928506076f, 0.927935421f, 0.927362502f, 0.926787496f, 0.926210225f, 0.925630808f, 0.925049245f, 0.924465477f,
+	0.923879504f, 0.923291445f, 0.92270112f, 0.92210865f, 0.921514034f, 0.920917213f, 0.920318305f, 0.919717133f,
+	0.919113874f, 0.91850841f, 0.917900801f, 0.917290986f, 0.916679084f, 0.916064978f, 0.915448725f, 0.914830327f,
+	0.914209783f, 0.913587034f, 0.912962198f, 0.912335157f, 0.91170603f, 0.911074758f, 0.910441279f, 0.909805715f,
+	0.909168005f, 0.90852809f, 0.907886088f, 0.907242f, 0.906595707f, 0.905947268f, 0.905296743f, 0.904644072f,
+	0.903989315f, 0.903332353f, 0.902673304f, 0.902012169f, 0.901348829f, 0.900683403f, 0.900015891f, 0.899346232f,
+	0.898674488f, 0.898000598f, 0.897324562f, 0.8966465f, 0.895966232f, 0.895283937f, 0.894599497f, 0.893912971f,
+	0.893224299f, 0.892533541f, 0.891840696f, 0.891145766f, 0.890448749f, 0.889749587f, 0.889048338f, 0.888345063f,
+	0.887639642f, 0.886932135f, 0.886222541f, 0.885510862f, 0.884797096f, 0.884081244f, 0.883363366f, 0.882643342f,
+	0.881921291f, 0.881197095f, 0.880470872f, 0.879742622f, 0.879012227f, 0.878279805f, 0.877545297f, 0.876808703f,
+	0.876070082f, 0.875329375f, 0.874586642f, 0.873841822f, 0.873094976f, 0.872346044f, 0.871595085f, 0.87084204f,
+	0.870086968f, 0.86932987f, 0.868570685f, 0.867809474f, 0.867046237f, 0.866280973f, 0.865513623f, 0.864744246f,
+	0.863972843f, 0.863199413f, 0.862423956f, 0.861646473f, 0.860866964f, 0.860085368f, 0.859301805f, 0.858516216f,
+	0.857728601f, 0.856938958f, 0.856147349f, 0.855353653f, 0.854557991f, 0.853760302f, 0.852960587f, 0.852158904f,
+	0.851355195f, 0.850549459f, 0.849741757f, 0.848932028f, 0.848120332f, 0.847306609f, 0.84649092f, 0.845673263f,
+	0.84485358f, 0.84403187f, 0.843208253f, 0.84238261f, 0.841554999f, 0.840725362f, 0.839893818f, 0.839060247f,
+	0.838224709f, 0.837387204f, 0.836547732f, 0.835706294f, 0.834862888f, 0.834017515f, 0.833170176f, 0.832320869f,
+	0.831469595f, 0.830616415f, 0.829761207f, 0.828904092f, 0.82804507f, 0.827184021f, 0.826321065f, 0.825456142f,
+	0.824589312f, 0.823720515f, 0.82284981f, 0.821977139f, 0.8211025f, 0.820225954f, 0.819347501f, 0.81846714f,
+	0.817584813f, 0.816700578f, 0.815814435f, 0.814926326f, 0.81403631f, 0.813144386f, 0.812250614f, 0.811354876f,
+	0.81045717f, 0.809557617f, 0.808656156f, 0.807752848f, 0.806847572f, 0.80594039f, 0.805031359f, 0.804120362f,
+	0.803207517f, 0.802292824f, 0.801376164f, 0.800457656f, 0.799537241f, 0.798614979f, 0.797690868f, 0.796764791f,
+	0.795836926f, 0.794907153f, 0.793975472f, 0.793041945f, 0.792106569f, 0.791169345f, 0.790230215f, 0.789289236f,
+	0.78834641f, 0.787401736f, 0.786455214f, 0.785506845f, 0.784556568f, 0.783604503f, 0.78265059f, 0.781694829f,
+	0.780737221f, 0.779777765f, 0.778816521f, 0.777853429f, 0.77688849f, 0.775921702f, 0.774953127f, 0.773982704f,
+	0.773010433f, 0.772036374f, 0.771060526f, 0.770082831f, 0.769103348f, 0.768122017f, 0.767138898f, 0.766153991f,
+	0.765167236f, 0.764178753f, 0.763188422f, 0.762196302f, 0.761202395f, 0.760206699f, 0.759209216f, 0.758209884f,
+	0.757208824f, 0.756205976f, 0.755201399f, 0.754194975f, 0.753186822f, 0.752176821f, 0.751165152f, 0.750151634f,
+	0.749136388f, 0.748119354f, 0.747100592f, 0.746080101f, 0.745057762f, 0.744033754f, 0.743007958f, 0.741980433f,
+	0.740951121f, 0.73992008f, 0.73888731f, 0.737852812f, 0.736816585f, 0.73577857f, 0.734738886f, 0.733697414f,
+	0.732654274f, 0.731609404f, 0.730562747f, 0.72951442f, 0.728464365f, 0.727412641f, 0.726359129f, 0.725303948f,
+	0.724247098f, 0.72318846f, 0.722128212f, 0.721066177f, 0.720002532f, 0.718937099f, 0.717870057f, 0.716801286f,
+	0.715730846f, 0.714658678f, 0.71358484f, 0.712509394f, 0.711432219f, 0.710353374f, 0.709272802f, 0.70819062f,
+	0.707106769f, 0.706021249f, 0.704934061f, 0.703845263f, 0.702754736f, 0.7016626f, 0.700568795f, 0.699473321f,
+	0.698376238f, 0.697277486f, 0.696177125f, 0.695075095f, 0.693971455f, 0.692866147f, 0.691759229f, 0.690650702f,
+	0.689540565f, 0.68842876f, 0.687315345f, 0.686200321f, 0.685083687f, 0.683965385f, 0.682845533f, 0.681724072f,
+	0.680601001f, 0.679476321f, 0.678350031f, 0.677222192f, 0.676092684f, 0.674961627f, 0.673829019f, 0.672694743f,
+	0.671558976f, 0.670421541f, 0.669282615f, 0.668142021f, 0.666999936f, 0.665856242f, 0.664710999f, 0.663564146f,
+	0.662415802f, 0.66126585f, 0.660114348f, 0.658961296f, 0.657806695f, 0.656650543f, 0.655492842f, 0.654333591f,
+	0.653172851f, 0.65201056f, 0.65084666f, 0.64968133f, 0.64851439f, 0.64734596f, 0.64617604f, 0.645004511f,
+	0.643831551f, 0.642657042f, 0.641481042f, 0.640303493f, 0.639124453f, 0.637943923f, 0.636761844f, 0.635578334f,
+	0.634393275f, 0.633206785f, 0.632018745f, 0.630829215f, 0.629638255f, 0.628445745f, 0.627251804f, 0.626056373f,
+	0.624859512f, 0.623661101f, 0.622461259f, 0.621259987f, 0.620057225f, 0.618852973f, 0.61764729f, 0.616440177f,
+	0.615231574f, 0.61402154f, 0.612810075f, 0.61159718f, 0.610382795f, 0.609167039f, 0.607949793f, 0.606731117f,
+	0.605511069f, 0.604289532f, 0.603066623f, 0.601842225f, 0.600616455f, 0.599389315f, 0.598160684f, 0.596930683f,
+	0.59569931f, 0.594466507f, 0.593232274f, 0.59199667f, 0.590759695f, 0.589521289f, 0.588281572f, 0.587040365f,
+	0.585797846f, 0.584553957f, 0.583308637f, 0.582062006f, 0.580813944f, 0.579564571f, 0.578313768f, 0.577061653f,
+	0.575808167f, 0.57455337f, 0.573297143f, 0.572039604f, 0.570780754f, 0.569520533f, 0.568258941f, 0.566996038f,
+	0.565731823f, 0.564466238f, 0.563199341f, 0.561931133f, 0.560661554f, 0.559390724f, 0.558118522f, 0.556845009f,
+	0.555570245f, 0.554294109f, 0.553016722f, 0.551737964f, 0.550457954f, 0.549176633f, 0.547894061f, 0.546610177f,
+	0.545324981f, 0.544038534f, 0.542750776f, 0.541461766f, 0.540171444f, 0.538879931f, 0.537587047f, 0.53629297f,
+	0.534997642f, 0.533701003f, 0.532403111f, 0.531104028f, 0.529803634f, 0.528501987f, 0.527199149f, 0.525895f,
+	0.524589658f, 0.523283124f, 0.521975279f, 0.520666242f, 0.519356012f, 0.518044531f, 0.516731799f, 0.515417874f,
+	0.514102757f, 0.512786388f, 0.511468828f, 0.510150075f, 0.50883013f, 0.507508993f, 0.506186664f, 0.504863083f,
+	0.50353837f, 0.502212465f, 0.500885367f, 0.499557108f, 0.498227656f, 0.496897042f, 0.495565265f, 0.494232297f,
+	0.492898196f, 0.491562903f, 0.490226477f, 0.48888889f, 0.487550169f, 0.486210287f, 0.484869242f, 0.483527064f,
+	0.482183784f, 0.480839342f, 0.479493767f, 0.47814706f, 0.47679922f, 0.475450277f, 0.474100202f, 0.472749025f,
+	0.471396744f, 0.470043331f, 0.468688816f, 0.467333198f, 0.465976506f, 0.464618683f, 0.463259786f, 0.461899787f,
+	0.460538715f, 0.45917654f, 0.457813293f, 0.456448972f, 0.455083579f, 0.453717113f, 0.452349573f, 0.450980991f,
+	0.449611336f, 0.448240608f, 0.446868837f, 0.445496023f, 0.444122136f, 0.442747235f, 0.441371262f, 0.439994276f,
+	0.438616246f, 0.437237173f, 0.435857087f, 0.434475958f, 0.433093816f, 0.43171066f, 0.430326492f, 0.42894128f,
+	0.427555084f, 0.426167876f, 0.424779683f, 0.423390478f, 0.422000259f, 0.420609087f, 0.419216901f, 0.417823702f,
+	0.416429549f, 0.415034413f, 0.413638324f, 0.41224122f, 0.410843164f, 0.409444153f, 0.408044159f, 0.406643212f,
+	0.405241311f, 0.403838456f, 0.402434647f, 0.401029885f, 0.399624199f, 0.398217559f, 0.396809995f, 0.395401478f,
+	0.393992037f, 0.392581671f, 0.391170382f, 0.38975817f, 0.388345033f, 0.386931002f, 0.385516047f, 0.384100199f,
+	0.382683426f, 0.381265759f, 0.379847199f, 0.378427744f, 0.377007425f, 0.375586182f, 0.374164075f, 0.372741073f,
+	0.371317208f, 0.369892448f, 0.368466824f, 0.367040336f, 0.365612984f, 0.364184797f, 0.362755716f, 0.3613258f,
+	0.359895051f, 0.358463407f, 0.357030958f, 0.355597675f, 0.354163527f, 0.352728546f, 0.351292759f, 0.349856138f,
+	0.348418683f, 0.346980423f, 0.345541328f, 0.344101429f, 0.342660725f, 0.341219217f, 0.339776874f, 0.338333756f,
+	0.336889863f, 0.335445136f, 0.333999664f, 0.332553357f, 0.331106305f, 0.329658449f, 0.328209847f, 0.326760441f,
+	0.32531029f, 0.323859364f, 0.322407693f, 0.320955247f, 0.319502026f, 0.31804809f, 0.316593379f, 0.315137923f,
+	0.313681751f, 0.312224805f, 0.310767144f, 0.309308767f, 0.307849646f, 0.306389809f, 0.304929227f, 0.303467959f,
+	0.302005947f, 0.300543249f, 0.299079835f, 0.297615707f, 0.296150893f, 0.294685364f, 0.293219149f, 0.291752249f,
+	0.290284663f, 0.288816422f, 0.287347466f, 0.285877824f, 0.284407526f, 0.282936573f, 0.281464934f, 0.27999264f,
+	0.27851969f, 0.277046084f, 0.275571823f, 0.274096906f, 0.272621363f, 0.271145165f, 0.269668311f, 0.268190861f,
+	0.266712755f, 0.265234023f, 0.263754666f, 0.262274712f, 0.260794103f, 0.259312928f, 0.257831097f, 0.25634867f,
+	0.254865646f, 0.253382027f, 0.251897812f, 0.250413001f, 0.248927608f, 0.24744162f, 0.24595505f, 0.244467899f,
+	0.242980182f, 0.241491884f, 0.24000302f, 0.238513589f, 0.237023607f, 0.235533059f, 0.234041959f, 0.232550308f,
+	0.231058106f, 0.229565367f, 0.228072077f, 0.226578265f, 0.225083917f, 0.223589033f, 0.222093627f, 0.220597684f,
+	0.219101235f, 0.21760428f, 0.216106802f, 0.214608818f, 0.213110313f, 0.211611331f, 0.210111842f, 0.208611846f,
+	0.207111374f, 0.205610409f, 0.204108968f, 0.202607036f, 0.201104641f, 0.199601755f, 0.198098406f, 0.196594596f,
+	0.195090324f, 0.19358559f, 0.192080393f, 0.19057475f, 0.18906866f, 0.187562123f, 0.186055154f, 0.184547737f,
+	0.183039889f, 0.181531608f, 0.180022895f, 0.178513765f, 0.177004218f, 0.175494254f, 0.173983872f, 0.172473088f,
+	0.170961887f, 0.169450298f, 0.167938292f, 0.166425899f, 0.164913118f, 0.16339995f, 0.161886394f, 0.160372451f,
+	0.15885815f, 0.157343462f, 0.155828401f, 0.154312968f, 0.152797192f, 0.151281044f, 0.149764538f, 0.148247674f,
+	0.146730468f, 0.145212919f, 0.143695027f, 0.142176807f, 0.140658244f, 0.139139339f, 0.137620121f, 0.136100575f,
+	0.134580702f, 0.13306053f, 0.13154003f, 0.130019218f, 0.128498107f, 0.126976699f, 0.125454977f, 0.123932973f,
+	0.122410677f, 0.120888084f, 0.119365215f, 0.117842063f, 0.116318628f, 0.114794925f, 0.113270953f, 0.111746714f,
+	0.110222206f, 0.108697444f, 0.107172422f, 0.105647154f, 0.104121633f, 0.102595866f, 0.10106986f, 0.0995436162f,
+	0.0980171412f, 0.0964904279f, 0.0949634984f, 0.093436338f, 0.0919089541f, 0.0903813615f, 0.0888535529f, 0.0873255357f,
+	0.0857973099f, 0.0842688903f, 0.0827402622f, 0.0812114477f, 0.0796824396f, 0.0781532452f, 0.0766238645f, 0.0750942975f,
+	0.0735645667f, 0.0720346496f, 0.070504576f, 0.068974331f, 0.0674439222f, 0.0659133494f, 0.0643826276f, 0.0628517568f,
+	0.061320737f, 0.0597895719f, 0.0582582653f, 0.0567268208f, 0.0551952459f, 0.0536635369f, 0.052131705f, 0.0505997501f,
+	0.0490676761f, 0.0475354828f, 0.0460031815f, 0.0444707721f, 0.0429382585f, 0.0414056405f, 0.0398729257f, 0.0383401215f,
+	0.0368072242f, 0.0352742374f, 0.0337411724f, 0.0322080255f, 0.030674804f, 0.029141508f, 0.027608145f, 0.0260747187f,
+	0.024541229f, 0.0230076816f, 0.0214740802f, 0.0199404284f, 0.0184067301f, 0.0168729872f, 0.015339206f, 0.0138053885f,
+	0.0122715384f, 0.0107376594f, 0.00920375437f, 0.00766982883f, 0.00613588467f, 0.00460192608f, 0.00306795677f, 0.00153398013f,
+	0.0f, -0.00153398013f, -0.00306795677f, -0.00460192608f, -0.00613588467f, -0.00766982883f, -0.00920375437f, -0.0107376594f,
+	-0.0122715384f, -0.0138053885f, -0.015339206f, -0.0168729872f, -0.0184067301f, -0.0199404284f, -0.0214740802f, -0.0230076816f,
+	-0.024541229f, -0.0260747187f, -0.027608145f, -0.029141508f, -0.030674804f, -0.0322080255f, -0.0337411724f, -0.0352742374f,
+	-0.0368072242f, -0.0383401215f, -0.0398729257f, -0.0414056405f, -0.0429382585f, -0.0444707721f, -0.0460031815f, -0.0475354828f,
+	-0.0490676761f, -0.0505997501f, -0.052131705f, -0.0536635369f, -0.0551952459f, -0.0567268208f, -0.0582582653f, -0.0597895719f,
+	-0.061320737f, -0.0628517568f, -0.0643826276f, -0.0659133494f, -0.0674439222f, -0.068974331f, -0.070504576f, -0.0720346496f,
+	-0.0735645667f, -0.0750942975f, -0.0766238645f, -0.0781532452f, -0.0796824396f, -0.0812114477f, -0.0827402622f, -0.0842688903f,
+	-0.0857973099f, -0.0873255357f, -0.0888535529f, -0.0903813615f, -0.0919089541f, -0.093436338f, -0.0949634984f, -0.0964904279f,
+	-0.0980171412f, -0.0995436162f, -0.10106986f, -0.102595866f, -0.104121633f, -0.105647154f, -0.107172422f, -0.108697444f,
+	-0.110222206f, -0.111746714f, -0.113270953f, -0.114794925f, -0.116318628f, -0.117842063f, -0.119365215f, -0.120888084f,
+	-0.122410677f, -0.123932973f, -0.125454977f, -0.126976699f, -0.128498107f, -0.130019218f, -0.13154003f, -0.13306053f,
+	-0.134580702f, -0.136100575f, -0.137620121f, -0.139139339f, -0.140658244f, -0.142176807f, -0.143695027f, -0.145212919f,
+	-0.146730468f, -0.148247674f, -0.149764538f, -0.151281044f, -0.152797192f, -0.154312968f, -0.155828401f, -0.157343462f,
+	-0.15885815f, -0.160372451f, -0.161886394f, -0.16339995f, -0.164913118f, -0.166425899f, -0.167938292f, -0.169450298f,
+	-0.170961887f, -0.172473088f, -0.173983872f, -0.175494254f, -0.177004218f, -0.178513765f, -0.180022895f, -0.181531608f,
+	-0.183039889f, -0.184547737f, -0.186055154f, -0.187562123f, -0.18906866f, -0.19057475f, -0.192080393f, -0.19358559f,
+	-0.195090324f, -0.196594596f, -0.198098406f, -0.199601755f, -0.201104641f, -0.202607036f, -0.204108968f, -0.205610409f,
+	-0.207111374f, -0.208611846f, -0.210111842f, -0.211611331f, -0.213110313f, -0.214608818f, -0.216106802f, -0.21760428f,
+	-0.219101235f, -0.220597684f, -0.222093627f, -0.223589033f, -0.225083917f, -0.226578265f, -0.228072077f, -0.229565367f,
+	-0.231058106f, -0.232550308f, -0.234041959f, -0.235533059f, -0.237023607f, -0.238513589f, -0.24000302f, -0.241491884f,
+	-0.242980182f, -0.244467899f, -0.24595505f, -0.24744162f, -0.248927608f, -0.250413001f, -0.251897812f, -0.253382027f,
+	-0.254865646f, -0.25634867f, -0.257831097f, -0.259312928f, -0.260794103f, -0.262274712f, -0.263754666f, -0.265234023f,
+	-0.266712755f, -0.268190861f, -0.269668311f, -0.271145165f, -0.272621363f, -0.274096906f, -0.275571823f, -0.277046084f,
+	-0.27851969f, -0.27999264f, -0.281464934f, -0.282936573f, -0.284407526f, -0.285877824f, -0.287347466f, -0.288816422f,
+	-0.290284663f, -0.291752249f, -0.293219149f, -0.294685364f, -0.296150893f, -0.297615707f, -0.299079835f, -0.300543249f,
+	-0.302005947f, -0.303467959f, -0.304929227f, -0.306389809f, -0.307849646f, -0.309308767f, -0.310767144f, -0.312224805f,
+	-0.313681751f, -0.315137923f, -0.316593379f, -0.31804809f, -0.319502026f, -0.320955247f, -0.322407693f, -0.323859364f,
+	-0.32531029f, -0.326760441f, -0.328209847f, -0.329658449f, -0.331106305f, -0.332553357f, -0.333999664f, -0.335445136f,
+	-0.336889863f, -0.338333756f, -0.339776874f, -0.341219217f, -0.342660725f, -0.344101429f, -0.345541328f, -0.346980423f,
+	-0.348418683f, -0.349856138f, -0.351292759f, -0.352728546f, -0.354163527f, -0.355597675f, -0.357030958f, -0.358463407f,
+	-0.359895051f, -0.3613258f, -0.362755716f, -0.364184797f, -0.365612984f, -0.367040336f, -0.368466824f, -0.369892448f,
+	-0.371317208f, -0.372741073f, -0.374164075f, -0.375586182f, -0.377007425f, -0.378427744f, -0.379847199f, -0.381265759f,
+	-0.382683426f, -0.384100199f, -0.385516047f, -0.386931002f, -0.388345033f, -0.38975817f, -0.391170382f, -0.392581671f,
+	-0.393992037f, -0.395401478f, -0.396809995f, -0.398217559f, -0.399624199f, -0.401029885f, -0.402434647f, -0.403838456f,
+	-0.405241311f, -0.406643212f, -0.408044159f, -0.409444153f, -0.410843164f, -0.41224122f, -0.413638324f, -0.415034413f,
+	-0.416429549f, -0.417823702f, -0.419216901f, -0.420609087f, -0.422000259f, -0.423390478f, -0.424779683f, -0.426167876f,
+	-0.427555084f, -0.42894128f, -0.430326492f, -0.43171066f, -0.433093816f, -0.434475958f, -0.435857087f, -0.437237173f,
+	-0.438616246f, -0.439994276f, -0.441371262f, -0.442747235f, -0.444122136f, -0.445496023f, -0.446868837f, -0.448240608f,
+	-0.449611336f, -0.450980991f, -0.452349573f, -0.453717113f, -0.455083579f, -0.456448972f, -0.457813293f, -0.45917654f,
+	-0.460538715f, -0.461899787f, -0.463259786f, -0.464618683f, -0.465976506f, -0.467333198f, -0.468688816f, -0.470043331f,
+	-0.471396744f, -0.472749025f, -0.474100202f, -0.475450277f, -0.47679922f, -0.47814706f, -0.479493767f, -0.480839342f,
+	-0.482183784f, -0.483527064f, -0.484869242f, -0.486210287f, -0.487550169f, -0.48888889f, -0.490226477f, -0.491562903f,
+	-0.492898196f, -0.494232297f, -0.495565265f, -0.496897042f, -0.498227656f, -0.499557108f, -0.500885367f, -0.502212465f,
+	-0.50353837f, -0.504863083f, -0.506186664f, -0.507508993f, -0.50883013f, -0.510150075f, -0.511468828f, -0.512786388f,
+	-0.514102757f, -0.515417874f, -0.516731799f, -0.518044531f, -0.519356012f, -0.520666242f, -0.521975279f, -0.523283124f,
+	-0.524589658f, -0.525895f, -0.527199149f, -0.528501987f, -0.529803634f, -0.531104028f, -0.532403111f, -0.533701003f,
+	-0.534997642f, -0.53629297f, -0.537587047f, -0.538879931f, -0.540171444f, -0.541461766f, -0.542750776f, -0.544038534f,
+	-0.545324981f, -0.546610177f, -0.547894061f, -0.549176633f, -0.550457954f, -0.551737964f, -0.553016722f, -0.554294109f,
+	-0.555570245f, -0.556845009f, -0.558118522f, -0.559390724f, -0.560661554f, -0.561931133f, -0.563199341f, -0.564466238f,
+	-0.565731823f, -0.566996038f, -0.568258941f, -0.569520533f, -0.570780754f, -0.572039604f, -0.573297143f, -0.57455337f,
+	-0.575808167f, -0.577061653f, -0.578313768f, -0.579564571f, -0.580813944f, -0.582062006f, -0.583308637f, -0.584553957f,
+	-0.585797846f, -0.587040365f, -0.588281572f, -0.589521289f, -0.590759695f, -0.59199667f, -0.593232274f, -0.594466507f,
+	-0.59569931f, -0.596930683f, -0.598160684f, -0.599389315f, -0.600616455f, -0.601842225f, -0.603066623f, -0.604289532f,
+	-0.605511069f, -0.606731117f, -0.607949793f, -0.609167039f, -0.610382795f, -0.61159718f, -0.612810075f, -0.61402154f,
+	-0.615231574f, -0.616440177f, -0.61764729f, -0.618852973f, -0.620057225f, -0.621259987f, -0.622461259f, -0.623661101f,
+	-0.624859512f, -0.626056373f, -0.627251804f, -0.628445745f, -0.629638255f, -0.630829215f, -0.632018745f, -0.633206785f,
+	-0.634393275f, -0.635578334f, -0.636761844f, -0.637943923f, -0.639124453f, -0.640303493f, -0.641481042f, -0.642657042f,
+	-0.643831551f, -0.645004511f, -0.64617604f, -0.64734596f, -0.64851439f, -0.64968133f, -0.65084666f, -0.65201056f,
+	-0.653172851f, -0.654333591f, -0.655492842f, -0.656650543f, -0.657806695f, -0.658961296f, -0.660114348f, -0.66126585f,
+	-0.662415802f, -0.663564146f, -0.664710999f, -0.665856242f, -0.666999936f, -0.668142021f, -0.669282615f, -0.670421541f,
+	-0.671558976f, -0.672694743f, -0.673829019f, -0.674961627f, -0.676092684f, -0.677222192f, -0.678350031f, -0.679476321f,
+	-0.680601001f, -0.681724072f, -0.682845533f, -0.683965385f, -0.685083687f, -0.686200321f, -0.687315345f, -0.68842876f,
+	-0.689540565f, -0.690650702f, -0.691759229f, -0.692866147f, -0.693971455f, -0.695075095f, -0.696177125f, -0.697277486f,
+	-0.698376238f, -0.699473321f, -0.700568795f, -0.7016626f, -0.702754736f, -0.703845263f, -0.704934061f, -0.706021249f,
+	-0.707106769f, -0.70819062f, -0.709272802f, -0.710353374f, -0.711432219f, -0.712509394f, -0.71358484f, -0.714658678f,
+	-0.715730846f, -0.716801286f, -0.717870057f, -0.718937099f, -0.720002532f, -0.721066177f, -0.722128212f, -0.72318846f,
+	-0.724247098f, -0.725303948f, -0.726359129f, -0.727412641f, -0.728464365f, -0.72951442f, -0.730562747f, -0.731609404f,
+	-0.732654274f, -0.733697414f, -0.734738886f, -0.73577857f, -0.736816585f, -0.737852812f, -0.73888731f, -0.73992008f,
+	-0.740951121f, -0.741980433f, -0.743007958f, -0.744033754f, -0.745057762f, -0.746080101f, -0.747100592f, -0.748119354f,
+	-0.749136388f, -0.750151634f, -0.751165152f, -0.752176821f, -0.753186822f, -0.754194975f, -0.755201399f, -0.756205976f,
+	-0.757208824f, -0.758209884f, -0.759209216f, -0.760206699f, -0.761202395f, -0.762196302f, -0.763188422f, -0.764178753f,
+	-0.765167236f, -0.766153991f, -0.767138898f, -0.768122017f, -0.769103348f, -0.770082831f, -0.771060526f, -0.772036374f,
+	-0.773010433f, -0.773982704f, -0.774953127f, -0.775921702f, -0.77688849f, -0.777853429f, -0.778816521f, -0.779777765f,
+	-0.780737221f, -0.781694829f, -0.78265059f, -0.783604503f, -0.784556568f, -0.785506845f, -0.786455214f, -0.787401736f,
+	-0.78834641f, -0.789289236f, -0.790230215f, -0.791169345f, -0.792106569f, -0.793041945f, -0.793975472f, -0.794907153f,
+	-0.795836926f, -0.796764791f, -0.797690868f, -0.798614979f, -0.799537241f, -0.800457656f, -0.801376164f, -0.802292824f,
+	-0.803207517f, -0.804120362f, -0.805031359f, -0.80594039f, -0.806847572f, -0.807752848f, -0.808656156f, -0.809557617f,
+	-0.81045717f, -0.811354876f, -0.812250614f, -0.813144386f, -0.81403631f, -0.814926326f, -0.815814435f, -0.816700578f,
+	-0.817584813f, -0.81846714f, -0.819347501f, -0.820225954f, -0.8211025f, -0.821977139f, -0.82284981f, -0.823720515f,
+	-0.824589312f, -0.825456142f, -0.826321065f, -0.827184021f, -0.82804507f, -0.828904092f, -0.829761207f, -0.830616415f,
+	-0.831469595f, -0.832320869f, -0.833170176f, -0.834017515f, -0.834862888f, -0.835706294f, -0.836547732f, -0.837387204f,
+	-0.838224709f, -0.839060247f, -0.839893818f, -0.840725362f, -0.841554999f, -0.84238261f, -0.843208253f, -0.84403187f,
+	-0.84485358f, -0.845673263f, -0.84649092f, -0.847306609f, -0.848120332f, -0.848932028f, -0.849741757f, -0.850549459f,
+	-0.851355195f, -0.852158904f, -0.852960587f, -0.853760302f, -0.854557991f, -0.855353653f, -0.856147349f, -0.856938958f,
+	-0.857728601f, -0.858516216f, -0.859301805f, -0.860085368f, -0.860866964f, -0.861646473f, -0.862423956f, -0.863199413f,
+	-0.863972843f, -0.864744246f, -0.865513623f, -0.866280973f, -0.867046237f, -0.867809474f, -0.868570685f, -0.86932987f,
+	-0.870086968f, -0.87084204f, -0.871595085f, -0.872346044f, -0.873094976f, -0.873841822f, -0.874586642f, -0.875329375f,
+	-0.876070082f, -0.876808703f, -0.877545297f, -0.878279805f, -0.879012227f, -0.879742622f, -0.880470872f, -0.881197095f,
+	-0.881921291f, -0.882643342f, -0.883363366f, -0.884081244f, -0.884797096f, -0.885510862f, -0.886222541f, -0.886932135f,
+	-0.887639642f, -0.888345063f, -0.889048338f, -0.889749587f, -0.890448749f, -0.891145766f, -0.891840696f, -0.892533541f,
+	-0.893224299f, -0.893912971f, -0.894599497f, -0.895283937f, -0.895966232f, -0.8966465f, -0.897324562f, -0.898000598f,
+	-0.898674488f, -0.899346232f, -0.900015891f, -0.900683403f, -0.901348829f, -0.902012169f, -0.902673304f, -0.903332353f,
+	-0.903989315f, -0.904644072f, -0.905296743f, -0.905947268f, -0.906595707f, -0.907242f, -0.907886088f, -0.90852809f,
+	-0.909168005f, -0.909805715f, -0.910441279f, -0.911074758f, -0.91170603f, -0.912335157f, -0.912962198f, -0.913587034f,
+	-0.914209783f, -0.914830327f, -0.915448725f, -0.916064978f, -0.916679084f, -0.917290986f, -0.917900801f, -0.91850841f,
+	-0.919113874f, -0.919717133f, -0.920318305f, -0.920917213f, -0.921514034f, -0.92210865f, -0.92270112f, -0.923291445f,
+	-0.923879504f, -0.924465477f, -0.925049245f, -0.925630808f, -0.926210225f, -0.926787496f, -0.927362502f, -0.927935421f,
+	-0.928506076f, -0.929074585f, -0.929640889f, -0.930205047f, -0.93076694f, -0.931326687f, -0.931884289f, -0.932439625f,
+	-0.932992816f, -0.933543801f, -0.934092522f, -0.934639156f, -0.935183525f, -0.935725689f, -0.936265647f, -0.93680346f,
+	-0.937339008f, -0.93787235f, -0.938403547f, -0.938932478f, -0.939459205f, -0.939983726f, -0.940506041f, -0.941026151f,
+	-0.941544056f, -0.942059755f, -0.94257319f, -0.943084419f, -0.943593442f, -0.944100261f, -0.944604814f, -0.945107222f,
+	-0.945607305f, -0.946105242f, -0.946600914f, -0.947094381f, -0.947585583f, -0.948074579f, -0.94856137f, -0.949045897f,
+	-0.949528158f, -0.950008273f, -0.950486064f, -0.950961649f, -0.95143503f, -0.951906145f, -0.952374995f, -0.95284164f,
+	-0.953306019f, -0.953768194f, -0.954228103f, -0.954685748f, -0.955141187f, -0.955594361f, -0.95604527f, -0.956493914f,
+	-0.956940353f, -0.957384527f, -0.957826436f, -0.958266079f, -0.958703458f, -0.959138632f, -0.95957154f, -0.960002124f,
+	-0.960430503f, -0.960856616f, -0.961280465f, -0.961702049f, -0.962121427f, -0.962538481f, -0.962953269f, -0.963365793f,
+	-0.963776052f, -0.964184046f, -0.964589775f, -0.964993238f, -0.965394437f, -0.965793371f, -0.966189981f, -0.966584384f,
+	-0.966976464f, -0.967366278f, -0.967753828f, -0.968139112f, -0.968522072f, -0.968902826f, -0.969281256f, -0.969657362f,
+	-0.970031261f, -0.970402837f, -0.970772147f, -0.971139133f, -0.971503913f, -0.97186631f, -0.972226501f, -0.972584367f,
+	-0.972939968f, -0.973293245f, -0.973644257f, -0.973992944f, -0.974339366f, -0.974683523f, -0.975025356f, -0.975364864f,
+	-0.975702107f, -0.976037085f, -0.976369739f, -0.976700068f, -0.977028131f, -0.977353871f, -0.977677345f, -0.977998495f,
+	-0.97831738f, -0.97863394f, -0.978948176f, -0.979260147f, -0.979569793f, -0.979877114f, -0.980182111f, -0.980484843f,
+	-0.980785251f, -0.981083393f, -0.981379211f, -0.981672704f, -0.981963873f, -0.982252717f, -0.982539296f, -0.982823551f,
+	-0.983105481f, -0.983385086f, -0.983662426f, -0.983937442f, -0.984210074f, -0.984480441f, -0.984748483f, -0.98501426f,
+	-0.985277653f, -0.985538721f, -0.985797524f, -0.986053944f, -0.986308098f, -0.986559927f, -0.986809373f, -0.987056553f,
+	-0.987301409f, -0.987543941f, -0.987784147f, -0.988022029f, -0.988257587f, -0.98849082f, -0.988721669f, -0.988950253f,
+	-0.989176512f, -0.989400446f, -0.989621997f, -0.989841282f, -0.990058184f, -0.99027282f, -0.990485072f, -0.990695f,
+	-0.990902662f, -0.991107941f, -0.991310835f, -0.991511464f, -0.991709769f, -0.991905689f, -0.992099285f, -0.992290616f,
+	-0.992479563f, -0.992666125f, -0.992850423f, -0.993032336f, -0.993211925f, -0.993389189f, -0.993564129f, -0.993736744f,
+	-0.993906975f, -0.994074881f, -0.994240463f, -0.99440366f, -0.994564593f, -0.994723141f, -0.994879305f, -0.995033205f,
+	-0.99518472f, -0.99533391f, -0.995480776f, -0.995625257f, -0.995767415f, -0.995907247f, -0.996044695f, -0.996179819f,
+	-0.996312618f, -0.996443033f, -0.996571124f, -0.996696889f, -0.996820271f, -0.996941328f, -0.997060061f, -0.997176409f,
+	-0.997290432f, -0.997402132f, -0.997511446f, -0.997618437f, -0.997723043f, -0.997825325f, -0.997925282f, -0.998022854f,
+	-0.998118103f, -0.998211026f, -0.998301566f, -0.998389721f, -0.998475552f, -0.998559058f, -0.998640239f, -0.998719037f,
+	-0.99879545f, -0.998869538f, -0.998941302f, -0.999010682f, -0.999077737f, -0.999142408f, -0.999204755f, -0.999264777f,
+	-0.999322355f, -0.999377668f, -0.999430597f, -0.999481201f, -0.999529421f, -0.999575317f, -0.999618828f, -0.999660015f,
+	-0.999698818f, -0.999735296f, -0.99976939f, -0.999801159f, -0.999830604f, -0.999857664f, -0.99988234f, -0.999904692f,
+	-0.999924719f, -0.999942362f, -0.999957621f, -0.999970615f, -0.999981165f, -0.99998939f, -0.999995291f, -0.999998808f,
+	-1.0f, -0.999998808f, -0.999995291f, -0.99998939f, -0.999981165f, -0.999970615f, -0.999957621f, -0.999942362f,
+	-0.999924719f, -0.999904692f, -0.99988234f, -0.999857664f, -0.999830604f, -0.999801159f, -0.99976939f, -0.999735296f,
+	-0.999698818f, -0.999660015f, -0.999618828f, -0.999575317f, -0.999529421f, -0.999481201f, -0.999430597f, -0.999377668f,
+	-0.999322355f, -0.999264777f, -0.999204755f, -0.999142408f, -0.999077737f, -0.999010682f, -0.998941302f, -0.998869538f,
+	-0.99879545f, -0.998719037f, -0.998640239f, -0.998559058f, -0.998475552f, -0.998389721f, -0.998301566f, -0.998211026f,
+	-0.998118103f, -0.998022854f, -0.997925282f, -0.997825325f, -0.997723043f, -0.997618437f, -0.997511446f, -0.997402132f,
+	-0.997290432f, -0.997176409f, -0.997060061f, -0.996941328f, -0.996820271f, -0.996696889f, -0.996571124f, -0.996443033f,
+	-0.996312618f, -0.996179819f, -0.996044695f, -0.995907247f, -0.995767415f, -0.995625257f, -0.995480776f, -0.99533391f,
+	-0.99518472f, -0.995033205f, -0.994879305f, -0.994723141f, -0.994564593f, -0.99440366f, -0.994240463f, -0.994074881f,
+	-0.993906975f, -0.993736744f, -0.993564129f, -0.993389189f, -0.993211925f, -0.993032336f, -0.992850423f, -0.992666125f,
+	-0.992479563f, -0.992290616f, -0.992099285f, -0.991905689f, -0.991709769f, -0.991511464f, -0.991310835f, -0.991107941f,
+	-0.990902662f, -0.990695f, -0.990485072f, -0.99027282f, -0.990058184f, -0.989841282f, -0.989621997f, -0.989400446f,
+	-0.989176512f, -0.988950253f, -0.988721669f, -0.98849082f, -0.988257587f, -0.988022029f, -0.987784147f, -0.987543941f,
+	-0.987301409f, -0.987056553f, -0.986809373f, -0.986559927f, -0.986308098f, -0.986053944f, -0.985797524f, -0.985538721f,
+	-0.985277653f, -0.98501426f, -0.984748483f, -0.984480441f, -0.984210074f, -0.983937442f, -0.983662426f, -0.983385086f,
+	-0.983105481f, -0.982823551f, -0.982539296f, -0.982252717f, -0.981963873f, -0.981672704f, -0.981379211f, -0.981083393f,
+	-0.980785251f, -0.980484843f, -0.980182111f, -0.979877114f, -0.979569793f, -0.979260147f, -0.978948176f, -0.97863394f,
+	-0.97831738f, -0.977998495f, -0.977677345f, -0.977353871f, -0.977028131f, -0.976700068f, -0.976369739f, -0.976037085f,
+	-0.975702107f, -0.975364864f, -0.975025356f, -0.974683523f, -0.974339366f, -0.973992944f, -0.973644257f, -0.973293245f,
+	-0.972939968f, -0.972584367f, -0.972226501f, -0.97186631f, -0.971503913f, -0.971139133f, -0.970772147f, -0.970402837f,
+	-0.970031261f, -0.969657362f, -0.969281256f, -0.968902826f, -0.968522072f, -0.968139112f, -0.967753828f, -0.967366278f,
+	-0.966976464f, -0.966584384f, -0.966189981f, -0.965793371f, -0.965394437f, -0.964993238f, -0.964589775f, -0.964184046f,
+	-0.963776052f, -0.963365793f, -0.962953269f, -0.962538481f, -0.962121427f, -0.961702049f, -0.961280465f, -0.960856616f,
+	-0.960430503f, -0.960002124f, -0.95957154f, -0.959138632f, -0.958703458f, -0.958266079f, -0.957826436f, -0.957384527f,
+	-0.956940353f, -0.956493914f, -0.95604527f, -0.955594361f, -0.955141187f, -0.954685748f, -0.954228103f, -0.953768194f,
+	-0.953306019f, -0.95284164f, -0.952374995f, -0.951906145f, -0.95143503f, -0.950961649f, -0.950486064f, -0.950008273f,
+	-0.949528158f, -0.949045897f, -0.94856137f, -0.948074579f, -0.947585583f, -0.947094381f, -0.946600914f, -0.946105242f,
+	-0.945607305f, -0.945107222f, -0.944604814f, -0.944100261f, -0.943593442f, -0.943084419f, -0.94257319f, -0.942059755f,
+	-0.941544056f, -0.941026151f, -0.940506041f, -0.939983726f, -0.939459205f, -0.938932478f, -0.938403547f, -0.93787235f,
+	-0.937339008f, -0.93680346f, -0.936265647f, -0.935725689f, -0.935183525f, -0.934639156f, -0.934092522f, -0.933543801f,
+	-0.932992816f, -0.932439625f, -0.931884289f, -0.931326687f, -0.93076694f, -0.930205047f, -0.929640889f, -0.929074585f,
+	-0.928506076f, -0.927935421f, -0.927362502f, -0.926787496f, -0.926210225f, -0.925630808f, -0.925049245f, -0.924465477f,
+	-0.923879504f, -0.923291445f, -0.92270112f, -0.92210865f, -0.921514034f, -0.920917213f, -0.920318305f, -0.919717133f,
+	-0.919113874f, -0.91850841f, -0.917900801f, -0.917290986f, -0.916679084f, -0.916064978f, -0.915448725f, -0.914830327f,
+	-0.914209783f, -0.913587034f, -0.912962198f, -0.912335157f, -0.91170603f, -0.911074758f, -0.910441279f, -0.909805715f,
+	-0.909168005f, -0.90852809f, -0.907886088f, -0.907242f, -0.906595707f, -0.905947268f, -0.905296743f, -0.904644072f,
+	-0.903989315f, -0.903332353f, -0.902673304f, -0.902012169f, -0.901348829f, -0.900683403f, -0.900015891f, -0.899346232f,
+	-0.898674488f, -0.898000598f, -0.897324562f, -0.8966465f, -0.895966232f, -0.895283937f, -0.894599497f, -0.893912971f,
+	-0.893224299f, -0.892533541f, -0.891840696f, -0.891145766f, -0.890448749f, -0.889749587f, -0.889048338f, -0.888345063f,
+	-0.887639642f, -0.886932135f, -0.886222541f, -0.885510862f, -0.884797096f, -0.884081244f, -0.883363366f, -0.882643342f,
+	-0.881921291f, -0.881197095f, -0.880470872f, -0.879742622f, -0.879012227f, -0.878279805f, -0.877545297f, -0.876808703f,
+	-0.876070082f, -0.875329375f, -0.874586642f, -0.873841822f, -0.873094976f, -0.872346044f, -0.871595085f, -0.87084204f,
+	-0.870086968f, -0.86932987f, -0.868570685f, -0.867809474f, -0.867046237f, -0.866280973f, -0.865513623f, -0.864744246f,
+	-0.863972843f, -0.863199413f, -0.862423956f, -0.861646473f, -0.860866964f, -0.860085368f, -0.859301805f, -0.858516216f,
+	-0.857728601f, -0.856938958f, -0.856147349f, -0.855353653f, -0.854557991f, -0.853760302f, -0.852960587f, -0.852158904f,
+	-0.851355195f, -0.850549459f, -0.849741757f, -0.848932028f, -0.848120332f, -0.847306609f, -0.84649092f, -0.845673263f,
+	-0.84485358f, -0.84403187f, -0.843208253f, -0.84238261f, -0.841554999f, -0.840725362f, -0.839893818f, -0.839060247f,
+	-0.838224709f, -0.837387204f, -0.836547732f, -0.835706294f, -0.834862888f, -0.834017515f, -0.833170176f, -0.832320869f,
+	-0.831469595f, -0.830616415f, -0.829761207f, -0.828904092f, -0.82804507f, -0.827184021f, -0.826321065f, -0.825456142f,
+	-0.824589312f, -0.823720515f, -0.82284981f, -0.821977139f, -0.8211025f, -0.820225954f, -0.819347501f, -0.81846714f,
+	-0.817584813f, -0.816700578f, -0.815814435f, -0.814926326f, -0.81403631f, -0.813144386f, -0.812250614f, -0.811354876f,
+	-0.81045717f, -0.809557617f, -0.808656156f, -0.807752848f, -0.806847572f, -0.80594039f, -0.805031359f, -0.804120362f,
+	-0.803207517f, -0.802292824f, -0.801376164f, -0.800457656f, -0.799537241f, -0.798614979f, -0.797690868f, -0.796764791f,
+	-0.795836926f, -0.794907153f, -0.793975472f, -0.793041945f, -0.792106569f, -0.791169345f, -0.790230215f, -0.789289236f,
+	-0.78834641f, -0.787401736f, -0.786455214f, -0.785506845f, -0.784556568f, -0.783604503f, -0.78265059f, -0.781694829f,
+	-0.780737221f, -0.779777765f, -0.778816521f, -0.777853429f, -0.77688849f, -0.775921702f, -0.774953127f, -0.773982704f,
+	-0.773010433f, -0.772036374f, -0.771060526f, -0.770082831f, -0.769103348f, -0.768122017f, -0.767138898f, -0.766153991f,
+	-0.765167236f, -0.764178753f, -0.763188422f, -0.762196302f, -0.761202395f, -0.760206699f, -0.759209216f, -0.758209884f,
+	-0.757208824f, -0.756205976f, -0.755201399f, -0.754194975f, -0.753186822f, -0.752176821f, -0.751165152f, -0.750151634f,
+	-0.749136388f, -0.748119354f, -0.747100592f, -0.746080101f, -0.745057762f, -0.744033754f, -0.743007958f, -0.741980433f,
+	-0.740951121f, -0.73992008f, -0.73888731f, -0.737852812f, -0.736816585f, -0.73577857f, -0.734738886f, -0.733697414f,
+	-0.732654274f, -0.731609404f, -0.730562747f, -0.72951442f, -0.728464365f, -0.727412641f, -0.726359129f, -0.725303948f,
+	-0.724247098f, -0.72318846f, -0.722128212f, -0.721066177f, -0.720002532f, -0.718937099f, -0.717870057f, -0.716801286f,
+	-0.715730846f, -0.714658678f, -0.71358484f, -0.712509394f, -0.711432219f, -0.710353374f, -0.709272802f, -0.70819062f,
+	-0.707106769f, -0.706021249f, -0.704934061f, -0.703845263f, -0.702754736f, -0.7016626f, -0.700568795f, -0.699473321f,
+	-0.698376238f, -0.697277486f, -0.696177125f, -0.695075095f, -0.693971455f, -0.692866147f, -0.691759229f, -0.690650702f,
+	-0.689540565f, -0.68842876f, -0.687315345f, -0.686200321f, -0.685083687f, -0.683965385f, -0.682845533f, -0.681724072f,
+	-0.680601001f, -0.679476321f, -0.678350031f, -0.677222192f, -0.676092684f, -0.674961627f, -0.673829019f, -0.672694743f,
+	-0.671558976f, -0.670421541f, -0.669282615f, -0.668142021f, -0.666999936f, -0.665856242f, -0.664710999f, -0.663564146f,
+	-0.662415802f, -0.66126585f, -0.660114348f, -0.658961296f, -0.657806695f, -0.656650543f, -0.655492842f, -0.654333591f,
+	-0.653172851f, -0.65201056f, -0.65084666f, -0.64968133f, -0.64851439f, -0.64734596f, -0.64617604f, -0.645004511f,
+	-0.643831551f, -0.642657042f, -0.641481042f, -0.640303493f, -0.639124453f, -0.637943923f, -0.636761844f, -0.635578334f,
+	-0.634393275f, -0.633206785f, -0.632018745f, -0.630829215f, -0.629638255f, -0.628445745f, -0.627251804f, -0.626056373f,
+	-0.624859512f, -0.623661101f, -0.622461259f, -0.621259987f, -0.620057225f, -0.618852973f, -0.61764729f, -0.616440177f,
+	-0.615231574f, -0.61402154f, -0.612810075f, -0.61159718f, -0.610382795f, -0.609167039f, -0.607949793f, -0.606731117f,
+	-0.605511069f, -0.604289532f, -0.603066623f, -0.601842225f, -0.600616455f, -0.599389315f, -0.598160684f, -0.596930683f,
+	-0.59569931f, -0.594466507f, -0.593232274f, -0.59199667f, -0.590759695f, -0.589521289f, -0.588281572f, -0.587040365f,
+	-0.585797846f, -0.584553957f, -0.583308637f, -0.582062006f, -0.580813944f, -0.579564571f, -0.578313768f, -0.577061653f,
+	-0.575808167f, -0.57455337f, -0.573297143f, -0.572039604f, -0.570780754f, -0.569520533f, -0.568258941f, -0.566996038f,
+	-0.565731823f, -0.564466238f, -0.563199341f, -0.561931133f, -0.560661554f, -0.559390724f, -0.558118522f, -0.556845009f,
+	-0.555570245f, -0.554294109f, -0.553016722f, -0.551737964f, -0.550457954f, -0.549176633f, -0.547894061f, -0.546610177f,
+	-0.545324981f, -0.544038534f, -0.542750776f, -0.541461766f, -0.540171444f, -0.538879931f, -0.537587047f, -0.53629297f,
+	-0.534997642f, -0.533701003f, -0.532403111f, -0.531104028f, -0.529803634f, -0.528501987f, -0.527199149f, -0.525895f,
+	-0.524589658f, -0.523283124f, -0.521975279f, -0.520666242f, -0.519356012f, -0.518044531f, -0.516731799f, -0.515417874f,
+	-0.514102757f, -0.512786388f, -0.511468828f, -0.510150075f, -0.50883013f, -0.507508993f, -0.506186664f, -0.504863083f,
+	-0.50353837f, -0.502212465f, -0.500885367f, -0.499557108f, -0.498227656f, -0.496897042f, -0.495565265f, -0.494232297f,
+	-0.492898196f, -0.491562903f, -0.490226477f, -0.48888889f, -0.487550169f, -0.486210287f, -0.484869242f, -0.483527064f,
+	-0.482183784f, -0.480839342f, -0.479493767f, -0.47814706f, -0.47679922f, -0.475450277f, -0.474100202f, -0.472749025f,
+	-0.471396744f, -0.470043331f, -0.468688816f, -0.467333198f, -0.465976506f, -0.464618683f, -0.463259786f, -0.461899787f,
+	-0.460538715f, -0.45917654f, -0.457813293f, -0.456448972f, -0.455083579f, -0.453717113f, -0.452349573f, -0.450980991f,
+	-0.449611336f, -0.448240608f, -0.446868837f, -0.445496023f, -0.444122136f, -0.442747235f, -0.441371262f, -0.439994276f,
+	-0.438616246f, -0.437237173f, -0.435857087f, -0.434475958f, -0.433093816f, -0.43171066f, -0.430326492f, -0.42894128f,
+	-0.427555084f, -0.426167876f, -0.424779683f, -0.423390478f, -0.422000259f, -0.420609087f, -0.419216901f, -0.417823702f,
+	-0.416429549f, -0.415034413f, -0.413638324f, -0.41224122f, -0.410843164f, -0.409444153f, -0.408044159f, -0.406643212f,
+	-0.405241311f, -0.403838456f, -0.402434647f, -0.401029885f, -0.399624199f, -0.398217559f, -0.396809995f, -0.395401478f,
+	-0.393992037f, -0.392581671f, -0.391170382f, -0.38975817f, -0.388345033f, -0.386931002f, -0.385516047f, -0.384100199f,
+	-0.382683426f, -0.381265759f, -0.379847199f, -0.378427744f, -0.377007425f, -0.375586182f, -0.374164075f, -0.372741073f,
+	-0.371317208f, -0.369892448f, -0.368466824f, -0.367040336f, -0.365612984f, -0.364184797f, -0.362755716f, -0.3613258f,
+	-0.359895051f, -0.358463407f, -0.357030958f, -0.355597675f, -0.354163527f, -0.352728546f, -0.351292759f, -0.349856138f,
+	-0.348418683f, -0.346980423f, -0.345541328f, -0.344101429f, -0.342660725f, -0.341219217f, -0.339776874f, -0.338333756f,
+	-0.336889863f, -0.335445136f, -0.333999664f, -0.332553357f, -0.331106305f, -0.329658449f, -0.328209847f, -0.326760441f,
+	-0.32531029f, -0.323859364f, -0.322407693f, -0.320955247f, -0.319502026f, -0.31804809f, -0.316593379f, -0.315137923f,
+	-0.313681751f, -0.312224805f, -0.310767144f, -0.309308767f, -0.307849646f, -0.306389809f, -0.304929227f, -0.303467959f,
+	-0.302005947f, -0.300543249f, -0.299079835f, -0.297615707f, -0.296150893f, -0.294685364f, -0.293219149f, -0.291752249f,
+	-0.290284663f, -0.288816422f, -0.287347466f, -0.285877824f, -0.284407526f, -0.282936573f, -0.281464934f, -0.27999264f,
+	-0.27851969f, -0.277046084f, -0.275571823f, -0.274096906f, -0.272621363f, -0.271145165f, -0.269668311f, -0.268190861f,
+	-0.266712755f, -0.265234023f, -0.263754666f, -0.262274712f, -0.260794103f, -0.259312928f, -0.257831097f, -0.25634867f,
+	-0.254865646f, -0.253382027f, -0.251897812f, -0.250413001f, -0.248927608f, -0.24744162f, -0.24595505f, -0.244467899f,
+	-0.242980182f, -0.241491884f, -0.24000302f, -0.238513589f, -0.237023607f, -0.235533059f, -0.234041959f, -0.232550308f,
+	-0.231058106f, -0.229565367f, -0.228072077f, -0.226578265f, -0.225083917f, -0.223589033f, -0.222093627f, -0.220597684f,
+	-0.219101235f, -0.21760428f, -0.216106802f, -0.214608818f, -0.213110313f, -0.211611331f, -0.210111842f, -0.208611846f,
+	-0.207111374f, -0.205610409f, -0.204108968f, -0.202607036f, -0.201104641f, -0.199601755f, -0.198098406f, -0.196594596f,
+	-0.195090324f, -0.19358559f, -0.192080393f, -0.19057475f, -0.18906866f, -0.187562123f, -0.186055154f, -0.184547737f,
+	-0.183039889f, -0.181531608f, -0.180022895f, -0.178513765f, -0.177004218f, -0.175494254f, -0.173983872f, -0.172473088f,
+	-0.170961887f, -0.169450298f, -0.167938292f, -0.166425899f, -0.164913118f, -0.16339995f, -0.161886394f, -0.160372451f,
+	-0.15885815f, -0.157343462f, -0.155828401f, -0.154312968f, -0.152797192f, -0.151281044f, -0.149764538f, -0.148247674f,
+	-0.146730468f, -0.145212919f, -0.143695027f, -0.142176807f, -0.140658244f, -0.139139339f, -0.137620121f, -0.136100575f,
+	-0.134580702f, -0.13306053f, -0.13154003f, -0.130019218f, -0.128498107f, -0.126976699f, -0.125454977f, -0.123932973f,
+	-0.122410677f, -0.120888084f, -0.119365215f, -0.117842063f, -0.116318628f, -0.114794925f, -0.113270953f, -0.111746714f,
+	-0.110222206f, -0.108697444f, -0.107172422f, -0.105647154f, -0.104121633f, -0.102595866f, -0.10106986f, -0.0995436162f,
+	-0.0980171412f, -0.0964904279f, -0.0949634984f, -0.093436338f, -0.0919089541f, -0.0903813615f, -0.0888535529f, -0.0873255357f,
+	-0.0857973099f, -0.0842688903f, -0.0827402622f, -0.0812114477f, -0.0796824396f, -0.0781532452f, -0.0766238645f, -0.0750942975f,
+	-0.0735645667f, -0.0720346496f, -0.070504576f, -0.068974331f, -0.0674439222f, -0.0659133494f, -0.0643826276f, -0.0628517568f,
+	-0.061320737f, -0.0597895719f, -0.0582582653f, -0.0567268208f, -0.0551952459f, -0.0536635369f, -0.052131705f, -0.0505997501f,
+	-0.0490676761f, -0.0475354828f, -0.0460031815f, -0.0444707721f, -0.0429382585f, -0.0414056405f, -0.0398729257f, -0.0383401215f,
+	-0.0368072242f, -0.0352742374f, -0.0337411724f, -0.0322080255f, -0.030674804f, -0.029141508f, -0.027608145f, -0.0260747187f,
+	-0.024541229f, -0.0230076816f, -0.0214740802f, -0.0199404284f, -0.0184067301f, -0.0168729872f, -0.015339206f, -0.0138053885f,
+	-0.0122715384f, -0.0107376594f, -0.00920375437f, -0.00766982883f, -0.00613588467f, -0.00460192608f, -0.00306795677f, -0.00153398013f,
+	0.0f,
+#else
+#error "no generated sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c with a wider range"
+#endif
+#endif
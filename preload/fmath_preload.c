@@ -0,0 +1,127 @@
+// LD_PRELOAD interposer: routes libm's sinf/cosf/tanf/atanf/asinf/acosf/sinhf/coshf/
+// tanhf/expf/logf/sqrtf and the matching libmvec vector entry points
+// (_ZGV{b,c,d,e}N{4,8,8,16}v_*) of unmodified binaries to fmath. Build as
+// libfmath_preload.so (see README) and run:
+//
+//   LD_PRELOAD=./libfmath_preload.so ./app
+//   FMATH_PRELOAD_FUNCS=sinf,cosf LD_PRELOAD=./libfmath_preload.so ./app
+//
+// FMATH_PRELOAD_FUNCS is a comma-separated allowlist of scalar names; unset means all.
+// Functions not on the list (and their vector variants) forward to the next definition
+// in lookup order, normally glibc's libm/libmvec.
+
+#define _GNU_SOURCE
+#include <dlfcn.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "fmath.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+#define FMATH_PRELOAD_EXPORT __attribute__((visibility("default")))
+
+static int fmath_preload_allowed(const char *name) {
+	const char *list = getenv("FMATH_PRELOAD_FUNCS");
+	if (!list) return 1;
+	size_t len = strlen(name);
+	for (const char *p = list;;) {
+		const char *end = strchr(p, ',');
+		size_t n = end ? (size_t)(end - p) : strlen(p);
+		if (n == len && strncmp(p, name, len) == 0) return 1;
+		if (!end) return 0;
+		p = end + 1;
+	}
+}
+
+// Resolved lazily on first call (other libraries' constructors may call us before ours
+// would run); racing threads store the same pointer.
+typedef float (*fmath_preload_scalar_fn)(float);
+
+#define FMATH_PRELOAD_SCALAR(fn) \
+	static fmath_preload_scalar_fn fmath_preload_##fn; \
+	static fmath_preload_scalar_fn fmath_preload_resolve_##fn(void) { \
+		fmath_preload_scalar_fn f = fmath_##fn; \
+		if (!fmath_preload_allowed(#fn)) { \
+			fmath_preload_scalar_fn next = (fmath_preload_scalar_fn)dlsym(RTLD_NEXT, #fn); \
+			if (next) f = next; \
+		} \
+		__atomic_store_n(&fmath_preload_##fn, f, __ATOMIC_RELEASE); \
+		return f; \
+	} \
+	FMATH_PRELOAD_EXPORT float fn(float x) { \
+		fmath_preload_scalar_fn f = __atomic_load_n(&fmath_preload_##fn, __ATOMIC_ACQUIRE); \
+		if (__builtin_expect(f == NULL, 0)) f = fmath_preload_resolve_##fn(); \
+		return f(x); \
+	}
+
+FMATH_PRELOAD_SCALAR(sinf)
+FMATH_PRELOAD_SCALAR(cosf)
+FMATH_PRELOAD_SCALAR(tanf)
+FMATH_PRELOAD_SCALAR(atanf)
+FMATH_PRELOAD_SCALAR(asinf)
+FMATH_PRELOAD_SCALAR(acosf)
+FMATH_PRELOAD_SCALAR(sinhf)
+FMATH_PRELOAD_SCALAR(coshf)
+FMATH_PRELOAD_SCALAR(tanhf)
+FMATH_PRELOAD_SCALAR(expf)
+FMATH_PRELOAD_SCALAR(logf)
+FMATH_PRELOAD_SCALAR(sqrtf)
+
+#undef FMATH_PRELOAD_SCALAR
+
+#if defined(__x86_64__) && FMATH_ENABLE_VECTOR_ABI
+
+// One libmvec symbol: fmath's own _ZGV*_fmath_<fn> when allowed, else the next
+// definition, else lane-by-lane through the (non-interposed) scalar entry above.
+#define FMATH_PRELOAD_VECTOR(isa, lanes, vt, isa_flags, fn) \
+	vt _ZGV##isa##N##lanes##v_fmath_##fn(vt x); \
+	typedef vt (*fmath_preload_##isa##_##fn##_fn)(vt); \
+	static fmath_preload_##isa##_##fn##_fn fmath_preload_##isa##_##fn; \
+	__attribute__((target(isa_flags))) static vt fmath_preload_lanes_##isa##_##fn(vt x) { \
+		float v[lanes]; \
+		memcpy(v, &x, sizeof v); \
+		for (int i = 0; i < (lanes); ++i) v[i] = fn(v[i]); \
+		memcpy(&x, v, sizeof v); \
+		return x; \
+	} \
+	static fmath_preload_##isa##_##fn##_fn fmath_preload_resolve_##isa##_##fn(void) { \
+		fmath_preload_##isa##_##fn##_fn f = _ZGV##isa##N##lanes##v_fmath_##fn; \
+		if (!fmath_preload_allowed(#fn)) { \
+			f = (fmath_preload_##isa##_##fn##_fn)dlsym(RTLD_NEXT, "_ZGV" #isa "N" #lanes "v_" #fn); \
+			if (!f) f = fmath_preload_lanes_##isa##_##fn; \
+		} \
+		__atomic_store_n(&fmath_preload_##isa##_##fn, f, __ATOMIC_RELEASE); \
+		return f; \
+	} \
+	__attribute__((target(isa_flags))) FMATH_PRELOAD_EXPORT vt _ZGV##isa##N##lanes##v_##fn(vt x) { \
+		fmath_preload_##isa##_##fn##_fn f = __atomic_load_n(&fmath_preload_##isa##_##fn, __ATOMIC_ACQUIRE); \
+		if (__builtin_expect(f == NULL, 0)) f = fmath_preload_resolve_##isa##_##fn(); \
+		return f(x); \
+	}
+
+// libmvec has no sqrtf variants
+#define FMATH_PRELOAD_VECTOR_ALL(fn) \
+	FMATH_PRELOAD_VECTOR(b, 4, __m128, "sse2", fn) \
+	FMATH_PRELOAD_VECTOR(c, 8, __m256, "avx", fn) \
+	FMATH_PRELOAD_VECTOR(d, 8, __m256, "avx2", fn) \
+	FMATH_PRELOAD_VECTOR(e, 16, __m512, "avx512f", fn)
+
+FMATH_PRELOAD_VECTOR_ALL(sinf)
+FMATH_PRELOAD_VECTOR_ALL(cosf)
+FMATH_PRELOAD_VECTOR_ALL(tanf)
+FMATH_PRELOAD_VECTOR_ALL(atanf)
+FMATH_PRELOAD_VECTOR_ALL(asinf)
+FMATH_PRELOAD_VECTOR_ALL(acosf)
+FMATH_PRELOAD_VECTOR_ALL(sinhf)
+FMATH_PRELOAD_VECTOR_ALL(coshf)
+FMATH_PRELOAD_VECTOR_ALL(tanhf)
+FMATH_PRELOAD_VECTOR_ALL(expf)
+FMATH_PRELOAD_VECTOR_ALL(logf)
+
+#undef FMATH_PRELOAD_VECTOR_ALL
+#undef FMATH_PRELOAD_VECTOR
+
+#endif
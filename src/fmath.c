@@ -1,237 +1,359 @@
-#include "fmath.h"
+#define FMATH_DEFINE_SHARED 1 /* the library copy of the LUT and huge-argument reduction */
+#include "fmath_internal.h"
 
-#include <math.h>
-#include <string.h>
 #include <stdbool.h>
+#include <stdlib.h>
 
-#ifndef FMATH_PI
-#define FMATH_PI 3.14159265358979323846f
-#endif
-#ifndef FMATH_TWO_PI
-#define FMATH_TWO_PI 6.28318530717958647692f
-#endif
-#ifndef FMATH_INV_TWO_PI
-#define FMATH_INV_TWO_PI 0.15915494309189533577f /* 1/(2*pi) */
-#endif
-#ifndef FMATH_LN2
-#define FMATH_LN2 0.69314718055994530942f
-#endif
-#ifndef FMATH_INV_LN2
-#define FMATH_INV_LN2 1.4426950408889634074f /* 1/ln(2) */
-#endif
+// Defined for this build's layout only; see fmath_layout_check in fmath.h
+const char FMATH_LAYOUT_NAME(fmath_layout) = 0;
 
-// Internal LUT for sin; cos derived via phase shift
-enum {
-	FMATH_TABLE_SIZE = 1 << FMATH_TABLE_BITS,
-	FMATH_TABLE_MASK = FMATH_TABLE_SIZE - 1
-};
+// Tables are static; kept for API compatibility. Safe to call any number of times,
+// from any thread, or not at all.
+void fmath_init(void) {
+}
 
-static float fmath_sin_lut[FMATH_TABLE_SIZE];
-static float fmath_index_scale = 0.0f; // FMATH_TABLE_SIZE / (2*pi)
-static int fmath_is_initialized = 0;
-
-FMATH_INLINE void fmath_init_once(void) {
-	if (fmath_is_initialized) return;
-	fmath_index_scale = (float)FMATH_TABLE_SIZE * (1.0f / FMATH_TWO_PI);
-	const float step = FMATH_TWO_PI / (float)FMATH_TABLE_SIZE;
-#if FMATH_LUT_INIT_WITH_LIBM
-	for (int i = 0; i < FMATH_TABLE_SIZE; ++i) {
-		fmath_sin_lut[i] = sinf(step * (float)i);
-	}
-#else
-	// Fallback: compute via 5th-order Taylor around 0 (less accurate)
-	for (int i = 0; i < FMATH_TABLE_SIZE; ++i) {
-		float x = step * (float)i;
-		float x2 = x * x;
-		float x3 = x2 * x;
-		float x5 = x3 * x2;
-		fmath_sin_lut[i] = x - (x3 * (1.0f / 6.0f)) + (x5 * (1.0f / 120.0f));
+// Out-of-line scalar API over the kernels in fmath_inline.h
+float fmath_sinf(float x) {
+	return fmath_sinf_impl(x);
+}
+
+float fmath_cosf(float x) {
+	return fmath_cosf_impl(x);
+}
+
+void fmath_sincosf(float x, float *s, float *c) {
+	fmath_sincosf_impl(x, s, c);
+}
+
+// Public entry point of a tiered function at the build's tier. Clients see these declared
+// const (FMATH_VECTOR_DECL), so they must not read the runtime tier: the compiler may
+// reuse a result across fmath_set_precision.
+#define FMATH_SCALAR_TIERED(fn) \
+	float fmath_##fn(float x) { \
+		return fmath_##fn##_impl(x, (fmath_precision)FMATH_PRECISION); \
 	}
-#endif
-	fmath_is_initialized = 1;
+
+FMATH_SCALAR_TIERED(expf)
+FMATH_SCALAR_TIERED(logf)
+FMATH_SCALAR_TIERED(rsqrtf)
+FMATH_SCALAR_TIERED(sqrtf)
+FMATH_SCALAR_TIERED(tanf)
+FMATH_SCALAR_TIERED(atanf)
+FMATH_SCALAR_TIERED(asinf)
+FMATH_SCALAR_TIERED(acosf)
+FMATH_SCALAR_TIERED(sinhf)
+FMATH_SCALAR_TIERED(coshf)
+FMATH_SCALAR_TIERED(tanhf)
+
+#undef FMATH_SCALAR_TIERED
+
+float fmath_atan2f(float y, float x) {
+	return fmath_atan2f_impl(y, x, (fmath_precision)FMATH_PRECISION);
 }
 
-void fmath_init(void) {
-	fmath_init_once();
+float fmath_rcpf(float x) {
+	return fmath_rcpf_impl(x);
 }
 
-// Helpers for bit-casting without aliasing UB
-FMATH_INLINE uint32_t fmath_bitcast_f32_to_u32(float x) {
-	uint32_t u;
-	memcpy(&u, &x, sizeof u);
-	return u;
+int fmath_precision_tiers[FMATH_FN_COUNT] = {FMATH_PRECISION, FMATH_PRECISION, FMATH_PRECISION, FMATH_PRECISION,
+                                             FMATH_PRECISION, FMATH_PRECISION, FMATH_PRECISION, FMATH_PRECISION};
+
+fmath_precision fmath_set_precision(fmath_fn fn, fmath_precision precision) {
+	int p = (int)precision < (int)FMATH_PRECISION_FAST       ? (int)FMATH_PRECISION_FAST
+	        : (int)precision > (int)FMATH_PRECISION_ACCURATE ? (int)FMATH_PRECISION_ACCURATE
+	                                                         : (int)precision;
+	if ((unsigned)fn >= FMATH_FN_COUNT) return (fmath_precision)p;
+	__atomic_store_n(&fmath_precision_tiers[fn], p, __ATOMIC_RELAXED);
+	return (fmath_precision)p;
 }
 
-FMATH_INLINE float fmath_bitcast_u32_to_f32(uint32_t u) {
-	float x;
-	memcpy(&x, &u, sizeof x);
-	return x;
+fmath_precision fmath_get_precision(fmath_fn fn) {
+	return (unsigned)fn < FMATH_FN_COUNT ? fmath_tier(fn) : FMATH_PRECISION_FAST;
 }
 
-// Fast sinf/cosf using LUT + linear interpolation, with power-of-two table size.
-float fmath_sinf(float x) {
-	if (!fmath_is_initialized) fmath_init_once();
-	// Map x radians to table index space, wrapping via mask
-	float index_f = x * fmath_index_scale;
-	float idx_floor = floorf(index_f);
-	int i0 = ((int)idx_floor) & FMATH_TABLE_MASK;
-	int i1 = (i0 + 1) & FMATH_TABLE_MASK;
-	float t = index_f - idx_floor;
-	float s0 = fmath_sin_lut[i0];
-	float s1 = fmath_sin_lut[i1];
-	return s0 + t * (s1 - s0);
+// Array APIs
+static void fmath_scalar_sinf_array(float *dst, const float *src, size_t count) {
+	for (size_t i = 0; i < count; ++i) dst[i] = fmath_sinf(src[i]);
 }
 
-float fmath_cosf(float x) {
-	if (!fmath_is_initialized) fmath_init_once();
-	// cos(x) = sin(x + pi/2) -> phase shift by quarter table
-	float index_f = (x + 0.5f * FMATH_PI) * fmath_index_scale;
-	float idx_floor = floorf(index_f);
-	int i0 = ((int)idx_floor) & FMATH_TABLE_MASK;
-	int i1 = (i0 + 1) & FMATH_TABLE_MASK;
-	float t = index_f - idx_floor;
-	float s0 = fmath_sin_lut[i0];
-	float s1 = fmath_sin_lut[i1];
-	return s0 + t * (s1 - s0);
-}
-
-// Fast expf using magic-bias range reduction r = x * log2(e) = n + f, f in [-0.5,0.5]
-// Approximate 2^f with a short cubic polynomial, then scale by 2^n via bit trick.
-FMATH_INLINE float fmath_expf_impl(float x) {
-	if (x > 88.0f) return INFINITY;      // avoid overflow
-	if (x < -100.0f) return 0.0f;        // underflow
-
-	// r = x * log2(e) = n + f
-	float r = x * FMATH_INV_LN2;
-	// Round r to nearest integer using magic-bias trick
-	float rb = r + 12582912.0f;          // 2^23 * 1.5, works for |r| < 2^22
-	int n = (int)rb - 12582912;          // nearest integer to r
-	float f = r - (float)n;              // in approximately [-0.5, 0.5]
-
-	// 2^f ≈ 1 + f*(ln2 + f*(0.2402265 + f*0.0555041))
-	// Coefficients tuned for good speed/accuracy on [-0.5, 0.5]
-	float p = fmaf(0.05550410866f, f, 0.240226507f);
-	p = fmaf(p, f, 0.693147182f);
-	p = fmaf(p, f, 1.0f);
-
-	// two_n = 2^n via exponent bits (fast path), fallback to ldexpf otherwise
-	float two_n;
-	if (n >= -126 && n <= 127) {
-		uint32_t bits = (uint32_t)(n + 127) << 23;
-		two_n = fmath_bitcast_u32_to_f32(bits);
-	} else {
-		two_n = ldexpf(1.0f, n);
+static void fmath_scalar_cosf_array(float *dst, const float *src, size_t count) {
+	for (size_t i = 0; i < count; ++i) dst[i] = fmath_cosf(src[i]);
+}
+
+// Per-tier scalar array kernels of a tiered function
+#define FMATH_SCALAR_TIERED_ARRAY(fn) \
+	static void fmath_scalar_##fn##_array_fast(float *dst, const float *src, size_t count) { \
+		for (size_t i = 0; i < count; ++i) dst[i] = fmath_##fn##_impl(src[i], FMATH_PRECISION_FAST); \
+	} \
+	static void fmath_scalar_##fn##_array_balanced(float *dst, const float *src, size_t count) { \
+		for (size_t i = 0; i < count; ++i) dst[i] = fmath_##fn##_impl(src[i], FMATH_PRECISION_BALANCED); \
+	} \
+	static void fmath_scalar_##fn##_array_accurate(float *dst, const float *src, size_t count) { \
+		for (size_t i = 0; i < count; ++i) dst[i] = fmath_##fn##_impl(src[i], FMATH_PRECISION_ACCURATE); \
+	}
+
+FMATH_SCALAR_TIERED_ARRAY(expf)
+FMATH_SCALAR_TIERED_ARRAY(logf)
+FMATH_SCALAR_TIERED_ARRAY(sqrtf)
+FMATH_SCALAR_TIERED_ARRAY(rsqrtf)
+FMATH_SCALAR_TIERED_ARRAY(tanf)
+FMATH_SCALAR_TIERED_ARRAY(atanf)
+FMATH_SCALAR_TIERED_ARRAY(asinf)
+FMATH_SCALAR_TIERED_ARRAY(acosf)
+FMATH_SCALAR_TIERED_ARRAY(sinhf)
+FMATH_SCALAR_TIERED_ARRAY(coshf)
+FMATH_SCALAR_TIERED_ARRAY(tanhf)
+
+#undef FMATH_SCALAR_TIERED_ARRAY
+
+#define FMATH_SCALAR_ATAN2_ARRAY(tier_name, tier) \
+	static void fmath_scalar_atan2f_array_##tier_name(float *dst, const float *y, const float *x, size_t count) { \
+		for (size_t i = 0; i < count; ++i) dst[i] = fmath_atan2f_impl(y[i], x[i], tier); \
 	}
-	return two_n * p;
+
+FMATH_SCALAR_ATAN2_ARRAY(fast, FMATH_PRECISION_FAST)
+FMATH_SCALAR_ATAN2_ARRAY(balanced, FMATH_PRECISION_BALANCED)
+FMATH_SCALAR_ATAN2_ARRAY(accurate, FMATH_PRECISION_ACCURATE)
+
+#undef FMATH_SCALAR_ATAN2_ARRAY
+
+static void fmath_scalar_rcpf_array(float *dst, const float *src, size_t count) {
+	for (size_t i = 0; i < count; ++i) dst[i] = fmath_rcpf(src[i]);
 }
 
-float fmath_expf(float x) {
-	return fmath_expf_impl(x);
+static void fmath_scalar_sincosf_array(float *dst_sin, float *dst_cos, const float *src, size_t count) {
+	for (size_t i = 0; i < count; ++i) fmath_sincosf(src[i], &dst_sin[i], &dst_cos[i]);
 }
 
-// Fast logf using bit tricks: x = m * 2^e with m in [1,2). log(x)=e*ln2 + log(m)
-float fmath_logf(float x) {
-	if (x <= 0.0f) {
-		if (x == 0.0f) return -INFINITY;
-		return NAN;
+static void fmath_scalar_cisf_array(float *dst, const float *src, size_t count) {
+	for (size_t i = 0; i < count; ++i) fmath_sincosf(src[i], &dst[2 * i + 1], &dst[2 * i]);
+}
+
+static const fmath_kernel_table fmath_scalar_kernels = {
+	fmath_scalar_sinf_array,
+	fmath_scalar_cosf_array,
+	{fmath_scalar_expf_array_fast, fmath_scalar_expf_array_balanced, fmath_scalar_expf_array_accurate},
+	{fmath_scalar_logf_array_fast, fmath_scalar_logf_array_balanced, fmath_scalar_logf_array_accurate},
+	{fmath_scalar_sqrtf_array_fast, fmath_scalar_sqrtf_array_balanced, fmath_scalar_sqrtf_array_accurate},
+	{fmath_scalar_rsqrtf_array_fast, fmath_scalar_rsqrtf_array_balanced, fmath_scalar_rsqrtf_array_accurate},
+	fmath_scalar_rcpf_array,
+	{fmath_scalar_tanf_array_fast, fmath_scalar_tanf_array_balanced, fmath_scalar_tanf_array_accurate},
+	{fmath_scalar_atanf_array_fast, fmath_scalar_atanf_array_balanced, fmath_scalar_atanf_array_accurate},
+	{fmath_scalar_atan2f_array_fast, fmath_scalar_atan2f_array_balanced, fmath_scalar_atan2f_array_accurate},
+	{fmath_scalar_asinf_array_fast, fmath_scalar_asinf_array_balanced, fmath_scalar_asinf_array_accurate},
+	{fmath_scalar_acosf_array_fast, fmath_scalar_acosf_array_balanced, fmath_scalar_acosf_array_accurate},
+	{fmath_scalar_sinhf_array_fast, fmath_scalar_sinhf_array_balanced, fmath_scalar_sinhf_array_accurate},
+	{fmath_scalar_coshf_array_fast, fmath_scalar_coshf_array_balanced, fmath_scalar_coshf_array_accurate},
+	{fmath_scalar_tanhf_array_fast, fmath_scalar_tanhf_array_balanced, fmath_scalar_tanhf_array_accurate},
+	fmath_scalar_sincosf_array,
+	fmath_scalar_cisf_array,
+};
+
+#if FMATH_X86_DISPATCH
+static bool fmath_cpu_supports(fmath_isa isa) {
+	__builtin_cpu_init();
+	switch (isa) {
+	case FMATH_ISA_SSE41: return __builtin_cpu_supports("sse4.1");
+	case FMATH_ISA_AVX2: return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+	case FMATH_ISA_AVX512: return __builtin_cpu_supports("avx512f");
+	default: return true;
 	}
-	uint32_t xi = fmath_bitcast_f32_to_u32(x);
-	int e = (int)((xi >> 23) & 255) - 127;
-	uint32_t mant = (xi & 0x7fffffU) | 0x3f800000U; // 1.m
-	float m = fmath_bitcast_u32_to_f32(mant);
-	float z = m - 1.0f; // in [0,1)
-	// log(1+z) via alternating series with 5 terms: z - z^2/2 + z^3/3 - z^4/4 + z^5/5
-	float z2 = z * z;
-	float z3 = z2 * z;
-	float z4 = z3 * z;
-	float z5 = z4 * z;
-	float log1pz = z - 0.5f * z2 + (z3 * 0.3333333433f) - 0.25f * z4 + 0.2f * z5;
-	return (float)e * FMATH_LN2 + log1pz;
-}
-
-// Fast inverse sqrt (Quake III) + one Newton-Raphson refinement
-float fmath_rsqrtf(float x) {
-	if (x <= 0.0f) {
-		if (x == 0.0f) return INFINITY;
-		return NAN;
+}
+#else
+static bool fmath_cpu_supports(fmath_isa isa) {
+	(void)isa;
+	return true;
+}
+#endif
+
+// Kernel set for `isa` if compiled in and supported by this CPU, or NULL
+static const fmath_kernel_table *fmath_isa_kernels(fmath_isa isa) {
+	const fmath_kernel_table *k = NULL;
+	switch (isa) {
+	case FMATH_ISA_SCALAR: return &fmath_scalar_kernels;
+#if FMATH_HAVE_SSE41
+	case FMATH_ISA_SSE41: k = &fmath_sse41_kernels; break;
+#endif
+#if FMATH_HAVE_AVX2
+	case FMATH_ISA_AVX2: k = &fmath_avx2_kernels; break;
+#endif
+#if FMATH_HAVE_AVX512
+	case FMATH_ISA_AVX512: k = &fmath_avx512_kernels; break;
+#endif
+	default: break;
 	}
-	float xhalf = 0.5f * x;
-	uint32_t i = fmath_bitcast_f32_to_u32(x);
-	i = 0x5f3759dfu - (i >> 1);
-	float y = fmath_bitcast_u32_to_f32(i);
-	// One NR iteration
-	y = y * (1.5f - xhalf * y * y);
-	return y;
-}
-
-float fmath_sqrtf(float x) {
-	if (x <= 0.0f) {
-		if (x == 0.0f) return 0.0f;
-		return NAN;
+	return (k && fmath_cpu_supports(isa)) ? k : NULL;
+}
+
+// The one piece of mutable global state: scalar until the load-time resolver below
+// runs, swapped atomically by fmath_set_isa so any thread may call either at any time.
+// Readers do a single acquire load (a plain mov on x86) and no init check.
+static const fmath_kernel_table *fmath_kernels = &fmath_scalar_kernels;
+
+FMATH_INLINE const fmath_kernel_table *fmath_active_kernels(void) {
+	return __atomic_load_n(&fmath_kernels, __ATOMIC_ACQUIRE);
+}
+
+fmath_isa fmath_set_isa(fmath_isa isa) {
+	int i = (int)isa > (int)FMATH_ISA_AVX512 ? (int)FMATH_ISA_AVX512 : (int)isa;
+	while (i > (int)FMATH_ISA_SCALAR && !fmath_isa_kernels((fmath_isa)i)) --i;
+	fmath_isa selected = i > (int)FMATH_ISA_SCALAR ? (fmath_isa)i : FMATH_ISA_SCALAR;
+	__atomic_store_n(&fmath_kernels, fmath_isa_kernels(selected), __ATOMIC_RELEASE);
+	return selected;
+}
+
+fmath_isa fmath_get_isa(void) {
+	const fmath_kernel_table *k = fmath_active_kernels();
+	for (int i = (int)FMATH_ISA_AVX512; i > (int)FMATH_ISA_SCALAR; --i) {
+		if (k == fmath_isa_kernels((fmath_isa)i)) return (fmath_isa)i;
 	}
-	return x * fmath_rsqrtf(x);
+	return FMATH_ISA_SCALAR;
+}
+
+// FMATH_ISA environment variable caps the load-time choice
+static fmath_isa fmath_isa_from_env(void) {
+	const char *env = getenv("FMATH_ISA");
+	if (!env) return FMATH_ISA_AVX512;
+	if (strcmp(env, "scalar") == 0) return FMATH_ISA_SCALAR;
+	if (strcmp(env, "sse4.1") == 0 || strcmp(env, "sse41") == 0) return FMATH_ISA_SSE41;
+	if (strcmp(env, "avx2") == 0) return FMATH_ISA_AVX2;
+	return FMATH_ISA_AVX512;
 }
 
-float fmath_rcpf(float x) {
-	if (x == 0.0f) {
 #if defined(__GNUC__) || defined(__clang__)
-		return copysignf(INFINITY, x);
-#else
-		return (x < 0.0f) ? -INFINITY : INFINITY;
+__attribute__((constructor))
 #endif
-	}
-	// Fallback to hardware division; can be replaced with NR refine if desired
-	return 1.0f / x;
+static void fmath_resolve_isa(void) {
+	fmath_set_isa(fmath_isa_from_env());
+}
+
+// Array front-ends: one job struct per kernel signature, split by fmath_parallel_for
+typedef struct fmath_unary_job {
+	fmath_unary_kernel kernel;
+	float *dst;
+	const float *src;
+} fmath_unary_job;
+
+static void fmath_unary_body(void *ctx, size_t begin, size_t end) {
+	const fmath_unary_job *job = (const fmath_unary_job *)ctx;
+	job->kernel(job->dst + begin, job->src + begin, end - begin);
+}
+
+static void fmath_run_unary(fmath_unary_kernel kernel, float *dst, const float *src, size_t count) {
+	fmath_unary_job job = {kernel, dst, src};
+	fmath_parallel_for(count, fmath_unary_body, &job);
+}
+
+typedef struct fmath_binary_job {
+	fmath_binary_kernel kernel;
+	float *dst;
+	const float *a;
+	const float *b;
+} fmath_binary_job;
+
+static void fmath_binary_body(void *ctx, size_t begin, size_t end) {
+	const fmath_binary_job *job = (const fmath_binary_job *)ctx;
+	job->kernel(job->dst + begin, job->a + begin, job->b + begin, end - begin);
+}
+
+static void fmath_run_binary(fmath_binary_kernel kernel, float *dst, const float *a, const float *b, size_t count) {
+	fmath_binary_job job = {kernel, dst, a, b};
+	fmath_parallel_for(count, fmath_binary_body, &job);
+}
+
+typedef struct fmath_sincos_job {
+	fmath_sincos_kernel kernel;
+	float *dst_sin;
+	float *dst_cos;
+	const float *src;
+} fmath_sincos_job;
+
+static void fmath_sincos_body(void *ctx, size_t begin, size_t end) {
+	const fmath_sincos_job *job = (const fmath_sincos_job *)ctx;
+	job->kernel(job->dst_sin + begin, job->dst_cos + begin, job->src + begin, end - begin);
+}
+
+static void fmath_run_sincos(fmath_sincos_kernel kernel, float *dst_sin, float *dst_cos, const float *src,
+                             size_t count) {
+	fmath_sincos_job job = {kernel, dst_sin, dst_cos, src};
+	fmath_parallel_for(count, fmath_sincos_body, &job);
+}
+
+// As fmath_unary_body, but dst advances two floats per element
+static void fmath_cis_body(void *ctx, size_t begin, size_t end) {
+	const fmath_unary_job *job = (const fmath_unary_job *)ctx;
+	job->kernel(job->dst + 2 * begin, job->src + begin, end - begin);
+}
+
+static void fmath_run_cis(fmath_unary_kernel kernel, float *dst, const float *src, size_t count) {
+	fmath_unary_job job = {kernel, dst, src};
+	fmath_parallel_for(count, fmath_cis_body, &job);
 }
 
-// Array APIs
 void fmath_sinf_array(float *dst, const float *src, size_t count) {
-	if (!fmath_is_initialized) fmath_init_once();
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_sinf(src[i]);
+	fmath_run_unary(fmath_active_kernels()->sinf, dst, src, count);
 }
 
 void fmath_cosf_array(float *dst, const float *src, size_t count) {
-	if (!fmath_is_initialized) fmath_init_once();
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_cosf(src[i]);
+	fmath_run_unary(fmath_active_kernels()->cosf, dst, src, count);
+}
+
+void fmath_tanf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->tanf[fmath_tier(FMATH_FN_TAN)], dst, src, count);
+}
+
+void fmath_atanf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->atanf[fmath_tier(FMATH_FN_ATAN)], dst, src, count);
+}
+
+void fmath_asinf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->asinf[fmath_tier(FMATH_FN_ASIN)], dst, src, count);
+}
+
+void fmath_acosf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->acosf[fmath_tier(FMATH_FN_ASIN)], dst, src, count);
+}
+
+void fmath_sinhf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->sinhf[fmath_tier(FMATH_FN_TANH)], dst, src, count);
+}
+
+void fmath_coshf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->coshf[fmath_tier(FMATH_FN_TANH)], dst, src, count);
+}
+
+void fmath_tanhf_array(float *dst, const float *src, size_t count) {
+	fmath_run_unary(fmath_active_kernels()->tanhf[fmath_tier(FMATH_FN_TANH)], dst, src, count);
 }
 
 void fmath_expf_array(float *dst, const float *src, size_t count) {
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_expf_impl(src[i]);
+	fmath_run_unary(fmath_active_kernels()->expf[fmath_tier(FMATH_FN_EXP)], dst, src, count);
 }
 
 void fmath_logf_array(float *dst, const float *src, size_t count) {
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_logf(src[i]);
+	fmath_run_unary(fmath_active_kernels()->logf[fmath_tier(FMATH_FN_LOG)], dst, src, count);
 }
 
 void fmath_sqrtf_array(float *dst, const float *src, size_t count) {
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_sqrtf(src[i]);
+	fmath_run_unary(fmath_active_kernels()->sqrtf[fmath_tier(FMATH_FN_SQRT)], dst, src, count);
 }
 
 void fmath_rsqrtf_array(float *dst, const float *src, size_t count) {
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_rsqrtf(src[i]);
+	fmath_run_unary(fmath_active_kernels()->rsqrtf[fmath_tier(FMATH_FN_RSQRT)], dst, src, count);
 }
 
 void fmath_rcpf_array(float *dst, const float *src, size_t count) {
-	#if FMATH_ENABLE_OMP
-	#pragma omp parallel for schedule(static)
-	#endif
-	for (size_t i = 0; i < count; ++i) dst[i] = fmath_rcpf(src[i]);
-}
\ No newline at end of file
+	fmath_run_unary(fmath_active_kernels()->rcpf, dst, src, count);
+}
+
+void fmath_sincosf_array(float *dst_sin, float *dst_cos, const float *src, size_t count) {
+	fmath_run_sincos(fmath_active_kernels()->sincosf, dst_sin, dst_cos, src, count);
+}
+
+void fmath_cisf_array(float *dst, const float *src, size_t count) {
+	fmath_run_cis(fmath_active_kernels()->cisf, dst, src, count);
+}
+
+void fmath_atan2f_array(float *dst, const float *y, const float *x, size_t count) {
+	fmath_run_binary(fmath_active_kernels()->atan2f[fmath_tier(FMATH_FN_ATAN)], dst, y, x, count);
+}
@@ -0,0 +1,85 @@
+#include "fmath_internal.h"
+
+// 8-wide AVX2 + FMA kernels (Haswell or newer)
+
+#if FMATH_HAVE_AVX2
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx2,fma"))), apply_to = function)
+#else
+#pragma GCC target("avx2,fma")
+#endif
+
+typedef __m256 fv;
+typedef __m256i fvi;
+typedef __m256 fvm;
+
+#define FV_LANES 8
+#define FMATH_SIMD_NAME(name) fmath_avx2_##name
+#define FMATH_SIMD_VABI(fn) _ZGVdN8v_##fn
+#define FMATH_SIMD_VABI2(fn) _ZGVdN8vv_##fn
+
+FMATH_INLINE fv fv_set1(float x) { return _mm256_set1_ps(x); }
+FMATH_INLINE fv fv_loadu(const float *p) { return _mm256_loadu_ps(p); }
+FMATH_INLINE void fv_storeu(float *p, fv v) { _mm256_storeu_ps(p, v); }
+
+// Lanes [0, n) active; n in [1, FV_LANES)
+FMATH_INLINE __m256i fv_tail_mask(size_t n) {
+	return _mm256_cmpgt_epi32(_mm256_set1_epi32((int)n), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+}
+FMATH_INLINE fv fv_load_tail(const float *p, size_t n) { return _mm256_maskload_ps(p, fv_tail_mask(n)); }
+FMATH_INLINE void fv_store_tail(float *p, fv v, size_t n) { _mm256_maskstore_ps(p, fv_tail_mask(n), v); }
+
+FMATH_INLINE fv fv_add(fv a, fv b) { return _mm256_add_ps(a, b); }
+FMATH_INLINE fv fv_sub(fv a, fv b) { return _mm256_sub_ps(a, b); }
+FMATH_INLINE fv fv_mul(fv a, fv b) { return _mm256_mul_ps(a, b); }
+FMATH_INLINE fv fv_div(fv a, fv b) { return _mm256_div_ps(a, b); }
+FMATH_INLINE fv fv_sqrt(fv a) { return _mm256_sqrt_ps(a); }
+FMATH_INLINE fv fv_fmadd(fv a, fv b, fv c) { return _mm256_fmadd_ps(a, b, c); }   /* a*b + c */
+FMATH_INLINE fv fv_fnmadd(fv a, fv b, fv c) { return _mm256_fnmadd_ps(a, b, c); } /* c - a*b */
+FMATH_INLINE fv fv_floor(fv a) { return _mm256_floor_ps(a); }
+FMATH_INLINE fv fv_round(fv a) { return _mm256_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+FMATH_INLINE fvm fv_cmplt(fv a, fv b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+FMATH_INLINE fvm fv_cmple(fv a, fv b) { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+FMATH_INLINE fvm fv_cmpgt(fv a, fv b) { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+FMATH_INLINE fvm fv_cmpeq(fv a, fv b) { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+FMATH_INLINE fv fv_select(fvm m, fv t, fv f) { return _mm256_blendv_ps(f, t, m); }
+FMATH_INLINE int fvm_any(fvm m) { return _mm256_movemask_ps(m) != 0; }
+
+FMATH_INLINE fvi fv_cvtt(fv a) { return _mm256_cvttps_epi32(a); }
+FMATH_INLINE fv fvi_cvt(fvi a) { return _mm256_cvtepi32_ps(a); }
+FMATH_INLINE fvi fv_as_i(fv a) { return _mm256_castps_si256(a); }
+FMATH_INLINE fv fvi_as_f(fvi a) { return _mm256_castsi256_ps(a); }
+FMATH_INLINE fvi fvi_set1(int x) { return _mm256_set1_epi32(x); }
+FMATH_INLINE fvi fvi_loadu(const int32_t *p) { return _mm256_loadu_si256((const __m256i *)p); }
+FMATH_INLINE void fvi_storeu(int32_t *p, fvi v) { _mm256_storeu_si256((__m256i *)p, v); }
+FMATH_INLINE fvi fvi_add(fvi a, fvi b) { return _mm256_add_epi32(a, b); }
+FMATH_INLINE fvi fvi_sub(fvi a, fvi b) { return _mm256_sub_epi32(a, b); }
+FMATH_INLINE fvi fvi_and(fvi a, fvi b) { return _mm256_and_si256(a, b); }
+FMATH_INLINE fvi fvi_or(fvi a, fvi b) { return _mm256_or_si256(a, b); }
+FMATH_INLINE fvi fvi_xor(fvi a, fvi b) { return _mm256_xor_si256(a, b); }
+#define fvi_slli(a, n) _mm256_slli_epi32((a), (n))
+#define fvi_srli(a, n) _mm256_srli_epi32((a), (n))
+#define fvi_srai(a, n) _mm256_srai_epi32((a), (n))
+
+FMATH_INLINE fv fv_gather(const float *base, fvi idx) { return _mm256_i32gather_ps(base, idx, 4); }
+
+// a0 b0 a1 b1 ... into 2 * FV_LANES floats; unpack works per 128-bit half, so
+// recombine the halves afterwards
+FMATH_INLINE void fv_store_interleave(float *p, fv a, fv b) {
+	__m256 lo = _mm256_unpacklo_ps(a, b);
+	__m256 hi = _mm256_unpackhi_ps(a, b);
+	_mm256_storeu_ps(p, _mm256_permute2f128_ps(lo, hi, 0x20));
+	_mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+}
+
+#include "fmath_simd_kernels.h"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+
+#endif /* FMATH_HAVE_AVX2 */
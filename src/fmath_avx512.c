@@ -0,0 +1,86 @@
+#include "fmath_internal.h"
+
+// 16-wide AVX-512F kernels. Tails use k-mask loads/stores; the sin LUT is far
+// larger than a vpermps/vpermt2ps register table, so lookups use vgatherdps.
+
+#if FMATH_HAVE_AVX512
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+#else
+#pragma GCC target("avx512f")
+#endif
+
+typedef __m512 fv;
+typedef __m512i fvi;
+typedef __mmask16 fvm;
+
+#define FV_LANES 16
+#define FMATH_SIMD_NAME(name) fmath_avx512_##name
+#define FMATH_SIMD_VABI(fn) _ZGVeN16v_##fn
+#define FMATH_SIMD_VABI2(fn) _ZGVeN16vv_##fn
+
+FMATH_INLINE fv fv_set1(float x) { return _mm512_set1_ps(x); }
+FMATH_INLINE fv fv_loadu(const float *p) { return _mm512_loadu_ps(p); }
+FMATH_INLINE void fv_storeu(float *p, fv v) { _mm512_storeu_ps(p, v); }
+
+// Lanes [0, n) active; n in [1, FV_LANES)
+FMATH_INLINE __mmask16 fv_tail_mask(size_t n) { return (__mmask16)((1u << n) - 1u); }
+FMATH_INLINE fv fv_load_tail(const float *p, size_t n) { return _mm512_maskz_loadu_ps(fv_tail_mask(n), p); }
+FMATH_INLINE void fv_store_tail(float *p, fv v, size_t n) { _mm512_mask_storeu_ps(p, fv_tail_mask(n), v); }
+
+FMATH_INLINE fv fv_add(fv a, fv b) { return _mm512_add_ps(a, b); }
+FMATH_INLINE fv fv_sub(fv a, fv b) { return _mm512_sub_ps(a, b); }
+FMATH_INLINE fv fv_mul(fv a, fv b) { return _mm512_mul_ps(a, b); }
+FMATH_INLINE fv fv_div(fv a, fv b) { return _mm512_div_ps(a, b); }
+FMATH_INLINE fv fv_sqrt(fv a) { return _mm512_sqrt_ps(a); }
+FMATH_INLINE fv fv_fmadd(fv a, fv b, fv c) { return _mm512_fmadd_ps(a, b, c); }   /* a*b + c */
+FMATH_INLINE fv fv_fnmadd(fv a, fv b, fv c) { return _mm512_fnmadd_ps(a, b, c); } /* c - a*b */
+FMATH_INLINE fv fv_floor(fv a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC); }
+FMATH_INLINE fv fv_round(fv a) { return _mm512_roundscale_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+FMATH_INLINE fvm fv_cmplt(fv a, fv b) { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+FMATH_INLINE fvm fv_cmple(fv a, fv b) { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+FMATH_INLINE fvm fv_cmpgt(fv a, fv b) { return _mm512_cmp_ps_mask(a, b, _CMP_GT_OQ); }
+FMATH_INLINE fvm fv_cmpeq(fv a, fv b) { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+FMATH_INLINE fv fv_select(fvm m, fv t, fv f) { return _mm512_mask_blend_ps(m, f, t); }
+FMATH_INLINE int fvm_any(fvm m) { return m != 0; }
+
+FMATH_INLINE fvi fv_cvtt(fv a) { return _mm512_cvttps_epi32(a); }
+FMATH_INLINE fv fvi_cvt(fvi a) { return _mm512_cvtepi32_ps(a); }
+FMATH_INLINE fvi fv_as_i(fv a) { return _mm512_castps_si512(a); }
+FMATH_INLINE fv fvi_as_f(fvi a) { return _mm512_castsi512_ps(a); }
+FMATH_INLINE fvi fvi_set1(int x) { return _mm512_set1_epi32(x); }
+FMATH_INLINE fvi fvi_loadu(const int32_t *p) { return _mm512_loadu_si512(p); }
+FMATH_INLINE void fvi_storeu(int32_t *p, fvi v) { _mm512_storeu_si512(p, v); }
+FMATH_INLINE fvi fvi_add(fvi a, fvi b) { return _mm512_add_epi32(a, b); }
+FMATH_INLINE fvi fvi_sub(fvi a, fvi b) { return _mm512_sub_epi32(a, b); }
+FMATH_INLINE fvi fvi_and(fvi a, fvi b) { return _mm512_and_si512(a, b); }
+FMATH_INLINE fvi fvi_or(fvi a, fvi b) { return _mm512_or_si512(a, b); }
+FMATH_INLINE fvi fvi_xor(fvi a, fvi b) { return _mm512_xor_si512(a, b); }
+#define fvi_slli(a, n) _mm512_slli_epi32((a), (n))
+#define fvi_srli(a, n) _mm512_srli_epi32((a), (n))
+#define fvi_srai(a, n) _mm512_srai_epi32((a), (n))
+
+FMATH_INLINE fv fv_gather(const float *base, fvi idx) { return _mm512_i32gather_ps(idx, base, 4); }
+
+// a0 b0 a1 b1 ... into 2 * FV_LANES floats; unpack works per 128-bit lane, so
+// reorder the lanes with a two-source permute
+FMATH_INLINE void fv_store_interleave(float *p, fv a, fv b) {
+	__m512 lo = _mm512_unpacklo_ps(a, b);
+	__m512 hi = _mm512_unpackhi_ps(a, b);
+	__m512i first = _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 4, 5, 6, 7, 20, 21, 22, 23);
+	__m512i second = _mm512_setr_epi32(8, 9, 10, 11, 24, 25, 26, 27, 12, 13, 14, 15, 28, 29, 30, 31);
+	_mm512_storeu_ps(p, _mm512_permutex2var_ps(lo, first, hi));
+	_mm512_storeu_ps(p + 16, _mm512_permutex2var_ps(lo, second, hi));
+}
+
+#include "fmath_simd_kernels.h"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+
+#endif /* FMATH_HAVE_AVX512 */
@@ -0,0 +1,111 @@
+#ifndef FMATH_INTERNAL_H
+#define FMATH_INTERNAL_H
+
+// Private declarations shared by the scalar core (fmath.c) and the SIMD kernel files;
+// the scalar kernels themselves live in fmath_inline.h.
+
+#define FMATH_BUILDING_LIBRARY 1 /* vector ABI variants are hand-written, not compiler clones */
+#include "fmath.h"
+
+#include "fmath_inline.h"
+
+#if FMATH_PRECISION < 0 || FMATH_PRECISION > 2
+#error "FMATH_PRECISION must be 0 (fast), 1 (balanced) or 2 (accurate)"
+#endif
+
+// Symbols shared only between the library's own files: kept out of the dynamic symbol
+// table of a shared build, so clients cannot bind to them
+#if defined(__GNUC__) || defined(__clang__)
+#define FMATH_HIDDEN __attribute__((visibility("hidden")))
+#else
+#define FMATH_HIDDEN
+#endif
+
+enum {
+	FMATH_PRECISION_COUNT = FMATH_PRECISION_ACCURATE + 1,
+	FMATH_FN_COUNT = FMATH_FN_TANH + 1
+};
+
+// Current array tier per fmath_fn, read with one relaxed load per array call
+extern FMATH_HIDDEN int fmath_precision_tiers[FMATH_FN_COUNT];
+
+FMATH_INLINE fmath_precision fmath_tier(fmath_fn fn) {
+	return (fmath_precision)__atomic_load_n(&fmath_precision_tiers[fn], __ATOMIC_RELAXED);
+}
+
+// Kernel signature used by the array front-ends in fmath.c
+typedef void (*fmath_unary_kernel)(float *dst, const float *src, size_t count);
+
+// dst[i] = f(a[i], b[i])
+typedef void (*fmath_binary_kernel)(float *dst, const float *a, const float *b, size_t count);
+
+// sin into dst_sin and cos into dst_cos
+typedef void (*fmath_sincos_kernel)(float *dst_sin, float *dst_cos, const float *src, size_t count);
+
+// One array kernel per public fmath_*_array entry point, per tier for tiered functions
+typedef struct fmath_kernel_table {
+	fmath_unary_kernel sinf;
+	fmath_unary_kernel cosf;
+	fmath_unary_kernel expf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel logf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel sqrtf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel rsqrtf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel rcpf;
+	fmath_unary_kernel tanf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel atanf[FMATH_PRECISION_COUNT];
+	fmath_binary_kernel atan2f[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel asinf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel acosf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel sinhf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel coshf[FMATH_PRECISION_COUNT];
+	fmath_unary_kernel tanhf[FMATH_PRECISION_COUNT];
+	fmath_sincos_kernel sincosf;
+	fmath_unary_kernel cisf; /* dst holds 2 * count floats */
+} fmath_kernel_table;
+
+// Runs body over [0, count) in blocks on the thread pool (fmath_pool.c), or directly
+// on the caller thread when threads are disabled or count is below the threshold
+typedef void (*fmath_parallel_body)(void *ctx, size_t begin, size_t end);
+
+#if FMATH_ENABLE_THREADS
+FMATH_HIDDEN void fmath_parallel_for(size_t count, fmath_parallel_body body, void *ctx);
+#else
+FMATH_INLINE void fmath_parallel_for(size_t count, fmath_parallel_body body, void *ctx) {
+	body(ctx, 0, count);
+}
+#endif
+
+// x86 kernel sets are built with per-file target pragmas and picked at load time via
+// cpuid, so a baseline x86-64 build still runs AVX2/AVX-512 code where available.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define FMATH_X86_DISPATCH 1
+#else
+#define FMATH_X86_DISPATCH 0
+#endif
+
+#define FMATH_HAVE_SSE41 (FMATH_X86_DISPATCH && FMATH_ENABLE_SSE41)
+#define FMATH_HAVE_AVX2 (FMATH_X86_DISPATCH && FMATH_ENABLE_AVX2)
+#define FMATH_HAVE_AVX512 (FMATH_X86_DISPATCH && FMATH_ENABLE_AVX512)
+
+// _ZGV* vector variants: b (SSE2) and c (AVX) are ifunc-resolved in fmath_vector_abi.c
+// on top of the SSE4.1 kernels; d (AVX2) and e (AVX-512) live in their kernel files.
+// All four are exported whenever fmath.h declares them (FMATH_VECTOR_DECL), whatever
+// kernel sets are enabled: fmath_vector_abi.c fills a missing set from the next narrower
+// one, down to a scalar loop.
+#if FMATH_ENABLE_VECTOR_ABI && defined(__x86_64__) && defined(__ELF__) && FMATH_X86_DISPATCH
+#define FMATH_HAVE_VECTOR_ABI 1
+#else
+#define FMATH_HAVE_VECTOR_ABI 0
+#endif
+
+#if FMATH_HAVE_SSE41
+extern FMATH_HIDDEN const fmath_kernel_table fmath_sse41_kernels;
+#endif
+#if FMATH_HAVE_AVX2
+extern FMATH_HIDDEN const fmath_kernel_table fmath_avx2_kernels;
+#endif
+#if FMATH_HAVE_AVX512
+extern FMATH_HIDDEN const fmath_kernel_table fmath_avx512_kernels;
+#endif
+
+#endif /* FMATH_INTERNAL_H */
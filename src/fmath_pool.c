@@ -0,0 +1,264 @@
+#define _GNU_SOURCE /* sched_getaffinity, pthread_setaffinity_np */
+#include "fmath_internal.h"
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+// Persistent thread pool behind the array APIs (FMATH_ENABLE_THREADS).
+//
+// A call publishes a job that lives on the caller's stack; the caller and the workers
+// claim FMATH_POOL_BLOCK-element blocks from it with an atomic counter, so uneven
+// progress (SMT siblings, preemption) balances itself. Idle workers spin on the job
+// sequence number for FMATH_THREAD_SPIN pauses, then park on a condition variable.
+
+static size_t fmath_parallel_threshold = FMATH_PARALLEL_THRESHOLD;
+
+void fmath_set_parallel_threshold(size_t count) {
+	__atomic_store_n(&fmath_parallel_threshold, count, __ATOMIC_RELAXED);
+}
+
+size_t fmath_get_parallel_threshold(void) {
+	return __atomic_load_n(&fmath_parallel_threshold, __ATOMIC_RELAXED);
+}
+
+#if FMATH_ENABLE_THREADS
+
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+enum {
+	FMATH_POOL_BLOCK = 4096, /* elements per claim, multiple of every vector width */
+	FMATH_POOL_MAX_THREADS = 256
+};
+
+typedef struct fmath_pool_job {
+	fmath_parallel_body body;
+	void *ctx;
+	size_t count;
+	size_t blocks;
+	size_t next; /* next unclaimed block */
+	size_t done; /* finished blocks */
+} fmath_pool_job;
+
+// Fields marked (atomic) are only accessed through __atomic builtins
+typedef struct fmath_pool {
+	pthread_t workers[FMATH_POOL_MAX_THREADS];
+	int nworkers;         /* running workers, not counting the caller */
+	int started;
+	int requested;        /* fmath_set_threads value, <= 0 for the default */
+	fmath_pool_job *job;  /* current job or NULL (atomic) */
+	unsigned seq;         /* bumped for every published job (atomic) */
+	int active;           /* workers that may be reading *job (atomic) */
+	int sleepers;         /* parked workers (atomic) */
+	int stop;             /* (atomic) */
+	char busy;            /* held by the one caller driving the pool (atomic) */
+	pthread_mutex_t lock;
+	pthread_cond_t wake;
+} fmath_pool;
+
+static fmath_pool fmath_the_pool = {.lock = PTHREAD_MUTEX_INITIALIZER, .wake = PTHREAD_COND_INITIALIZER};
+
+FMATH_INLINE void fmath_pool_relax(void) {
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_ia32_pause();
+#elif defined(__aarch64__)
+	__asm__ __volatile__("yield");
+#endif
+}
+
+// CPUs the process may run on, in ascending order
+static int fmath_pool_cpus(int *cpus, int max) {
+	int n = 0;
+#if defined(__linux__)
+	cpu_set_t set;
+	if (sched_getaffinity(0, sizeof set, &set) == 0) {
+		for (size_t c = 0; c < CPU_SETSIZE && n < max; ++c) {
+			if (CPU_ISSET(c, &set)) cpus[n++] = (int)c;
+		}
+		if (n > 0) return n;
+	}
+#endif
+	long online = sysconf(_SC_NPROCESSORS_ONLN);
+	for (n = 0; n < online && n < max; ++n) cpus[n] = n;
+	return n > 0 ? n : 1;
+}
+
+static int fmath_pool_default_threads(void) {
+	const char *env = getenv("FMATH_THREADS");
+	int n = env ? atoi(env) : 0;
+	if (n <= 0) {
+		int cpus[FMATH_POOL_MAX_THREADS];
+		n = fmath_pool_cpus(cpus, FMATH_POOL_MAX_THREADS);
+	}
+	return n < FMATH_POOL_MAX_THREADS ? n : FMATH_POOL_MAX_THREADS;
+}
+
+static void fmath_pool_work(fmath_pool_job *job) {
+	for (;;) {
+		size_t b = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+		if (b >= job->blocks) return;
+		size_t begin = b * FMATH_POOL_BLOCK;
+		size_t end = job->count - begin < FMATH_POOL_BLOCK ? job->count : begin + FMATH_POOL_BLOCK;
+		job->body(job->ctx, begin, end);
+		__atomic_fetch_add(&job->done, 1, __ATOMIC_RELEASE);
+	}
+}
+
+// Waits for a job newer than `seen`; returns false once the pool is stopping
+static bool fmath_pool_wait(fmath_pool *pool, unsigned seen, unsigned *seq) {
+	for (int i = 0; i < FMATH_THREAD_SPIN; ++i) {
+		if (__atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE)) return false;
+		*seq = __atomic_load_n(&pool->seq, __ATOMIC_ACQUIRE);
+		if (*seq != seen) return true;
+		fmath_pool_relax();
+	}
+	// Dekker pairing with fmath_parallel_for: we bump sleepers then re-check seq, it
+	// bumps seq then checks sleepers, so one of the two always sees the other.
+	pthread_mutex_lock(&pool->lock);
+	__atomic_add_fetch(&pool->sleepers, 1, __ATOMIC_SEQ_CST);
+	while (!__atomic_load_n(&pool->stop, __ATOMIC_SEQ_CST) &&
+	       (*seq = __atomic_load_n(&pool->seq, __ATOMIC_SEQ_CST)) == seen) {
+		pthread_cond_wait(&pool->wake, &pool->lock);
+	}
+	__atomic_sub_fetch(&pool->sleepers, 1, __ATOMIC_RELAXED);
+	pthread_mutex_unlock(&pool->lock);
+	return !__atomic_load_n(&pool->stop, __ATOMIC_ACQUIRE);
+}
+
+static void *fmath_pool_worker(void *arg) {
+	fmath_pool *pool = &fmath_the_pool;
+	unsigned seen = (unsigned)(uintptr_t)arg, seq;
+	while (fmath_pool_wait(pool, seen, &seq)) {
+		seen = seq;
+		// Announce ourselves before reading the job pointer; the caller clears the
+		// pointer and then waits for active == 0 before its stack frame goes away.
+		__atomic_add_fetch(&pool->active, 1, __ATOMIC_SEQ_CST);
+		fmath_pool_job *job = __atomic_load_n(&pool->job, __ATOMIC_SEQ_CST);
+		if (job) fmath_pool_work(job);
+		__atomic_sub_fetch(&pool->active, 1, __ATOMIC_RELEASE);
+	}
+	return NULL;
+}
+
+// Workers do not survive fork(); the child starts a fresh pool on first use
+static void fmath_pool_atfork_child(void) {
+	fmath_pool *pool = &fmath_the_pool;
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->wake, NULL);
+	pool->nworkers = 0;
+	pool->started = 0;
+	pool->job = NULL;
+	pool->active = 0;
+	pool->sleepers = 0;
+	pool->stop = 0;
+	pool->busy = 0;
+}
+
+// Caller holds busy
+static void fmath_pool_start(fmath_pool *pool) {
+	static bool atfork_registered;
+	if (!atfork_registered) {
+		pthread_atfork(NULL, NULL, fmath_pool_atfork_child);
+		atfork_registered = true;
+	}
+	int cpus[FMATH_POOL_MAX_THREADS];
+	int ncpus = fmath_pool_cpus(cpus, FMATH_POOL_MAX_THREADS);
+	int threads = pool->requested > 0 ? pool->requested : fmath_pool_default_threads();
+	if (threads > FMATH_POOL_MAX_THREADS) threads = FMATH_POOL_MAX_THREADS;
+	void *seq = (void *)(uintptr_t)__atomic_load_n(&pool->seq, __ATOMIC_RELAXED);
+	int n = 0;
+	for (int i = 1; i < threads; ++i) {
+		if (pthread_create(&pool->workers[n], NULL, fmath_pool_worker, seq) != 0) break;
+#if FMATH_THREAD_PIN && defined(__linux__)
+		// Worker i on the i-th allowed CPU; the caller keeps its own affinity
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET((size_t)cpus[i % ncpus], &set);
+		pthread_setaffinity_np(pool->workers[n], sizeof set, &set);
+#else
+		(void)ncpus;
+#endif
+		++n;
+	}
+	__atomic_store_n(&pool->nworkers, n, __ATOMIC_RELEASE); /* read by fmath_get_threads without busy */
+	pool->started = 1;
+}
+
+// Caller holds busy
+static void fmath_pool_stop(fmath_pool *pool) {
+	if (!pool->started) return;
+	__atomic_store_n(&pool->stop, 1, __ATOMIC_SEQ_CST);
+	pthread_mutex_lock(&pool->lock);
+	pthread_cond_broadcast(&pool->wake);
+	pthread_mutex_unlock(&pool->lock);
+	for (int i = 0; i < pool->nworkers; ++i) pthread_join(pool->workers[i], NULL);
+	__atomic_store_n(&pool->stop, 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&pool->nworkers, 0, __ATOMIC_RELEASE);
+	pool->started = 0;
+}
+
+void fmath_parallel_for(size_t count, fmath_parallel_body body, void *ctx) {
+	fmath_pool *pool = &fmath_the_pool;
+	size_t blocks = (count + FMATH_POOL_BLOCK - 1) / FMATH_POOL_BLOCK;
+	// Small calls, and calls racing another thread for the pool, stay on this thread
+	if (count < fmath_get_parallel_threshold() || blocks < 2 ||
+	    __atomic_test_and_set(&pool->busy, __ATOMIC_ACQUIRE)) {
+		body(ctx, 0, count);
+		return;
+	}
+	if (!pool->started) fmath_pool_start(pool);
+	if (pool->nworkers == 0) {
+		__atomic_clear(&pool->busy, __ATOMIC_RELEASE);
+		body(ctx, 0, count);
+		return;
+	}
+
+	fmath_pool_job job = {body, ctx, count, blocks, 0, 0};
+	__atomic_store_n(&pool->job, &job, __ATOMIC_SEQ_CST);
+	__atomic_add_fetch(&pool->seq, 1, __ATOMIC_SEQ_CST);
+	if (__atomic_load_n(&pool->sleepers, __ATOMIC_SEQ_CST)) {
+		pthread_mutex_lock(&pool->lock);
+		pthread_cond_broadcast(&pool->wake);
+		pthread_mutex_unlock(&pool->lock);
+	}
+	fmath_pool_work(&job);
+	while (__atomic_load_n(&job.done, __ATOMIC_ACQUIRE) < blocks) fmath_pool_relax();
+	__atomic_store_n(&pool->job, NULL, __ATOMIC_SEQ_CST);
+	while (__atomic_load_n(&pool->active, __ATOMIC_SEQ_CST)) fmath_pool_relax();
+	__atomic_clear(&pool->busy, __ATOMIC_RELEASE);
+}
+
+int fmath_set_threads(int count) {
+	fmath_pool *pool = &fmath_the_pool;
+	while (__atomic_test_and_set(&pool->busy, __ATOMIC_ACQUIRE)) fmath_pool_relax();
+	fmath_pool_stop(pool);
+	pool->requested = count;
+	__atomic_clear(&pool->busy, __ATOMIC_RELEASE);
+	return fmath_get_threads();
+}
+
+int fmath_get_threads(void) {
+	fmath_pool *pool = &fmath_the_pool;
+	if (__atomic_test_and_set(&pool->busy, __ATOMIC_ACQUIRE)) { /* running, or being resized */
+		return __atomic_load_n(&pool->nworkers, __ATOMIC_ACQUIRE) + 1;
+	}
+	int n = pool->started ? pool->nworkers + 1
+	        : pool->requested > 0 ? (pool->requested < FMATH_POOL_MAX_THREADS ? pool->requested : FMATH_POOL_MAX_THREADS)
+	                              : fmath_pool_default_threads();
+	__atomic_clear(&pool->busy, __ATOMIC_RELEASE);
+	return n;
+}
+
+#else
+
+int fmath_set_threads(int count) {
+	(void)count;
+	return 1;
+}
+
+int fmath_get_threads(void) {
+	return 1;
+}
+
+#endif /* FMATH_ENABLE_THREADS */
@@ -0,0 +1,495 @@
+// Vector kernels shared by every SIMD backend.
+//
+// Not a standalone header: the including backend (e.g. fmath_avx2.c) first defines
+//   fv / fvi / fvm        float vector, int32 vector and lane-mask types
+//   FV_LANES              lanes per vector
+//   FMATH_SIMD_NAME(n)    symbol prefix, e.g. fmath_avx2_##n
+// and the fv_* / fvi_* primitive layer used below; defining FMATH_SIMD_VABI(fn) and
+// FMATH_SIMD_VABI2(fn) also exports fv -> fv and (fv, fv) -> fv entry points under those
+// names (vector function ABI variants), with FMATH_SIMD_VABI_ATTR in front when the
+// backend sets it (FMATH_HIDDEN for wrapped ones). Each kernel mirrors the scalar
+// algorithm in fmath_inline.h so array and scalar results agree up to FMA contraction.
+
+// LUT interpolation at table position j + t (j wrapped via mask), as fmath_lut_at
+FMATH_INLINE fv fmath_v_lut_at(fvi j, fv t) {
+	j = fvi_and(j, fvi_set1(FMATH_TABLE_MASK));
+#if FMATH_SIN_HERMITE
+	// Cubic Hermite over interleaved {value, slope} pairs: four gathers from one cache line or two
+	fvi e = fvi_slli(j, 1);
+	fv p0 = fv_gather(fmath_sin_lut, e);
+	fv m0 = fv_gather(fmath_sin_lut + 1, e);
+	fv p1 = fv_gather(fmath_sin_lut + 2, e);
+	fv m1 = fv_gather(fmath_sin_lut + 3, e);
+	fv dp = fv_sub(p1, p0);
+	fv c2 = fv_sub(fv_fnmadd(fv_set1(2.0f), m0, fv_mul(fv_set1(3.0f), dp)), m1);
+	fv c3 = fv_fnmadd(fv_set1(2.0f), dp, fv_add(m0, m1));
+	fv p = fv_fmadd(t, c3, c2);
+	p = fv_fmadd(p, t, m0);
+	return fv_fmadd(p, t, p0);
+#elif FMATH_SIN_LUT_QUARTER
+	// Quadrant folding as in fmath_lut_at: odd quadrants run backwards, q >= 2 negates
+	fvi q = fvi_srli(j, FMATH_TABLE_BITS - 2);
+	fvi odd = fvi_sub(fvi_set1(0), fvi_and(q, fvi_set1(1)));
+	fvi i0 = fvi_add(fvi_xor(fvi_and(j, fvi_set1(FMATH_QUARTER_SIZE - 1)), odd),
+	                 fvi_and(odd, fvi_set1(FMATH_QUARTER_SIZE + 1)));
+	fv s0 = fv_gather(fmath_sin_lut, i0);
+	fv s1 = fv_gather(fmath_sin_lut, fvi_add(i0, fvi_or(odd, fvi_set1(1))));
+	fv r = fv_fmadd(t, fv_sub(s1, s0), s0);
+	return fvi_as_f(fvi_xor(fv_as_i(r), fvi_slli(fvi_srli(q, 1), 31)));
+#else
+	fv s0 = fv_gather(fmath_sin_lut, j);
+	fv s1 = fv_gather(fmath_sin_lut + 1, j);
+	return fv_fmadd(t, fv_sub(s1, s0), s0);
+#endif
+}
+
+// Table position of x as in fmath_trig_reduce: Cody-Waite on every lane, then one
+// well-predicted branch per vector sends blocks holding a huge (or non-finite) lane
+// through Payne-Hanek for those lanes only. Returns t, stores j.
+FMATH_INLINE fv fmath_v_trig_reduce(fv x, fvi *j) {
+	fv n = fv_round(fv_mul(x, fv_set1(FMATH_INV_TWO_PI)));
+	fv r = fv_fnmadd(n, fv_set1(FMATH_TWO_PI_HI), x);
+	FMATH_OPAQUE(r);
+	r = fv_fnmadd(n, fv_set1(FMATH_TWO_PI_MID), r);
+	FMATH_OPAQUE(r);
+	r = fv_fnmadd(n, fv_set1(FMATH_TWO_PI_LO), r);
+	fv index_f = fv_mul(r, fv_set1(FMATH_INDEX_SCALE));
+	fv fl = fv_floor(index_f);
+	fv t = fv_sub(index_f, fl);
+	*j = fv_cvtt(fl);
+	fv ax = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	if (__builtin_expect(fvm_any(fv_cmpgt(ax, fv_set1(FMATH_TRIG_CW_LIMIT))), 0)) {
+		float xs[FV_LANES], ts[FV_LANES];
+		int32_t js[FV_LANES];
+		fv_storeu(xs, x);
+		fv_storeu(ts, t);
+		fvi_storeu(js, *j);
+		for (int i = 0; i < FV_LANES; ++i) {
+			if (!(fabsf(xs[i]) <= FMATH_TRIG_CW_LIMIT)) js[i] = fmath_trig_reduce_large(xs[i], &ts[i]);
+		}
+		*j = fvi_loadu(js);
+		t = fv_loadu(ts);
+	}
+	return t;
+}
+
+FMATH_INLINE fv fmath_v_sin(fv x) {
+	fvi j;
+	fv t = fmath_v_trig_reduce(x, &j);
+	return fmath_v_lut_at(j, t);
+}
+
+FMATH_INLINE fv fmath_v_cos(fv x) {
+	fvi j;
+	fv t = fmath_v_trig_reduce(x, &j);
+	return fmath_v_lut_at(fvi_add(fvi_and(j, fvi_set1(FMATH_TABLE_MASK)), fvi_set1(FMATH_QUARTER_SIZE)), t);
+}
+
+FMATH_INLINE fv fmath_v_sincos(fv x, fv *c) {
+	fvi j;
+	fv t = fmath_v_trig_reduce(x, &j);
+	j = fvi_and(j, fvi_set1(FMATH_TABLE_MASK));
+	*c = fmath_v_lut_at(fvi_add(j, fvi_set1(FMATH_QUARTER_SIZE)), t);
+	return fmath_v_lut_at(j, t);
+}
+
+// Quadrant n and r = x - n*pi/2 as in fmath_tan_reduce, huge lanes as in fmath_v_trig_reduce.
+// Returns r, stores n.
+FMATH_INLINE fv fmath_v_tan_reduce(fv x, fvi *n) {
+	fv nf = fv_round(fv_mul(x, fv_set1(FMATH_TWO_OVER_PI)));
+	fv r = fv_fnmadd(nf, fv_set1(FMATH_PI_2_HI), x);
+	FMATH_OPAQUE(r);
+	r = fv_fnmadd(nf, fv_set1(FMATH_PI_2_MID), r);
+	FMATH_OPAQUE(r);
+	r = fv_fnmadd(nf, fv_set1(FMATH_PI_2_LO), r);
+	FMATH_OPAQUE(r);
+	r = fv_fnmadd(nf, fv_set1(FMATH_PI_2_TAIL), r);
+	*n = fv_cvtt(nf);
+	fv ax = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	if (__builtin_expect(fvm_any(fv_cmpgt(ax, fv_set1(FMATH_TAN_CW_LIMIT))), 0)) {
+		float xs[FV_LANES], rs[FV_LANES];
+		int32_t ns[FV_LANES];
+		fv_storeu(xs, x);
+		fv_storeu(rs, r);
+		fvi_storeu(ns, *n);
+		for (int i = 0; i < FV_LANES; ++i) {
+			if (!(fabsf(xs[i]) <= FMATH_TAN_CW_LIMIT)) ns[i] = fmath_tan_reduce_large(xs[i], &rs[i]);
+		}
+		*n = fvi_loadu(ns);
+		r = fv_loadu(rs);
+	}
+	return r;
+}
+
+// 2^n for integer lanes n in [-126, 127] via exponent bits
+FMATH_INLINE fv fmath_v_pow2i(fvi n) {
+	return fvi_as_f(fvi_slli(fvi_add(n, fvi_set1(127)), 23));
+}
+
+// Horner evaluation as fmath_poly; n is a constant, so the loop unrolls
+FMATH_INLINE fv fmath_v_poly(fv x, const float *c, int n) {
+	fv p = fv_set1(c[n - 1]);
+	for (int k = n - 2; k >= 0; --k) p = fv_fmadd(p, x, fv_set1(c[k]));
+	return p;
+}
+
+#define FMATH_V_POLY(x, coeffs) fmath_v_poly((x), (coeffs), (int)FMATH_COUNT_OF(coeffs))
+
+// As fmath_exp_core, e^x * 2^k without range checks
+FMATH_INLINE fv fmath_v_exp_core(fv x, int k, fmath_precision tier) {
+	fv nf = fv_round(fv_mul(x, fv_set1(FMATH_INV_LN2)));
+	fv g = fv_fnmadd(nf, fv_set1(FMATH_LN2_HI), x);
+	FMATH_OPAQUE(g);
+	g = fv_fnmadd(nf, fv_set1(FMATH_LN2_LO), g);
+	fv p = tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(g, fmath_exp_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(g, fmath_exp_poly_balanced)
+	                                          : FMATH_V_POLY(g, fmath_exp_poly_accurate);
+	// Scale in two halves so n down to -144 (the scalar ldexpf range) stays representable
+	fvi n = fvi_add(fv_cvtt(nf), fvi_set1(k));
+	fvi n1 = fvi_srai(n, 1);
+	fvi n2 = fvi_sub(n, n1);
+	fv y = fv_mul(p, fmath_v_pow2i(n1));
+	FMATH_OPAQUE(y); /* keep -ffast-math from folding the two scales into an overflowing 2^n */
+	return fv_mul(y, fmath_v_pow2i(n2));
+}
+
+FMATH_INLINE fv fmath_v_exp(fv x, fmath_precision tier) {
+	fv y = fmath_v_exp_core(x, 0, tier);
+	y = fv_select(fv_cmpgt(x, fv_set1(FMATH_EXP_MAX)), fv_set1(INFINITY), y);
+	return fv_select(fv_cmplt(x, fv_set1(-100.0f)), fv_set1(0.0f), y);
+}
+
+// Both branches of fmath_tanf_impl on every lane, odd quadrants picked by the parity bit
+FMATH_INLINE fv fmath_v_tan(fv x, fmath_precision tier) {
+	fvi n;
+	fv r = fmath_v_tan_reduce(x, &n);
+	fv z = fv_mul(r, r);
+	fv q = tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(z, fmath_tan_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(z, fmath_tan_poly_balanced)
+	                                          : FMATH_V_POLY(z, fmath_tan_poly_accurate);
+	fv p = fv_mul(r, q);
+	fvm odd = fv_cmpeq(fvi_cvt(fvi_and(n, fvi_set1(1))), fv_set1(1.0f));
+	return fv_select(odd, fv_div(fv_set1(-1.0f), p), p);
+}
+
+// As fmath_atan_kernel
+FMATH_INLINE fv fmath_v_atan_kernel(fv t, fmath_precision tier) {
+	fv z = fv_mul(t, t);
+	fv q = tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(z, fmath_atan_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(z, fmath_atan_poly_balanced)
+	                                          : FMATH_V_POLY(z, fmath_atan_poly_accurate);
+	return fv_mul(t, q);
+}
+
+FMATH_INLINE fv fmath_v_sign_bit(fv x) {
+	return fvi_as_f(fvi_and(fv_as_i(x), fvi_set1((int)0x80000000u)));
+}
+
+FMATH_INLINE fv fmath_v_or(fv a, fv b) {
+	return fvi_as_f(fvi_or(fv_as_i(a), fv_as_i(b)));
+}
+
+// As fmath_atanf_impl; the explicit select keeps NaN, so it can clamp by value
+FMATH_INLINE fv fmath_v_atan(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fvm inv = fv_cmpgt(a, fv_set1(1.0f));
+	fv d = fv_select(fv_cmpgt(a, fv_set1(0x1p64f)), fv_set1(0x1p64f), a); /* atan(2^64) is pi/2 */
+	fv r = fmath_v_atan_kernel(fv_select(inv, fv_div(fv_set1(1.0f), d), a), tier);
+	r = fv_select(inv, fv_sub(fv_set1(FMATH_HALF_PI), r), r);
+	return fmath_v_or(r, fmath_v_sign_bit(x));
+}
+
+// As fmath_atan2f_impl; the nested select is the and of both infinity tests, and the
+// negative-x reflection goes by the sign bit through an integer blend
+FMATH_INLINE fv fmath_v_atan2(fv y, fv x, fmath_precision tier) {
+	fv ax = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fv ay = fvi_as_f(fvi_and(fv_as_i(y), fvi_set1(0x7fffffff)));
+	fvm swap = fv_cmpgt(ay, ax);
+	fv num = fv_select(swap, ax, ay);
+	fv den = fv_select(swap, ay, ax);
+	fv s = fv_select(fv_cmpgt(den, fv_set1(0x1p64f)), fv_set1(0x1p-64f), fv_set1(1.0f));
+	fv t = fv_div(fv_mul(num, s), fv_mul(den, s));
+	t = fv_select(fv_cmpeq(den, fv_set1(0.0f)), num, t);
+	t = fv_select(fv_cmplt(num, fv_set1(INFINITY)), fv_select(fv_cmpeq(den, fv_set1(INFINITY)), fv_set1(0.0f), t), t);
+	t = fv_select(fv_cmpeq(num, fv_set1(INFINITY)), fv_select(fv_cmpeq(den, fv_set1(INFINITY)), fv_set1(1.0f), t), t);
+	fv r = fmath_v_atan_kernel(t, tier);
+	r = fv_select(swap, fv_sub(fv_set1(FMATH_HALF_PI), r), r);
+	fvi neg = fvi_srai(fv_as_i(x), 31);
+	fvi rb = fv_as_i(r);
+	r = fvi_as_f(fvi_xor(rb, fvi_and(fvi_xor(rb, fv_as_i(fv_sub(fv_set1(FMATH_PI), r))), neg)));
+	r = fmath_v_or(r, fmath_v_sign_bit(y));
+	r = fv_select(fv_cmple(ax, fv_set1(INFINITY)), r, x); /* ordered compares: false for NaN */
+	return fv_select(fv_cmple(ay, fv_set1(INFINITY)), r, y);
+}
+
+FMATH_INLINE fv fmath_v_log(fv x, fmath_precision tier) {
+	fvi u = fvi_sub(fv_as_i(x), fvi_set1(0x3f3504f3));
+	fvi e = fvi_srai(u, 23);
+	fv f = fv_sub(fvi_as_f(fvi_add(fvi_and(u, fvi_set1(0x7fffff)), fvi_set1(0x3f3504f3))), fv_set1(1.0f));
+	fv q = tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(f, fmath_log_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(f, fmath_log_poly_balanced)
+	                                          : FMATH_V_POLY(f, fmath_log_poly_accurate);
+	fv ef = fvi_cvt(e);
+	fv y = fv_fmadd(ef, fv_set1(FMATH_LN2_HI), fv_fmadd(f, q, fv_mul(ef, fv_set1(FMATH_LN2_LO))));
+	y = fv_select(fv_cmple(x, fv_set1(3.40282347e38f)), y, x); /* +inf and NaN pass through */
+	fvm nonpos = fv_cmple(x, fv_set1(0.0f));
+	fv special = fv_select(fv_cmpeq(x, fv_set1(0.0f)), fv_set1(-INFINITY), fv_set1(NAN));
+	return fv_select(nonpos, special, y);
+}
+
+// As fmath_rsqrt_step: x * y pinned, or the SSE4.1 multiply-subtract would reassociate
+// into x * (y * y) and flush for x above ~1e38
+FMATH_INLINE fv fmath_v_rsqrt_step(fv x, fv y) {
+	fv p = fv_mul(x, y);
+	FMATH_OPAQUE(p);
+	return fv_fmadd(fv_mul(fv_set1(0.5f), y), fv_fnmadd(p, y, fv_set1(1.0f)), y);
+}
+
+// Quake III initial guess + one Newton-Raphson step (two when balanced), no special cases
+FMATH_INLINE fv fmath_v_rsqrt_core(fv x, fmath_precision tier) {
+	fv y = fvi_as_f(fvi_sub(fvi_set1(0x5f3759df), fvi_srli(fv_as_i(x), 1)));
+	y = fmath_v_rsqrt_step(x, y);
+	if (tier == FMATH_PRECISION_BALANCED) y = fmath_v_rsqrt_step(x, y);
+	return y;
+}
+
+FMATH_INLINE fv fmath_v_rsqrt(fv x, fmath_precision tier) {
+	fv special = fv_select(fv_cmpeq(x, fv_set1(0.0f)), fv_set1(INFINITY), fv_set1(NAN));
+	fv y = tier == FMATH_PRECISION_ACCURATE ? fv_div(fv_set1(1.0f), fv_sqrt(x)) : fmath_v_rsqrt_core(x, tier);
+	return fv_select(fv_cmple(x, fv_set1(0.0f)), special, y);
+}
+
+FMATH_INLINE fv fmath_v_sqrt(fv x, fmath_precision tier) {
+	if (tier == FMATH_PRECISION_ACCURATE) return fv_sqrt(x);
+	fv special = fv_select(fv_cmpeq(x, fv_set1(0.0f)), fv_set1(0.0f), fv_set1(NAN));
+	return fv_select(fv_cmple(x, fv_set1(0.0f)), special, fv_mul(x, fmath_v_rsqrt_core(x, tier)));
+}
+
+// As fmath_asin_reduced; lanes that are not big compute and discard the sqrt
+FMATH_INLINE fv fmath_v_asin_reduced(fv a, fvm big, fmath_precision tier) {
+	fv z = fv_select(big, fv_fnmadd(fv_set1(0.5f), a, fv_set1(0.5f)), fv_mul(a, a));
+	fv t;
+	if (tier == FMATH_PRECISION_ACCURATE) {
+		t = fv_sqrt(z);
+	} else {
+		fv y = fmath_v_rsqrt_core(z, tier);
+		fv s = fv_mul(z, y);
+		t = fv_fmadd(fv_mul(fv_set1(0.5f), y), fv_fnmadd(s, s, z), s);
+	}
+	fv q = tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(z, fmath_asin_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(z, fmath_asin_poly_balanced)
+	                                          : FMATH_V_POLY(z, fmath_asin_poly_accurate);
+	return fv_mul(fv_select(big, t, a), q);
+}
+
+// As fmath_asinf_impl; NaN x already comes out of the polynomial as NaN
+FMATH_INLINE fv fmath_v_asin(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fvm big = fv_cmpgt(a, fv_set1(0.5f));
+	fv p = fmath_v_asin_reduced(a, big, tier);
+	fv r = fmath_v_or(fv_select(big, fv_fnmadd(fv_set1(2.0f), p, fv_set1(FMATH_HALF_PI)), p), fmath_v_sign_bit(x));
+	return fv_select(fv_cmpgt(a, fv_set1(1.0f)), fv_set1(NAN), r);
+}
+
+// As fmath_acosf_impl
+FMATH_INLINE fv fmath_v_acos(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fvm big = fv_cmpgt(a, fv_set1(0.5f));
+	fv p = fmath_v_asin_reduced(a, big, tier);
+	fv p2 = fv_add(p, p);
+	fv r_big = fv_select(fv_cmplt(x, fv_set1(0.0f)), fv_sub(fv_set1(FMATH_PI), p2), p2);
+	fv r = fv_select(big, r_big, fv_sub(fv_set1(FMATH_HALF_PI), fmath_v_or(p, fmath_v_sign_bit(x))));
+	return fv_select(fv_cmpgt(a, fv_set1(1.0f)), fv_set1(NAN), r);
+}
+
+FMATH_INLINE fv fmath_v_sinh_poly(fv z, fmath_precision tier) {
+	return tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(z, fmath_sinh_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(z, fmath_sinh_poly_balanced)
+	                                          : FMATH_V_POLY(z, fmath_sinh_poly_accurate);
+}
+
+FMATH_INLINE fv fmath_v_cosh_poly(fv z, fmath_precision tier) {
+	return tier == FMATH_PRECISION_FAST       ? FMATH_V_POLY(z, fmath_cosh_poly_fast)
+	       : tier == FMATH_PRECISION_BALANCED ? FMATH_V_POLY(z, fmath_cosh_poly_balanced)
+	                                          : FMATH_V_POLY(z, fmath_cosh_poly_accurate);
+}
+
+// e^a / 2 for fmath_v_sinh and fmath_v_cosh, the argument kept finite-result (NaN kept)
+FMATH_INLINE fv fmath_v_exp_half(fv a, fmath_precision tier) {
+	return fmath_v_exp_core(fv_select(fv_cmpgt(a, fv_set1(FMATH_SINH_MAX)), fv_set1(0.0f), a), -1, tier);
+}
+
+// Both branches of fmath_sinhf_impl on every lane; the explicit selects keep NaN
+FMATH_INLINE fv fmath_v_sinh(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fv h = fmath_v_exp_half(a, tier);
+	fv r = fv_sub(h, fv_div(fv_set1(0.25f), h));
+	r = fv_select(fv_cmplt(a, fv_set1(0.5f)), fv_mul(a, fmath_v_sinh_poly(fv_mul(a, a), tier)), r);
+	r = fv_select(fv_cmple(fv_set1(FMATH_SINH_MAX), a), fv_set1(INFINITY), r);
+	return fmath_v_or(r, fmath_v_sign_bit(x));
+}
+
+FMATH_INLINE fv fmath_v_cosh(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fv h = fmath_v_exp_half(a, tier);
+	fv r = fv_add(h, fv_div(fv_set1(0.25f), h));
+	r = fv_select(fv_cmplt(a, fv_set1(0.5f)), fmath_v_cosh_poly(fv_mul(a, a), tier), r);
+	return fv_select(fv_cmple(fv_set1(FMATH_SINH_MAX), a), fv_set1(INFINITY), r);
+}
+
+FMATH_INLINE fv fmath_v_tanh(fv x, fmath_precision tier) {
+	fv a = fvi_as_f(fvi_and(fv_as_i(x), fvi_set1(0x7fffffff)));
+	fv b = fv_select(fv_cmpgt(a, fv_set1(FMATH_TANH_SAT)), fv_set1(FMATH_TANH_SAT), a);
+	fv e = fmath_v_exp_core(fv_add(b, b), 0, tier);
+	fv r = fv_fnmadd(fv_set1(2.0f), fv_div(fv_set1(1.0f), fv_add(e, fv_set1(1.0f))), fv_set1(1.0f));
+	fv z = fv_mul(a, a);
+	fv small = fv_div(fv_mul(a, fmath_v_sinh_poly(z, tier)), fmath_v_cosh_poly(z, tier));
+	r = fv_select(fv_cmplt(a, fv_set1(0.5f)), small, r);
+	return fmath_v_or(r, fmath_v_sign_bit(x));
+}
+
+// IEEE division already yields +/-inf for +/-0
+FMATH_INLINE fv fmath_v_rcp(fv x) {
+	return fv_div(fv_set1(1.0f), x);
+}
+
+// Full vectors, then one masked vector for the tail (no scalar epilogue)
+#define FMATH_SIMD_UNARY_ARRAY(name, kernel) \
+	static void FMATH_SIMD_NAME(name)(float *dst, const float *src, size_t count) { \
+		size_t i = 0; \
+		for (; i + FV_LANES <= count; i += FV_LANES) { \
+			fv_storeu(dst + i, kernel(fv_loadu(src + i))); \
+		} \
+		if (i < count) { \
+			size_t rem = count - i; \
+			fv_store_tail(dst + i, kernel(fv_load_tail(src + i, rem)), rem); \
+		} \
+	}
+
+// Two inputs, as above
+#define FMATH_SIMD_BINARY_ARRAY(name, kernel) \
+	static void FMATH_SIMD_NAME(name)(float *dst, const float *a, const float *b, size_t count) { \
+		size_t i = 0; \
+		for (; i + FV_LANES <= count; i += FV_LANES) { \
+			fv_storeu(dst + i, kernel(fv_loadu(a + i), fv_loadu(b + i))); \
+		} \
+		if (i < count) { \
+			size_t rem = count - i; \
+			fv_store_tail(dst + i, kernel(fv_load_tail(a + i, rem), fv_load_tail(b + i, rem)), rem); \
+		} \
+	}
+
+// One kernel per tier, the tier folded in as a constant
+#define FMATH_SIMD_TIERED_ARRAY(name, kernel) \
+	FMATH_INLINE fv kernel##_fast(fv x) { return kernel(x, FMATH_PRECISION_FAST); } \
+	FMATH_INLINE fv kernel##_balanced(fv x) { return kernel(x, FMATH_PRECISION_BALANCED); } \
+	FMATH_INLINE fv kernel##_accurate(fv x) { return kernel(x, FMATH_PRECISION_ACCURATE); } \
+	FMATH_SIMD_UNARY_ARRAY(name##_fast, kernel##_fast) \
+	FMATH_SIMD_UNARY_ARRAY(name##_balanced, kernel##_balanced) \
+	FMATH_SIMD_UNARY_ARRAY(name##_accurate, kernel##_accurate)
+
+FMATH_SIMD_UNARY_ARRAY(sinf_array, fmath_v_sin)
+FMATH_SIMD_UNARY_ARRAY(cosf_array, fmath_v_cos)
+FMATH_SIMD_TIERED_ARRAY(expf_array, fmath_v_exp)
+FMATH_SIMD_TIERED_ARRAY(logf_array, fmath_v_log)
+FMATH_SIMD_TIERED_ARRAY(sqrtf_array, fmath_v_sqrt)
+FMATH_SIMD_TIERED_ARRAY(rsqrtf_array, fmath_v_rsqrt)
+FMATH_SIMD_UNARY_ARRAY(rcpf_array, fmath_v_rcp)
+FMATH_SIMD_TIERED_ARRAY(tanf_array, fmath_v_tan)
+FMATH_SIMD_TIERED_ARRAY(atanf_array, fmath_v_atan)
+FMATH_SIMD_TIERED_ARRAY(asinf_array, fmath_v_asin)
+FMATH_SIMD_TIERED_ARRAY(acosf_array, fmath_v_acos)
+FMATH_SIMD_TIERED_ARRAY(sinhf_array, fmath_v_sinh)
+FMATH_SIMD_TIERED_ARRAY(coshf_array, fmath_v_cosh)
+FMATH_SIMD_TIERED_ARRAY(tanhf_array, fmath_v_tanh)
+
+FMATH_INLINE fv fmath_v_atan2_fast(fv y, fv x) { return fmath_v_atan2(y, x, FMATH_PRECISION_FAST); }
+FMATH_INLINE fv fmath_v_atan2_balanced(fv y, fv x) { return fmath_v_atan2(y, x, FMATH_PRECISION_BALANCED); }
+FMATH_INLINE fv fmath_v_atan2_accurate(fv y, fv x) { return fmath_v_atan2(y, x, FMATH_PRECISION_ACCURATE); }
+FMATH_SIMD_BINARY_ARRAY(atan2f_array_fast, fmath_v_atan2_fast)
+FMATH_SIMD_BINARY_ARRAY(atan2f_array_balanced, fmath_v_atan2_balanced)
+FMATH_SIMD_BINARY_ARRAY(atan2f_array_accurate, fmath_v_atan2_accurate)
+
+#undef FMATH_SIMD_TIERED_ARRAY
+#undef FMATH_SIMD_BINARY_ARRAY
+#undef FMATH_SIMD_UNARY_ARRAY
+
+static void FMATH_SIMD_NAME(sincosf_array)(float *dst_sin, float *dst_cos, const float *src, size_t count) {
+	size_t i = 0;
+	fv c;
+	for (; i + FV_LANES <= count; i += FV_LANES) {
+		fv_storeu(dst_sin + i, fmath_v_sincos(fv_loadu(src + i), &c));
+		fv_storeu(dst_cos + i, c);
+	}
+	if (i < count) {
+		size_t rem = count - i;
+		fv_store_tail(dst_sin + i, fmath_v_sincos(fv_load_tail(src + i, rem), &c), rem);
+		fv_store_tail(dst_cos + i, c, rem);
+	}
+}
+
+// {cos, sin} pairs; the tail is interleaved on the stack and copied out
+static void FMATH_SIMD_NAME(cisf_array)(float *dst, const float *src, size_t count) {
+	size_t i = 0;
+	fv c;
+	for (; i + FV_LANES <= count; i += FV_LANES) {
+		fv s = fmath_v_sincos(fv_loadu(src + i), &c);
+		fv_store_interleave(dst + 2 * i, c, s);
+	}
+	if (i < count) {
+		size_t rem = count - i;
+		float tmp[2 * FV_LANES];
+		fv s = fmath_v_sincos(fv_load_tail(src + i, rem), &c);
+		fv_store_interleave(tmp, c, s);
+		memcpy(dst + 2 * i, tmp, 2 * rem * sizeof(float));
+	}
+}
+
+const fmath_kernel_table FMATH_SIMD_NAME(kernels) = {
+	FMATH_SIMD_NAME(sinf_array),
+	FMATH_SIMD_NAME(cosf_array),
+	{FMATH_SIMD_NAME(expf_array_fast), FMATH_SIMD_NAME(expf_array_balanced), FMATH_SIMD_NAME(expf_array_accurate)},
+	{FMATH_SIMD_NAME(logf_array_fast), FMATH_SIMD_NAME(logf_array_balanced), FMATH_SIMD_NAME(logf_array_accurate)},
+	{FMATH_SIMD_NAME(sqrtf_array_fast), FMATH_SIMD_NAME(sqrtf_array_balanced), FMATH_SIMD_NAME(sqrtf_array_accurate)},
+	{FMATH_SIMD_NAME(rsqrtf_array_fast), FMATH_SIMD_NAME(rsqrtf_array_balanced),
+	 FMATH_SIMD_NAME(rsqrtf_array_accurate)},
+	FMATH_SIMD_NAME(rcpf_array),
+	{FMATH_SIMD_NAME(tanf_array_fast), FMATH_SIMD_NAME(tanf_array_balanced), FMATH_SIMD_NAME(tanf_array_accurate)},
+	{FMATH_SIMD_NAME(atanf_array_fast), FMATH_SIMD_NAME(atanf_array_balanced), FMATH_SIMD_NAME(atanf_array_accurate)},
+	{FMATH_SIMD_NAME(atan2f_array_fast), FMATH_SIMD_NAME(atan2f_array_balanced),
+	 FMATH_SIMD_NAME(atan2f_array_accurate)},
+	{FMATH_SIMD_NAME(asinf_array_fast), FMATH_SIMD_NAME(asinf_array_balanced), FMATH_SIMD_NAME(asinf_array_accurate)},
+	{FMATH_SIMD_NAME(acosf_array_fast), FMATH_SIMD_NAME(acosf_array_balanced), FMATH_SIMD_NAME(acosf_array_accurate)},
+	{FMATH_SIMD_NAME(sinhf_array_fast), FMATH_SIMD_NAME(sinhf_array_balanced), FMATH_SIMD_NAME(sinhf_array_accurate)},
+	{FMATH_SIMD_NAME(coshf_array_fast), FMATH_SIMD_NAME(coshf_array_balanced), FMATH_SIMD_NAME(coshf_array_accurate)},
+	{FMATH_SIMD_NAME(tanhf_array_fast), FMATH_SIMD_NAME(tanhf_array_balanced), FMATH_SIMD_NAME(tanhf_array_accurate)},
+	FMATH_SIMD_NAME(sincosf_array),
+	FMATH_SIMD_NAME(cisf_array),
+};
+
+#if defined(FMATH_SIMD_VABI) && FMATH_HAVE_VECTOR_ABI
+#ifndef FMATH_SIMD_VABI_ATTR
+#define FMATH_SIMD_VABI_ATTR
+#endif
+FMATH_SIMD_VABI_ATTR fv FMATH_SIMD_VABI(fmath_sinf)(fv x) { return fmath_v_sin(x); }
+FMATH_SIMD_VABI_ATTR fv FMATH_SIMD_VABI(fmath_cosf)(fv x) { return fmath_v_cos(x); }
+// Clones of const scalar functions: fixed at the build's tier, like the scalar API
+#define FMATH_SIMD_TIERED_VABI(fn, kernel) \
+	FMATH_SIMD_VABI_ATTR fv FMATH_SIMD_VABI(fn)(fv x) { return kernel(x, (fmath_precision)FMATH_PRECISION); }
+FMATH_SIMD_TIERED_VABI(fmath_expf, fmath_v_exp)
+FMATH_SIMD_TIERED_VABI(fmath_logf, fmath_v_log)
+FMATH_SIMD_TIERED_VABI(fmath_sqrtf, fmath_v_sqrt)
+FMATH_SIMD_TIERED_VABI(fmath_rsqrtf, fmath_v_rsqrt)
+FMATH_SIMD_TIERED_VABI(fmath_tanf, fmath_v_tan)
+FMATH_SIMD_TIERED_VABI(fmath_atanf, fmath_v_atan)
+FMATH_SIMD_TIERED_VABI(fmath_asinf, fmath_v_asin)
+FMATH_SIMD_TIERED_VABI(fmath_acosf, fmath_v_acos)
+FMATH_SIMD_TIERED_VABI(fmath_sinhf, fmath_v_sinh)
+FMATH_SIMD_TIERED_VABI(fmath_coshf, fmath_v_cosh)
+FMATH_SIMD_TIERED_VABI(fmath_tanhf, fmath_v_tanh)
+#undef FMATH_SIMD_TIERED_VABI
+FMATH_SIMD_VABI_ATTR fv FMATH_SIMD_VABI2(fmath_atan2f)(fv y, fv x) {
+	return fmath_v_atan2(y, x, (fmath_precision)FMATH_PRECISION);
+}
+FMATH_SIMD_VABI_ATTR fv FMATH_SIMD_VABI(fmath_rcpf)(fv x) { return fmath_v_rcp(x); }
+#endif
@@ -0,0 +1,92 @@
+#include "fmath_internal.h"
+
+// 4-wide SSE4.1 kernels for pre-AVX2 CPUs. No FMA or hardware gather at this
+// level: multiply-adds are split and LUT lookups are four scalar loads.
+
+#if FMATH_HAVE_SSE41
+
+#include <immintrin.h>
+
+#if defined(__clang__)
+#pragma clang attribute push(__attribute__((target("sse4.1"))), apply_to = function)
+#else
+#pragma GCC target("sse4.1")
+#endif
+
+typedef __m128 fv;
+typedef __m128i fvi;
+typedef __m128 fvm;
+
+#define FV_LANES 4
+#define FMATH_SIMD_NAME(name) fmath_sse41_##name
+#define FMATH_SIMD_VABI(fn) fmath_sse41_vabi_##fn /* wrapped by fmath_vector_abi.c */
+#define FMATH_SIMD_VABI2(fn) fmath_sse41_vabi2_##fn
+#define FMATH_SIMD_VABI_ATTR FMATH_HIDDEN
+
+FMATH_INLINE fv fv_set1(float x) { return _mm_set1_ps(x); }
+FMATH_INLINE fv fv_loadu(const float *p) { return _mm_loadu_ps(p); }
+FMATH_INLINE void fv_storeu(float *p, fv v) { _mm_storeu_ps(p, v); }
+
+// Lanes [0, n) active; n in [1, FV_LANES). No masked moves before AVX, so bounce via the stack.
+FMATH_INLINE fv fv_load_tail(const float *p, size_t n) {
+	float tmp[FV_LANES] = {0.0f, 0.0f, 0.0f, 0.0f};
+	memcpy(tmp, p, n * sizeof(float));
+	return _mm_loadu_ps(tmp);
+}
+FMATH_INLINE void fv_store_tail(float *p, fv v, size_t n) {
+	float tmp[FV_LANES];
+	_mm_storeu_ps(tmp, v);
+	memcpy(p, tmp, n * sizeof(float));
+}
+
+FMATH_INLINE fv fv_add(fv a, fv b) { return _mm_add_ps(a, b); }
+FMATH_INLINE fv fv_sub(fv a, fv b) { return _mm_sub_ps(a, b); }
+FMATH_INLINE fv fv_mul(fv a, fv b) { return _mm_mul_ps(a, b); }
+FMATH_INLINE fv fv_div(fv a, fv b) { return _mm_div_ps(a, b); }
+FMATH_INLINE fv fv_sqrt(fv a) { return _mm_sqrt_ps(a); }
+FMATH_INLINE fv fv_fmadd(fv a, fv b, fv c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }  /* a*b + c */
+FMATH_INLINE fv fv_fnmadd(fv a, fv b, fv c) { return _mm_sub_ps(c, _mm_mul_ps(a, b)); } /* c - a*b */
+FMATH_INLINE fv fv_floor(fv a) { return _mm_floor_ps(a); }
+FMATH_INLINE fv fv_round(fv a) { return _mm_round_ps(a, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC); }
+
+FMATH_INLINE fvm fv_cmplt(fv a, fv b) { return _mm_cmplt_ps(a, b); }
+FMATH_INLINE fvm fv_cmple(fv a, fv b) { return _mm_cmple_ps(a, b); }
+FMATH_INLINE fvm fv_cmpgt(fv a, fv b) { return _mm_cmpgt_ps(a, b); }
+FMATH_INLINE fvm fv_cmpeq(fv a, fv b) { return _mm_cmpeq_ps(a, b); }
+FMATH_INLINE fv fv_select(fvm m, fv t, fv f) { return _mm_blendv_ps(f, t, m); }
+FMATH_INLINE int fvm_any(fvm m) { return _mm_movemask_ps(m) != 0; }
+
+FMATH_INLINE fvi fv_cvtt(fv a) { return _mm_cvttps_epi32(a); }
+FMATH_INLINE fv fvi_cvt(fvi a) { return _mm_cvtepi32_ps(a); }
+FMATH_INLINE fvi fv_as_i(fv a) { return _mm_castps_si128(a); }
+FMATH_INLINE fv fvi_as_f(fvi a) { return _mm_castsi128_ps(a); }
+FMATH_INLINE fvi fvi_set1(int x) { return _mm_set1_epi32(x); }
+FMATH_INLINE fvi fvi_loadu(const int32_t *p) { return _mm_loadu_si128((const __m128i *)p); }
+FMATH_INLINE void fvi_storeu(int32_t *p, fvi v) { _mm_storeu_si128((__m128i *)p, v); }
+FMATH_INLINE fvi fvi_add(fvi a, fvi b) { return _mm_add_epi32(a, b); }
+FMATH_INLINE fvi fvi_sub(fvi a, fvi b) { return _mm_sub_epi32(a, b); }
+FMATH_INLINE fvi fvi_and(fvi a, fvi b) { return _mm_and_si128(a, b); }
+FMATH_INLINE fvi fvi_or(fvi a, fvi b) { return _mm_or_si128(a, b); }
+FMATH_INLINE fvi fvi_xor(fvi a, fvi b) { return _mm_xor_si128(a, b); }
+#define fvi_slli(a, n) _mm_slli_epi32((a), (n))
+#define fvi_srli(a, n) _mm_srli_epi32((a), (n))
+#define fvi_srai(a, n) _mm_srai_epi32((a), (n))
+
+FMATH_INLINE fv fv_gather(const float *base, fvi idx) {
+	return _mm_setr_ps(base[_mm_extract_epi32(idx, 0)], base[_mm_extract_epi32(idx, 1)],
+	                   base[_mm_extract_epi32(idx, 2)], base[_mm_extract_epi32(idx, 3)]);
+}
+
+// a0 b0 a1 b1 ... into 2 * FV_LANES floats
+FMATH_INLINE void fv_store_interleave(float *p, fv a, fv b) {
+	_mm_storeu_ps(p, _mm_unpacklo_ps(a, b));
+	_mm_storeu_ps(p + 4, _mm_unpackhi_ps(a, b));
+}
+
+#include "fmath_simd_kernels.h"
+
+#if defined(__clang__)
+#pragma clang attribute pop
+#endif
+
+#endif /* FMATH_HAVE_SSE41 */
@@ -0,0 +1,143 @@
+#include "fmath_internal.h"
+
+// SSE2 (b) and AVX (c) vector function ABI variants. Callers only guarantee SSE2/AVX,
+// so the b symbols are ifunc-resolved to the SSE4.1 kernels or a per-lane scalar
+// fallback, and the c symbols split the ymm argument into two SSE4.1 halves.
+// Builds without the AVX2 or AVX-512 kernels still export d and e here, as two c or
+// two d halves, since clients vectorize against all four; without SSE4.1 the halves
+// bottom out in the scalar loop.
+
+#if FMATH_HAVE_VECTOR_ABI
+
+#include <immintrin.h>
+
+#define FMATH_VABI_FUNCS(X) \
+	X(sinf) X(cosf) X(tanf) X(atanf) X(asinf) X(acosf) X(sinhf) X(coshf) X(tanhf) X(expf) X(logf) X(sqrtf) \
+	X(rsqrtf) X(rcpf)
+#define FMATH_VABI2_FUNCS(X) X(atan2f)
+
+typedef __m128 (*fmath_vabi_b_fn)(__m128);
+typedef __m128 (*fmath_vabi2_b_fn)(__m128, __m128);
+
+#define FMATH_VABI_SCALAR(fn) \
+	static __m128 fmath_vabi_scalar_##fn(__m128 x) { \
+		float v[4]; \
+		_mm_storeu_ps(v, x); \
+		for (int i = 0; i < 4; ++i) v[i] = fmath_##fn(v[i]); \
+		return _mm_loadu_ps(v); \
+	}
+FMATH_VABI_FUNCS(FMATH_VABI_SCALAR)
+#undef FMATH_VABI_SCALAR
+
+#define FMATH_VABI2_SCALAR(fn) \
+	static __m128 fmath_vabi2_scalar_##fn(__m128 a, __m128 b) { \
+		float va[4], vb[4]; \
+		_mm_storeu_ps(va, a); \
+		_mm_storeu_ps(vb, b); \
+		for (int i = 0; i < 4; ++i) va[i] = fmath_##fn(va[i], vb[i]); \
+		return _mm_loadu_ps(va); \
+	}
+FMATH_VABI2_FUNCS(FMATH_VABI2_SCALAR)
+#undef FMATH_VABI2_SCALAR
+
+// 4-wide body behind b and c: the SSE4.1 kernel (AVX callers have SSE4.1), else scalar
+#if FMATH_HAVE_SSE41
+#define FMATH_VABI_DECLARE(fn) FMATH_HIDDEN __m128 fmath_sse41_vabi_fmath_##fn(__m128 x);
+FMATH_VABI_FUNCS(FMATH_VABI_DECLARE)
+#undef FMATH_VABI_DECLARE
+
+#define FMATH_VABI2_DECLARE(fn) FMATH_HIDDEN __m128 fmath_sse41_vabi2_fmath_##fn(__m128 a, __m128 b);
+FMATH_VABI2_FUNCS(FMATH_VABI2_DECLARE)
+#undef FMATH_VABI2_DECLARE
+
+#define FMATH_VABI_QUAD(fn) fmath_sse41_vabi_fmath_##fn
+#define FMATH_VABI2_QUAD(fn) fmath_sse41_vabi2_fmath_##fn
+#else
+#define FMATH_VABI_QUAD(fn) fmath_vabi_scalar_##fn
+#define FMATH_VABI2_QUAD(fn) fmath_vabi2_scalar_##fn
+#endif
+
+#define FMATH_VABI_B(fn) \
+	static fmath_vabi_b_fn fmath_vabi_resolve_##fn(void) { \
+		__builtin_cpu_init(); \
+		return FMATH_HAVE_SSE41 && __builtin_cpu_supports("sse4.1") ? FMATH_VABI_QUAD(fn) : fmath_vabi_scalar_##fn; \
+	} \
+	__m128 _ZGVbN4v_fmath_##fn(__m128 x) __attribute__((ifunc("fmath_vabi_resolve_" #fn)));
+FMATH_VABI_FUNCS(FMATH_VABI_B)
+#undef FMATH_VABI_B
+
+#define FMATH_VABI_C(fn) \
+	__attribute__((target("avx"))) __m256 _ZGVcN8v_fmath_##fn(__m256 x) { \
+		__m128 lo = FMATH_VABI_QUAD(fn)(_mm256_castps256_ps128(x)); \
+		__m128 hi = FMATH_VABI_QUAD(fn)(_mm256_extractf128_ps(x, 1)); \
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1); \
+	}
+FMATH_VABI_FUNCS(FMATH_VABI_C)
+#undef FMATH_VABI_C
+
+// The same for two-argument functions (vv variants)
+#define FMATH_VABI2_B(fn) \
+	static fmath_vabi2_b_fn fmath_vabi2_resolve_##fn(void) { \
+		__builtin_cpu_init(); \
+		return FMATH_HAVE_SSE41 && __builtin_cpu_supports("sse4.1") ? FMATH_VABI2_QUAD(fn) : fmath_vabi2_scalar_##fn; \
+	} \
+	__m128 _ZGVbN4vv_fmath_##fn(__m128 a, __m128 b) __attribute__((ifunc("fmath_vabi2_resolve_" #fn)));
+FMATH_VABI2_FUNCS(FMATH_VABI2_B)
+#undef FMATH_VABI2_B
+
+#define FMATH_VABI2_C(fn) \
+	__attribute__((target("avx"))) __m256 _ZGVcN8vv_fmath_##fn(__m256 a, __m256 b) { \
+		__m128 lo = FMATH_VABI2_QUAD(fn)(_mm256_castps256_ps128(a), _mm256_castps256_ps128(b)); \
+		__m128 hi = FMATH_VABI2_QUAD(fn)(_mm256_extractf128_ps(a, 1), _mm256_extractf128_ps(b, 1)); \
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1); \
+	}
+FMATH_VABI2_FUNCS(FMATH_VABI2_C)
+#undef FMATH_VABI2_C
+
+// d without the AVX2 kernels: the c variant, which AVX2 callers can run
+#if !FMATH_HAVE_AVX2
+#define FMATH_VABI_D(fn) \
+	__attribute__((target("avx2"))) __m256 _ZGVdN8v_fmath_##fn(__m256 x) { return _ZGVcN8v_fmath_##fn(x); }
+FMATH_VABI_FUNCS(FMATH_VABI_D)
+#undef FMATH_VABI_D
+
+#define FMATH_VABI2_D(fn) \
+	__attribute__((target("avx2"))) __m256 _ZGVdN8vv_fmath_##fn(__m256 a, __m256 b) { \
+		return _ZGVcN8vv_fmath_##fn(a, b); \
+	}
+FMATH_VABI2_FUNCS(FMATH_VABI2_D)
+#undef FMATH_VABI2_D
+#else
+#define FMATH_VABI_DECLARE_D(fn) __attribute__((target("avx2"))) __m256 _ZGVdN8v_fmath_##fn(__m256 x);
+FMATH_VABI_FUNCS(FMATH_VABI_DECLARE_D)
+#undef FMATH_VABI_DECLARE_D
+
+#define FMATH_VABI2_DECLARE_D(fn) __attribute__((target("avx2"))) __m256 _ZGVdN8vv_fmath_##fn(__m256 a, __m256 b);
+FMATH_VABI2_FUNCS(FMATH_VABI2_DECLARE_D)
+#undef FMATH_VABI2_DECLARE_D
+#endif
+
+// e without the AVX-512 kernels: two d halves
+#if !FMATH_HAVE_AVX512
+#define FMATH_ZMM_LO(v) _mm512_castps512_ps256(v)
+#define FMATH_ZMM_HI(v) _mm256_castpd_ps(_mm512_extractf64x4_pd(_mm512_castps_pd(v), 1))
+#define FMATH_ZMM_JOIN(lo, hi) \
+	_mm512_castpd_ps(_mm512_insertf64x4(_mm512_castps_pd(_mm512_castps256_ps512(lo)), _mm256_castps_pd(hi), 1))
+
+#define FMATH_VABI_E(fn) \
+	__attribute__((target("avx512f"))) __m512 _ZGVeN16v_fmath_##fn(__m512 x) { \
+		return FMATH_ZMM_JOIN(_ZGVdN8v_fmath_##fn(FMATH_ZMM_LO(x)), _ZGVdN8v_fmath_##fn(FMATH_ZMM_HI(x))); \
+	}
+FMATH_VABI_FUNCS(FMATH_VABI_E)
+#undef FMATH_VABI_E
+
+#define FMATH_VABI2_E(fn) \
+	__attribute__((target("avx512f"))) __m512 _ZGVeN16vv_fmath_##fn(__m512 a, __m512 b) { \
+		return FMATH_ZMM_JOIN(_ZGVdN8vv_fmath_##fn(FMATH_ZMM_LO(a), FMATH_ZMM_LO(b)), \
+		                      _ZGVdN8vv_fmath_##fn(FMATH_ZMM_HI(a), FMATH_ZMM_HI(b))); \
+	}
+FMATH_VABI2_FUNCS(FMATH_VABI2_E)
+#undef FMATH_VABI2_E
+#endif
+
+#endif /* FMATH_HAVE_VECTOR_ABI */
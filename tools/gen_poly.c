@@ -0,0 +1,242 @@
+// Generates include/fmath_poly.h: minimax coefficients of the polynomial kernels for every
+// precision tier, by Remez exchange in long double. Each approximation minimizes the
+// max relative error on its reduced interval; the header records that error after
+// rounding the coefficients to float.
+//
+//   gcc -O2 tools/gen_poly.c -o gen_poly -lm && ./gen_poly > include/fmath_poly.h
+//
+// Optional arguments: function degree, e.g. `./gen_poly log 5`, to print one
+// approximation (coefficients and error) when choosing degrees for a new tier.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+typedef long double ld;
+
+enum {
+	MAX_DEGREE = 16,
+	GRID = 20000,      /* extremum search points per exchange */
+	CHECK = 200000,    /* points for the reported error */
+	MAX_ITERATIONS = 100
+};
+
+static ld exp_target(ld x) {
+	return expl(x);
+}
+
+// log1p(x) / x, so that log(1 + f) = f * q(f) keeps the relative error of q
+static ld log_target(ld x) {
+	return fabsl(x) < 1e-12L ? 1.0L - x / 2.0L : log1pl(x) / x;
+}
+
+// tan(r) / r as a function of z = r^2, so that tan(r) = r * q(r^2) keeps the relative error of q
+static ld tan_target(ld z) {
+	if (z < 1e-12L) return 1.0L + z / 3.0L;
+	ld r = sqrtl(z);
+	return tanl(r) / r;
+}
+
+// atan(t) / t as a function of z = t^2
+static ld atan_target(ld z) {
+	if (z < 1e-12L) return 1.0L - z / 3.0L;
+	ld t = sqrtl(z);
+	return atanl(t) / t;
+}
+
+// asin(t) / t as a function of z = t^2
+static ld asin_target(ld z) {
+	if (z < 1e-12L) return 1.0L + z / 6.0L;
+	ld t = sqrtl(z);
+	return asinl(t) / t;
+}
+
+// sinh(x) / x and cosh(x) as functions of z = x^2
+static ld sinh_target(ld z) {
+	if (z < 1e-12L) return 1.0L + z / 6.0L;
+	ld x = sqrtl(z);
+	return sinhl(x) / x;
+}
+
+static ld cosh_target(ld z) {
+	return coshl(sqrtl(z));
+}
+
+typedef struct poly_spec {
+	const char *name;    /* emitted as fmath_<name>_poly_<tier> */
+	const char *comment; /* what is approximated, where */
+	ld (*target)(ld);
+	ld a, b;
+	int degree[3]; /* fast, balanced, accurate */
+} poly_spec;
+
+static const poly_spec specs[] = {
+	{"exp", "e^g on [-ln2/2, ln2/2]", exp_target, -0.34657359027997265471L, 0.34657359027997265471L, {3, 4, 6}},
+	{"log", "log1p(f) / f on [sqrt(1/2) - 1, sqrt(2) - 1]", log_target, -0.29289321881345247560L,
+	 0.41421356237309504880L, {4, 6, 8}},
+	{"tan", "tan(r) / r in z = r^2 on [0, (pi/4)^2]", tan_target, 0.0L, 0.61685027506808491368L, {3, 4, 6}},
+	{"atan", "atan(t) / t in z = t^2 on [0, 1]", atan_target, 0.0L, 1.0L, {4, 6, 8}},
+	{"asin", "asin(t) / t in z = t^2 on [0, 1/4]", asin_target, 0.0L, 0.25L, {2, 3, 5}},
+	{"sinh", "sinh(x) / x in z = x^2 on [0, 1/4]", sinh_target, 0.0L, 0.25L, {1, 2, 3}},
+	{"cosh", "cosh(x) in z = x^2 on [0, 1/4]", cosh_target, 0.0L, 0.25L, {2, 3, 4}},
+};
+
+static const char *const tier_names[] = {"fast", "balanced", "accurate"};
+
+static ld poly_eval(const ld *c, int n, ld x) {
+	ld p = c[n];
+	for (int k = n - 1; k >= 0; --k) p = p * x + c[k];
+	return p;
+}
+
+// Relative error of c against target at x
+static ld rel_error(const poly_spec *s, const ld *c, int n, ld x) {
+	ld t = s->target(x);
+	return (poly_eval(c, n, x) - t) / t;
+}
+
+// Gaussian elimination with partial pivoting; solution left in b
+static void solve(int m, ld A[][MAX_DEGREE + 2], ld *b) {
+	for (int i = 0; i < m; ++i) {
+		int p = i;
+		for (int r = i + 1; r < m; ++r) {
+			if (fabsl(A[r][i]) > fabsl(A[p][i])) p = r;
+		}
+		for (int k = 0; k < m; ++k) {
+			ld t = A[i][k];
+			A[i][k] = A[p][k];
+			A[p][k] = t;
+		}
+		ld t = b[i];
+		b[i] = b[p];
+		b[p] = t;
+		for (int r = i + 1; r < m; ++r) {
+			ld f = A[r][i] / A[i][i];
+			for (int k = i; k < m; ++k) A[r][k] -= f * A[i][k];
+			b[r] -= f * b[i];
+		}
+	}
+	for (int i = m - 1; i >= 0; --i) {
+		for (int k = i + 1; k < m; ++k) b[i] -= A[i][k] * b[k];
+		b[i] /= A[i][i];
+	}
+}
+
+// Remez exchange for the degree-n polynomial c minimizing max |(p - f) / f| on [a, b]:
+// solve p(x_i) - f(x_i) = (-1)^i E f(x_i) on n + 2 reference points, then move the
+// references to the extrema of the error curve until they level out.
+static void remez(const poly_spec *s, int n, ld *c) {
+	int m = n + 2;
+	ld xs[MAX_DEGREE + 2];
+	for (int i = 0; i < m; ++i) {
+		xs[i] = (s->a + s->b) / 2 - (s->b - s->a) / 2 * cosl(3.14159265358979323846L * i / (m - 1));
+	}
+	static ld ex[GRID + 1], ev[GRID + 1];
+	for (int it = 0; it < MAX_ITERATIONS; ++it) {
+		ld A[MAX_DEGREE + 2][MAX_DEGREE + 2], rhs[MAX_DEGREE + 2];
+		for (int i = 0; i < m; ++i) {
+			ld p = 1, t = s->target(xs[i]);
+			for (int k = 0; k <= n; ++k) {
+				A[i][k] = p;
+				p *= xs[i];
+			}
+			A[i][n + 1] = (i & 1 ? -1 : 1) * t;
+			rhs[i] = t;
+		}
+		solve(m, A, rhs);
+		memcpy(c, rhs, sizeof(ld) * (size_t)(n + 1));
+		ld level = fabsl(rhs[n + 1]);
+
+		// One extremum per run of equal sign
+		static ld nx[GRID + 1], nv[GRID + 1];
+		ld max_err = 0;
+		int cnt = 0;
+		for (int i = 0; i <= GRID; ++i) {
+			ex[i] = s->a + (s->b - s->a) * i / GRID;
+			ev[i] = rel_error(s, c, n, ex[i]);
+		}
+		for (int i = 0; i <= GRID;) {
+			int sign = ev[i] >= 0, best = i;
+			for (; i <= GRID && (ev[i] >= 0) == sign; ++i) {
+				if (fabsl(ev[i]) > fabsl(ev[best])) best = i;
+			}
+			nx[cnt] = ex[best];
+			nv[cnt] = ev[best];
+			if (fabsl(nv[cnt]) > max_err) max_err = fabsl(nv[cnt]);
+			++cnt;
+		}
+		// Too many alternations: drop the smaller end until n + 2 remain
+		while (cnt > m) {
+			if (fabsl(nv[0]) < fabsl(nv[cnt - 1])) {
+				memmove(nx, nx + 1, sizeof(ld) * (size_t)(cnt - 1));
+				memmove(nv, nv + 1, sizeof(ld) * (size_t)(cnt - 1));
+			}
+			--cnt;
+		}
+		if (cnt < m) break;
+		memcpy(xs, nx, sizeof(ld) * (size_t)m);
+		if (max_err <= level * (1 + 1e-9L)) break; /* equioscillating */
+	}
+}
+
+// Rounds c to float and returns the max relative error of the rounded polynomial
+static ld round_to_float(const poly_spec *s, ld *c, int n) {
+	for (int k = 0; k <= n; ++k) c[k] = (float)c[k];
+	ld worst = 0;
+	for (int i = 0; i <= CHECK; ++i) {
+		ld e = fabsl(rel_error(s, c, n, s->a + (s->b - s->a) * i / CHECK));
+		if (e > worst) worst = e;
+	}
+	return worst;
+}
+
+// Coefficient list, 7 per line, in the style of tools/gen_sin_lut.c
+static void print_coefficients(const ld *c, int n) {
+	for (int k = 0; k <= n; ++k) {
+		char lit[32];
+		snprintf(lit, sizeof lit, "%.9g", (double)c[k]); /* round-trips a float */
+		if (!strpbrk(lit, ".e")) strcat(lit, ".0");
+		printf("%s%sf,%s", (k % 7) == 0 ? "\t" : "", lit, (k % 7) == 6 || k == n ? "\n" : " ");
+	}
+}
+
+int main(int argc, char **argv) {
+	size_t nspecs = sizeof specs / sizeof specs[0];
+	if (argc == 3) {
+		int n = atoi(argv[2]);
+		for (size_t i = 0; i < nspecs; ++i) {
+			if (strcmp(argv[1], specs[i].name) != 0 || n < 1 || n > MAX_DEGREE) continue;
+			ld c[MAX_DEGREE + 1];
+			remez(&specs[i], n, c);
+			ld err = round_to_float(&specs[i], c, n);
+			printf("%s degree %d: max relative error %.2Le\n", specs[i].comment, n, err);
+			print_coefficients(c, n);
+			return 0;
+		}
+	}
+	if (argc != 1) {
+		fprintf(stderr, "usage: %s [exp|log|tan|atan|asin|sinh|cosh degree], 1 <= degree <= %d\n", argv[0], MAX_DEGREE);
+		return 1;
+	}
+
+	printf("// Generated by tools/gen_poly.c -- do not edit.\n");
+	printf("// Minimax polynomial coefficients for the precision tiers, lowest order first, with\n");
+	printf("// the max relative error of each approximation after rounding the coefficients to float.\n");
+	printf("// Included by fmath_inline.h and the SIMD kernel files; one array per tier and function.\n");
+	printf("\n#ifndef FMATH_POLY_H\n#define FMATH_POLY_H\n");
+	for (size_t i = 0; i < nspecs; ++i) {
+		printf("\n// %s: %s\n", specs[i].name, specs[i].comment);
+		for (int tier = 0; tier < 3; ++tier) {
+			int n = specs[i].degree[tier];
+			ld c[MAX_DEGREE + 1];
+			remez(&specs[i], n, c);
+			ld err = round_to_float(&specs[i], c, n);
+			printf("static const float fmath_%s_poly_%s[] = { /* %.1Le */\n", specs[i].name, tier_names[tier], err);
+			print_coefficients(c, n);
+			printf("};\n");
+		}
+	}
+	printf("\n#endif /* FMATH_POLY_H */\n");
+	return 0;
+}
@@ -0,0 +1,79 @@
+// Generates include/fmath_sin_lut.h: the sin LUT for every supported FMATH_TABLE_BITS,
+// so the table is a const array in .rodata instead of being filled at startup.
+// Full-period tables cover [min_bits, max_bits]; quarter-wave tables
+// (FMATH_SIN_LUT_QUARTER, 4x smaller) cover [min_bits, max_bits + 2]; Hermite
+// {value, slope} pair tables (FMATH_SIN_HERMITE) cover [min_bits, min(max_bits, 10)],
+// past which the cubic error is far below float rounding.
+//
+//   gcc -O2 tools/gen_sin_lut.c -o gen_sin_lut -lm && ./gen_sin_lut > include/fmath_sin_lut.h
+//
+// Optional arguments: min_bits max_bits (default 4 12).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+// sin(2*pi*i/n) with exact quadrant symmetry, so sin(pi) is 0 and sin(pi/2) is 1 exactly
+static long double lut_value(long i, long n) {
+	const long double two_pi = 6.283185307179586476925286766559L;
+	long quarter = n / 4;
+	long q = (i / quarter) & 3;
+	long double r = two_pi * (long double)(i % quarter) / (long double)n;
+	long double v;
+	switch (q) {
+	case 0: v = sinl(r); break;
+	case 1: v = cosl(r); break;
+	case 2: v = -sinl(r); break;
+	default: v = -cosl(r); break;
+	}
+	return v;
+}
+
+// Table entry k: sin(2*pi*k/n), or for Hermite tables the pair {sin, d sin / d index}
+// of point k/2, the derivative being (2*pi/n) * cos = (2*pi/n) * sin(. + n/4).
+static float lut_entry(long k, long n, int hermite) {
+	const long double step = 6.283185307179586476925286766559L / (long double)n;
+	if (!hermite) return (float)lut_value(k, n);
+	long i = k >> 1;
+	return (float)((k & 1) ? step * lut_value((i + n / 4) % n, n) : lut_value(i % n, n));
+}
+
+// Entries 0..last of the 2^bits-point period
+static void emit_table(int bits, long last, int first, int hermite) {
+	long n = 1L << bits;
+	printf("%s FMATH_TABLE_BITS == %d\n", first ? "#if" : "#elif", bits);
+	for (long i = 0; i <= last; ++i) {
+		char lit[32];
+		float v = lut_entry(i, n, hermite);
+		if (v == 0.0f) v = 0.0f; /* no -0 */
+		snprintf(lit, sizeof lit, "%.9g", (double)v); /* round-trips a float */
+		if (!strpbrk(lit, ".e")) strcat(lit, ".0");
+		printf("%s%sf,%s", (i % 8) == 0 ? "\t" : "", lit, (i % 8) == 7 || i == last ? "\n" : " ");
+	}
+}
+
+int main(int argc, char **argv) {
+	int min_bits = argc > 1 ? atoi(argv[1]) : 4;
+	int max_bits = argc > 2 ? atoi(argv[2]) : 12;
+	if (min_bits < 2 || max_bits > 22 || min_bits > max_bits) {
+		fprintf(stderr, "usage: %s [min_bits max_bits], 2 <= min_bits <= max_bits <= 22\n", argv[0]);
+		return 1;
+	}
+	printf("// Generated by tools/gen_sin_lut.c -- do not edit.\n");
+	printf("// sin(2*pi*i/N), N = 2^FMATH_TABLE_BITS: i = 0..N/4 in quarter-wave mode, else\n");
+	printf("// i = 0..N (entry N closes the period); in Hermite mode {sin, (2*pi/N) * cos} pairs,\n");
+	printf("// i = 0..N. Included inside the initializer of fmath_sin_lut in fmath_inline.h.\n\n");
+	int hermite_max = max_bits < 10 ? max_bits : 10;
+	printf("#if FMATH_SIN_HERMITE\n");
+	for (int bits = min_bits; bits <= hermite_max; ++bits) emit_table(bits, 2 * (1L << bits) + 1, bits == min_bits, 1);
+	printf("#else\n#error \"no generated Hermite sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c\"\n#endif\n");
+	printf("#elif FMATH_SIN_LUT_QUARTER\n");
+	for (int bits = min_bits; bits <= max_bits + 2; ++bits) emit_table(bits, 1L << (bits - 2), bits == min_bits, 0);
+	printf("#else\n#error \"no generated quarter-wave sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c\"\n#endif\n");
+	printf("#else\n");
+	for (int bits = min_bits; bits <= max_bits; ++bits) emit_table(bits, 1L << bits, bits == min_bits, 0);
+	printf("#else\n#error \"no generated sin LUT for this FMATH_TABLE_BITS; rerun tools/gen_sin_lut.c with a wider range\"\n#endif\n");
+	printf("#endif\n");
+	return 0;
+}